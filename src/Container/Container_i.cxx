@@ -49,6 +49,7 @@ int SIGUSR1 = 1000;
 #include CORBA_SERVER_HEADER(SALOME_Exception)
 #include <pthread.h>  // must be before Python.h !
 #include "SALOME_Container_i.hxx"
+#include "SALOME_ContainerManager.hxx"
 #include "SALOME_Component_i.hxx"
 #include "SALOME_FileRef_i.hxx"
 #include "SALOME_FileTransfer_i.hxx"
@@ -57,6 +58,7 @@ int SIGUSR1 = 1000;
 #include "SALOME_Fake_NamingService.hxx"
 #include "SALOME_Embedded_NamingService_Client.hxx"
 #include "Basics_Utils.hxx"
+#include "Basics_DirUtils.hxx"
 
 #ifdef _XOPEN_SOURCE
 #undef _XOPEN_SOURCE
@@ -198,6 +200,19 @@ Abstract_Engines_Container_i::Abstract_Engines_Container_i (CORBA::ORB_ptr orb,
     _NS->Register(pCont, _containerName.c_str());
     MESSAGE("Engines_Container_i::Engines_Container_i : Container name " << _containerName);
 
+    // wake up the container manager waiting for this container, if any
+    try
+    {
+      CORBA::Object_var objCM = _NS->Resolve(SALOME_ContainerManager::_ContainerManagerNameInNS);
+      Engines::ContainerManager_var contManager = Engines::ContainerManager::_narrow(objCM);
+      if (!CORBA::is_nil(contManager))
+        contManager->ContainerRegistered(_containerName.c_str());
+    }
+    catch (...)
+    {
+      MESSAGE("Engines_Container_i::Engines_Container_i : container manager not notified");
+    }
+
     // Python: 
     // import SALOME_Container
     // pycont = SALOME_Container.SALOME_Container_i(containerIORStr)
@@ -291,6 +306,55 @@ char* Abstract_Engines_Container_i::workingdir()
   return CORBA::string_dup(wd) ;
 }
 
+//=============================================================================
+//! Rename a container started in advance by the container manager
+/*!
+*  CORBA method: the container is registered with its new name in the naming
+*  service and moves to workingdir ($TEMPDIR for a new temporary directory)
+*/
+//=============================================================================
+
+void Abstract_Engines_Container_i::adopt(const char* containerNameInNS, const char* workingdir)
+{
+  std::string wdir(workingdir);
+  if (wdir == "$TEMPDIR")
+    wdir = Kernel_Utils::GetTmpDir();
+
+  PyGILState_STATE gstate = PyGILState_Ensure();
+  PyObject *res = PyObject_CallMethod(_pyCont,
+    (char*)"adopt",
+    (char*)"ss",
+    containerNameInNS,
+    wdir.c_str());
+  if(res==NULL)
+  {
+    //internal error
+    PyErr_Print();
+    PyGILState_Release(gstate);
+    SALOME::ExceptionStruct es;
+    es.type = SALOME::INTERNAL_ERROR;
+    es.text = "can not adopt the container";
+    throw SALOME::SALOME_Exception(es);
+  }
+  long ierr=PyLong_AsLong(PyTuple_GetItem(res,0));
+  std::string astr=PyUnicode_AsUTF8(PyTuple_GetItem(res,1));
+  Py_DECREF(res);
+  PyGILState_Release(gstate);
+  if(ierr!=0)
+  {
+    SALOME::ExceptionStruct es;
+    es.type = SALOME::INTERNAL_ERROR;
+    es.text = astr.c_str();
+    throw SALOME::SALOME_Exception(es);
+  }
+
+  Engines::Container_var pCont = _this();
+  _NS->Destroy_Name(_containerName.c_str());
+  _containerName = containerNameInNS;
+  _NS->Register(pCont, _containerName.c_str());
+  MESSAGE("Engines_Container_i::adopt : Container name " << _containerName);
+}
+
 //=============================================================================
 //! Get container log file name
 /*! 
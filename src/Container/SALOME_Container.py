@@ -136,6 +136,18 @@ class SALOME_Container_i:
           l=traceback.format_exception(exc_typ,exc_val,exc_fr)
           return 1,"".join(l)
 
+    def adopt(self,containerName,workingdir):
+        try:
+          if workingdir:
+            os.makedirs(workingdir,exist_ok=True)
+            os.chdir(workingdir)
+          self._containerName = containerName
+          return 0,""
+        except:
+          exc_typ,exc_val,exc_fr=sys.exc_info()
+          l=traceback.format_exception(exc_typ,exc_val,exc_fr)
+          return 1,"".join(l)
+
     def create_pyscriptnode(self,nodeName,code):
         try:
           node=SALOME_PyNode.PyScriptNode_i(nodeName,code,self._poa,self)
@@ -39,6 +39,20 @@
 #include "Utils_CorbaException.hxx"
 #include <sstream>
 #include <string>
+#include <chrono>
+#include <algorithm>
+#include <thread>
+#include <cerrno>
+#include <cstring>
+#ifndef WIN32
+#include <spawn.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2,29)
+#define HAVE_POSIX_SPAWN_CHDIR
+#endif
+extern char **environ;
+#endif
 
 #include <SALOMEconfig.h>
 #include CORBA_CLIENT_HEADER(SALOME_Session)
@@ -64,6 +78,14 @@
 
 const int SALOME_ContainerManager::TIME_OUT_TO_LAUNCH_CONT=60;
 
+const int SALOME_ContainerManager::FIRST_POLLING_DELAY_MS=2;
+
+const int SALOME_ContainerManager::MAX_POLLING_DELAY_MS=500;
+
+const char *SALOME_ContainerManager::POOL_CONTAINER_NAME="WarmPoolContainer_";
+
+const int SALOME_ContainerManager::LOAD_SAMPLING_PERIOD=10;
+
 const char *SALOME_ContainerManager::_ContainerManagerNameInNS =
   "/ContainerManager";
 
@@ -73,6 +95,10 @@ Utils_Mutex SALOME_ContainerManager::_getenvMutex;
 
 Utils_Mutex SALOME_ContainerManager::_systemMutex;
 
+std::mutex SALOME_ContainerManager::_managersMutex;
+
+std::set<SALOME_ContainerManager *> SALOME_ContainerManager::_managers;
+
 //=============================================================================
 /*!
  *  Constructor
@@ -83,9 +109,14 @@ Utils_Mutex SALOME_ContainerManager::_systemMutex;
 //=============================================================================
 
 SALOME_ContainerManager::SALOME_ContainerManager(CORBA::ORB_ptr orb, PortableServer::POA_var poa, SALOME_NamingService_Abstract *ns)
-  : _nbprocUsed(1)
+  : _nbprocUsed(1), _poolSize(0), _poolLaunches(0), _poolNumber(0), _poolHits(0), _poolMisses(0),
+    _stopLoadSampling(false)
 {
   MESSAGE("constructor");
+  {
+    std::lock_guard<std::mutex> lock(_managersMutex);
+    _managers.insert(this);
+  }
   _NS = ns;
   _resManager = new SALOME_ResourcesManager_Client(ns);
 
@@ -104,6 +135,16 @@ SALOME_ContainerManager::SALOME_ContainerManager(CORBA::ORB_ptr orb, PortableSer
   if(_NS)
     _NS->Register(refContMan,_ContainerManagerNameInNS);
   _isAppliSalomeDefined = (GetenvThreadSafe("APPLI") != 0);
+  if (GetenvThreadSafe("SALOME_CONTAINER_POOL_SIZE") != 0)
+    {
+      std::istringstream ss(GetenvThreadSafeAsString("SALOME_CONTAINER_POOL_SIZE"));
+      if (!(ss >> _poolSize) || _poolSize < 0)
+        {
+          INFOS("SALOME_CONTAINER_POOL_SIZE should be a positive int");
+          _poolSize = 0;
+        }
+    }
+  _loadSampler = std::thread(&SALOME_ContainerManager::SampleLoads, this);
 
 #ifdef HAVE_MPI2
 #ifdef OPEN_MPI
@@ -164,6 +205,12 @@ SALOME_ContainerManager::SALOME_ContainerManager(CORBA::ORB_ptr orb, PortableSer
 SALOME_ContainerManager::~SALOME_ContainerManager()
 {
   MESSAGE("destructor");
+  StopLoadSampling();
+  WaitForPoolLaunches();
+  {
+    std::lock_guard<std::mutex> lock(_managersMutex);
+    _managers.erase(this);
+  }
   delete _resManager;
 #ifdef HAVE_MPI2
 #ifdef OPEN_MPI
@@ -194,6 +241,9 @@ SALOME_ContainerManager::~SALOME_ContainerManager()
 void SALOME_ContainerManager::Shutdown()
 {
   MESSAGE("Shutdown");
+  StopLoadSampling();
+  SetPoolSize(0);
+  WaitForPoolLaunches();
   ShutdownContainers();
   if(_NS)
     _NS->Destroy_Name(_ContainerManagerNameInNS);
@@ -212,6 +262,11 @@ void SALOME_ContainerManager::ShutdownContainers()
   MESSAGE("ShutdownContainers");
   if(!_NS)
     return ;
+  {
+    // the containers of the pool are shut down with the others
+    std::lock_guard<std::mutex> lock(_poolMutex);
+    _pool.clear();
+  }
   SALOME::Session_var session = SALOME::Session::_nil();
   CORBA::Long pid = 0;
   CORBA::Object_var objS = _NS->Resolve("/Kernel/Session");
@@ -294,7 +349,7 @@ Engines::Container_ptr SALOME_ContainerManager::GiveContainer(const Engines::Con
   if (std::string(local_params.mode.in()) == "")
     local_params.mode = CORBA::string_dup("start");
   std::string mode = local_params.mode.in();
-  MESSAGE("[GiveContainer] starting with mode: " << mode);
+  BMESSAGE("[GiveContainer] starting with mode: {}", mode);
 
   // Step 1: Find Container for find and findorstart mode
   if (mode == "find" || mode == "findorstart")
@@ -306,7 +361,7 @@ Engines::Container_ptr SALOME_ContainerManager::GiveContainer(const Engines::Con
     {
       if (mode == "find")
       {
-        MESSAGE("[GiveContainer] no container found");
+        BMESSAGE("[GiveContainer] no container found");
         return ret;
       }
       else
@@ -321,7 +376,7 @@ Engines::Container_ptr SALOME_ContainerManager::GiveContainer(const Engines::Con
   resourceParams resource_params = resourceParameters_CORBAtoCPP(local_params.resource_params);
   resource_params.can_run_containers = true;
   std::vector<std::string> possibleResources = _resManager->GetFittingResources(resource_params);
-  MESSAGE("[GiveContainer] - length of possible resources " << possibleResources.size());
+  BMESSAGE("[GiveContainer] - length of possible resources {}", possibleResources.size());
   std::vector<std::string> local_resources;
 
   // Step 3: if mode is "get" keep only machines with existing containers
@@ -341,7 +396,7 @@ Engines::Container_ptr SALOME_ContainerManager::GiveContainer(const Engines::Con
     // if local_resources is empty, we cannot give a container
     if (local_resources.size() == 0)
     {
-      MESSAGE("[GiveContainer] cannot find a container for mode get");
+      BMESSAGE("[GiveContainer] cannot find a container for mode get");
       return ret;
     }
   }
@@ -360,7 +415,7 @@ Engines::Container_ptr SALOME_ContainerManager::GiveContainer(const Engines::Con
     {
       try
       {
-        resource_selected = _resManager->Find(params.resource_params.policy.in(), resources);
+        resource_selected = _resManager->Find(params.resource_params.policy.in(), resources, resource_params);
         // Remove resource_selected from vector
         std::vector<std::string>::iterator it;
         for (it=resources.begin() ; it < resources.end(); it++ )
@@ -375,7 +430,7 @@ Engines::Container_ptr SALOME_ContainerManager::GiveContainer(const Engines::Con
         MESSAGE("[GiveContainer] Exception in ResourceManager find !: " << ex.what());
         return ret;
       }
-      MESSAGE("[GiveContainer] Resource selected is: " << resource_selected);
+      BMESSAGE("[GiveContainer] Resource selected is: {}", resource_selected);
 
       // Step 5: Create container name
       ParserResourcesType resource_definition = _resManager->GetResourceDefinition(resource_selected);
@@ -401,9 +456,24 @@ Engines::Container_ptr SALOME_ContainerManager::GiveContainer(const Engines::Con
       }
       else
         containerNameInNS = _NS->BuildContainerNameForNS(params, hostname.c_str());
-      MESSAGE("[GiveContainer] Container name in the naming service: " << containerNameInNS);
+      BMESSAGE("[GiveContainer] Container name in the naming service: {}", containerNameInNS);
+
+      // Step 6: if the same container is already being launched by another request, use it
+      {
+        Engines::Container_var cont;
+        if (!BeginLaunch(containerNameInNS, cont))
+        {
+          if (!CORBA::is_nil(cont))
+          {
+            BTRACE("[GiveContainer] container {} launched by a concurrent request", containerNameInNS);
+            return cont._retn();
+          }
+          BTRACE("[GiveContainer] concurrent launch of {} failed", containerNameInNS);
+          continue;
+        }
+      }
 
-      // Step 6: check if the name exists in naming service
+      // Step 7: check if the name exists in naming service
       //if params.mode == "getorstart" or "get" use the existing container
       //if params.mode == "start" shutdown the existing container before launching a new one with that name
 
@@ -418,6 +488,7 @@ Engines::Container_ptr SALOME_ContainerManager::GiveContainer(const Engines::Con
                 if(!cont->_non_existent())
                   {
                     if(std::string(params.mode.in())=="getorstart" || std::string(params.mode.in())=="get"){
+                        EndLaunch(containerNameInNS, cont);
                         return cont._retn(); /* the container exists and params.mode is getorstart or get use it*/
                     }
                     else
@@ -433,15 +504,26 @@ Engines::Container_ptr SALOME_ContainerManager::GiveContainer(const Engines::Con
             }
           }
       } // end critical section
-      Engines::Container_var cont = LaunchContainer(params, resource_selected, hostname, machFile, containerNameInNS);
+      Engines::Container_var cont;
+      try
+      {
+        cont = LaunchContainer(params, resource_selected, hostname, machFile, containerNameInNS);
+      }
+      catch(...)
+      {
+        EndLaunch(containerNameInNS, Engines::Container::_nil());
+        throw;
+      }
+      EndLaunch(containerNameInNS, cont);
       if (!CORBA::is_nil(cont))
       {
-        INFOS("[GiveContainer] container " << containerNameInNS << " launched");
+        BTRACE("[GiveContainer] container {} launched", containerNameInNS);
+        AddLaunchedContainer(resource_selected, containerNameInNS);
         return cont._retn();
       }
       else
       {
-        INFOS("[GiveContainer] Failed to launch container on resource " << resource_selected);
+        BTRACE("[GiveContainer] Failed to launch container on resource {}", resource_selected);
       }
     }
   }
@@ -471,19 +553,21 @@ SALOME_ContainerManager::LaunchContainer(const Engines::ContainerParameters& par
                                          const std::string & resource_selected,
                                          const std::string & hostname,
                                          const std::string & machFile,
-                                         const std::string & containerNameInNS)
+                                         const std::string & containerNameInNS,
+                                         bool useWarmPool)
 {
   std::string user,command,logFilename,tmpFileName;
+  std::vector<std::string> argv;
   int status;
   Engines::Container_ptr ret(Engines::Container::_nil());
+  std::string container_exe = this->GetCppBinaryOfKernelContainer();
+  Engines::ContainerParameters local_params(params);
   {//start of critical section
     Utils_Locker lock (&_giveContainerMutex1);
     // Step 1: type of container: PaCO, Exe, Mpi or Classic
     // Mpi already tested in step 5, specific code on BuildCommandToLaunch Local/Remote Container methods
     // TODO -> separates Mpi from Classic/Exe
     // Classic or Exe ?
-    std::string container_exe = this->GetCppBinaryOfKernelContainer();
-    Engines::ContainerParameters local_params(params);
     int found=0;
     try
     {
@@ -529,7 +613,19 @@ SALOME_ContainerManager::LaunchContainer(const Engines::ContainerParameters& par
         INFOS("Caught unknown exception.");
         return ret;
     }
+  }//end of critical section
+
+  // A generic container is taken from the warm pool if there is one
+  if (useWarmPool && container_exe == this->GetCppBinaryOfKernelContainer() &&
+      !params.isMPI && std::string(local_params.parallelLib.in()) == "")
+    {
+      ret = TakeFromPool(resource_selected, hostname, containerNameInNS, params);
+      if (!CORBA::is_nil(ret))
+        return ret;
+    }
 
+  {//start of critical section
+    Utils_Locker lock (&_giveContainerMutex1);
     // Step 2: test resource
     // Only if an application directory is set
     if(hostname != Kernel_Utils::GetHostname() && _isAppliSalomeDefined)
@@ -564,13 +660,19 @@ SALOME_ContainerManager::LaunchContainer(const Engines::ContainerParameters& par
         return ret;
       }
     // Other type of containers...
-    MESSAGE("[GiveContainer] Try to launch a new container on " << resource_selected);
+    BMESSAGE("[GiveContainer] Try to launch a new container on {}", resource_selected);
     // if a parallel container is launched in batch job, command is: "mpirun -np nbproc -machinefile nodesfile SALOME_MPIContainer"
     if( GetenvThreadSafe("LIBBATCH_NODEFILE") != NULL && params.isMPI )
       command = BuildCommandToLaunchLocalContainer(params, machFile, container_exe, tmpFileName);
-    // if a container is launched on localhost, command is "SALOME_Container" or "mpirun -np nbproc SALOME_MPIContainer"
+    // if a container is launched on localhost, command is "SALOME_Container" or "mpirun -np nbproc SALOME_MPIContainer",
+    // a (not MPI) container is spawned directly without shell when possible
     else if(hostname == Kernel_Utils::GetHostname())
-      command = BuildCommandToLaunchLocalContainer(params, machFile, container_exe, tmpFileName);
+      {
+        if(!params.isMPI)
+          argv = BuildArgvToLaunchLocalContainer(params, container_exe);
+        if(argv.empty())
+          command = BuildCommandToLaunchLocalContainer(params, machFile, container_exe, tmpFileName);
+      }
     // if a container is launched in remote mode, command is "ssh resource_selected SALOME_Container" or "ssh resource_selected mpirun -np nbproc SALOME_MPIContainer"
     else
       command = BuildCommandToLaunchRemoteContainer(resource_selected, params, container_exe);
@@ -601,38 +703,50 @@ SALOME_ContainerManager::LaunchContainer(const Engines::ContainerParameters& par
     tmp << "_" << getpid();
     logFilename += tmp.str();
     logFilename += ".log" ;
-    command += " > " + logFilename + " 2>&1";
-    MakeTheCommandToBeLaunchedASync(command);
+    if(argv.empty())
+      {
+        command += " > " + logFilename + " 2>&1";
+        MakeTheCommandToBeLaunchedASync(command);
+      }
+  }//end of critical of section
 
-    // launch container with a system call
+  // launch container, the container may register before the launch returns
+  ExpectContainer(containerNameInNS);
+  if(!argv.empty())
+    {
+      for(std::size_t i=0; i < argv.size(); i++)
+        command += (i ? " " : "") + argv[i];
+      std::string wdir(params.workingdir.in());
+      if(wdir == "$TEMPDIR")
+        wdir = Kernel_Utils::GetTmpDir();
+      long pid = SpawnWithPIDThreadSafe(argv, logFilename, wdir);
+      status = pid > 0 ? 0 : -1;
+      if(pid > 0)
+        WatchContainerProcess(pid, containerNameInNS);
+    }
+  else
     status=SystemThreadSafe(command.c_str());
-  }//end of critical of section
 
   if (status == -1)
     {
       INFOS("[LaunchContainer] command failed (system command status -1): " << command);
       RmTmpFile(tmpFileName); // command file can be removed here
+      std::lock_guard<std::mutex> lock(_expectedContainersMutex);
+      _expectedContainers.erase(containerNameInNS);
       return Engines::Container::_nil();
     }
   else if (status == 217)
     {
       INFOS("[LaunchContainer] command failed (system command status 217): " << command);
       RmTmpFile(tmpFileName); // command file can be removed here
+      std::lock_guard<std::mutex> lock(_expectedContainersMutex);
+      _expectedContainers.erase(containerNameInNS);
       return Engines::Container::_nil();
     }
   else
     {
       // Step 4: Wait for the container
-      int count(GetTimeOutToLoaunchServer());
-      INFOS("[GiveContainer] waiting " << count << " second steps container " << containerNameInNS);
-      while (CORBA::is_nil(ret) && count)
-        {
-          SleepInSecond(1);
-          count--;
-          MESSAGE("[GiveContainer] step " << count << " Waiting for container on " << resource_selected);
-          CORBA::Object_var obj(_NS->Resolve(containerNameInNS.c_str()));
-          ret=Engines::Container::_narrow(obj);
-        }
+      ret = WaitForContainer(containerNameInNS, resource_selected);
       if (CORBA::is_nil(ret))
         {
           INFOS("[GiveContainer] was not able to launch container " << containerNameInNS);
@@ -650,6 +764,488 @@ SALOME_ContainerManager::LaunchContainer(const Engines::ContainerParameters& par
   return ret;
 }
 
+//=============================================================================
+//! Declare that a container is being launched with the name containerNameInNS
+/*! WaitForContainer is woken up as soon as ContainerRegistered is called for it
+ */
+//=============================================================================
+void SALOME_ContainerManager::ExpectContainer(const std::string& containerNameInNS)
+{
+  std::lock_guard<std::mutex> lock(_expectedContainersMutex);
+  _expectedContainers[containerNameInNS] = ExpectedContainer();
+}
+
+//=============================================================================
+//! Wait for a launched container to be registered in the naming service
+/*! The naming service is polled with an exponential backoff, starting at
+ *  FIRST_POLLING_DELAY_MS, in case the container cannot call ContainerRegistered.
+ *  Before ContainerRegistered, the container found under the name is only taken
+ *  if it runs in the spawned process or, when the pid is unknown, if it is alive.
+ *  \param containerNameInNS the name given to the container by ExpectContainer
+ *  \param resource_selected the resource the container is launched on, for the traces
+ *  \return the container, or nil after GetTimeOutToLoaunchServer() seconds or as soon
+ *          as its process has exited
+ */
+//=============================================================================
+Engines::Container_ptr
+SALOME_ContainerManager::WaitForContainer(const std::string& containerNameInNS,
+                                          const std::string& resource_selected)
+{
+  Engines::Container_var ret;
+  int timeout(GetTimeOutToLoaunchServer());
+  BTRACE("[GiveContainer] waiting at most {} seconds for container {}", timeout, containerNameInNS);
+  std::chrono::steady_clock::time_point end(std::chrono::steady_clock::now() + std::chrono::seconds(timeout));
+  std::chrono::milliseconds delay(FIRST_POLLING_DELAY_MS);
+
+  std::unique_lock<std::mutex> lock(_expectedContainersMutex);
+  while (true)
+    {
+      std::map<std::string, ExpectedContainer>::const_iterator it = _expectedContainers.find(containerNameInNS);
+      ExpectedContainer expected(it != _expectedContainers.end() ? it->second : ExpectedContainer());
+      lock.unlock();
+      CORBA::Object_var obj(_NS->Resolve(containerNameInNS.c_str()));
+      ret = Engines::Container::_narrow(obj);
+      // until the launched container has called ContainerRegistered, the name may still
+      // be bound to the container shut down in Step 7 of GiveContainer
+      if (!CORBA::is_nil(ret) && expected.state != REGISTERED)
+        {
+          try
+            {
+              if (expected.pid ? ret->getPID() != expected.pid : ret->_non_existent())
+                ret = Engines::Container::_nil();
+            }
+          catch (const CORBA::Exception&)
+            {
+              ret = Engines::Container::_nil();
+            }
+        }
+      lock.lock();
+      std::chrono::steady_clock::time_point now(std::chrono::steady_clock::now());
+      if (!CORBA::is_nil(ret) || now >= end)
+        break;
+      it = _expectedContainers.find(containerNameInNS);
+      if (it != _expectedContainers.end() && it->second.state == EXITED)
+        {
+          INFOS("[GiveContainer] container " << containerNameInNS << " exited before its registration");
+          break;
+        }
+      BMESSAGE("[GiveContainer] Waiting {} ms for container on {}", delay.count(), resource_selected);
+      _expectedContainersCondition.wait_until(lock, std::min(now + delay, end), [&]()
+        {
+          std::map<std::string, ExpectedContainer>::const_iterator it = _expectedContainers.find(containerNameInNS);
+          return it != _expectedContainers.end() && it->second.state != LAUNCHING;
+        });
+      delay = std::min(2 * delay, std::chrono::milliseconds(MAX_POLLING_DELAY_MS));
+    }
+  _expectedContainers.erase(containerNameInNS);
+  return ret._retn();
+}
+
+//=============================================================================
+//! Register the calling request as the one launching containerNameInNS
+/*! If another request is already launching this container, wait for the end
+ *  of its launch instead.
+ *  \param cont the container launched by the other request, nil if it failed
+ *  \return true if the caller must launch the container and then call EndLaunch
+ */
+//=============================================================================
+bool SALOME_ContainerManager::BeginLaunch(const std::string& containerNameInNS,
+                                          Engines::Container_var& cont)
+{
+  std::unique_lock<std::mutex> lock(_expectedContainersMutex);
+  std::map<std::string, std::shared_ptr<LaunchInProgress> >::iterator it = _launchesInProgress.find(containerNameInNS);
+  if (it == _launchesInProgress.end())
+    {
+      _launchesInProgress[containerNameInNS] = std::make_shared<LaunchInProgress>();
+      return true;
+    }
+  std::shared_ptr<LaunchInProgress> launch(it->second);
+  _expectedContainersCondition.wait(lock, [&launch]() { return launch->done; });
+  cont = Engines::Container::_duplicate(launch->container);
+  return false;
+}
+
+//=============================================================================
+//! End the launch registered by BeginLaunch and wake up the waiting requests
+//=============================================================================
+void SALOME_ContainerManager::EndLaunch(const std::string& containerNameInNS,
+                                        Engines::Container_ptr cont)
+{
+  std::lock_guard<std::mutex> lock(_expectedContainersMutex);
+  std::map<std::string, std::shared_ptr<LaunchInProgress> >::iterator it = _launchesInProgress.find(containerNameInNS);
+  if (it != _launchesInProgress.end())
+    {
+      it->second->container = Engines::Container::_duplicate(cont);
+      it->second->done = true;
+      _launchesInProgress.erase(it);
+      _expectedContainersCondition.notify_all();
+    }
+}
+
+//=============================================================================
+//! Called by a container when it is registered in the naming service
+/*! CORBA method, oneway
+ */
+//=============================================================================
+void SALOME_ContainerManager::ContainerRegistered(const char* containerNameInNS)
+{
+  std::lock_guard<std::mutex> lock(_expectedContainersMutex);
+  std::map<std::string, ExpectedContainer>::iterator it = _expectedContainers.find(containerNameInNS);
+  if (it != _expectedContainers.end())
+    {
+      it->second.state = REGISTERED;
+      _expectedContainersCondition.notify_all();
+    }
+}
+
+//=============================================================================
+//! Reap in background the process of a container launched by this manager
+/*! If the process ends while the container is expected, WaitForContainer
+ *  returns at once instead of waiting for the launch timeout. pid is stored
+ *  with the expected container before the reaper is started.
+ */
+//=============================================================================
+void SALOME_ContainerManager::WatchContainerProcess(long pid, const std::string& containerNameInNS)
+{
+#ifndef WIN32
+  {
+    std::lock_guard<std::mutex> lock(_expectedContainersMutex);
+    std::map<std::string, ExpectedContainer>::iterator it = _expectedContainers.find(containerNameInNS);
+    if (it != _expectedContainers.end())
+      it->second.pid = pid;
+  }
+  SALOME_ContainerManager *manager(this);
+  std::thread([manager, pid, containerNameInNS]()
+    {
+      int status(0);
+      pid_t ret;
+      while ((ret = waitpid((pid_t)pid, &status, 0)) < 0 && errno == EINTR) {}
+      if (ret != (pid_t)pid)
+        return; // already reaped elsewhere (ECHILD): its status is unknown
+      std::lock_guard<std::mutex> lock(_managersMutex);
+      if (_managers.find(manager) != _managers.end())
+        manager->ContainerExited(containerNameInNS, pid, status);
+    }).detach();
+#endif
+}
+
+//=============================================================================
+//! Called when the process pid of a launched container has ended
+/*! Ignored if containerNameInNS has been launched again by another process
+ *  in the meantime.
+ */
+//=============================================================================
+void SALOME_ContainerManager::ContainerExited(const std::string& containerNameInNS, long pid, int status)
+{
+  std::lock_guard<std::mutex> lock(_expectedContainersMutex);
+  std::map<std::string, ExpectedContainer>::iterator it = _expectedContainers.find(containerNameInNS);
+  if (it != _expectedContainers.end() && it->second.state == LAUNCHING && it->second.pid == pid)
+    {
+#ifndef WIN32
+      if (WIFEXITED(status))
+        INFOS("[LaunchContainer] container " << containerNameInNS << " exited during its startup with status " << WEXITSTATUS(status));
+      else if (WIFSIGNALED(status))
+        INFOS("[LaunchContainer] container " << containerNameInNS << " killed during its startup by signal " << WTERMSIG(status));
+#endif
+      it->second.state = EXITED;
+      _expectedContainersCondition.notify_all();
+    }
+}
+
+//=============================================================================
+//! Set the number of idle containers kept started on each resource
+/*! CORBA method: containers in excess are shut down, the pool of a resource
+ *  is filled again the next time a container is started on it
+ */
+//=============================================================================
+void SALOME_ContainerManager::SetPoolSize(CORBA::Long poolSize)
+{
+  std::list<std::string> excess;
+  {
+    std::lock_guard<std::mutex> lock(_poolMutex);
+    _poolSize = poolSize < 0 ? 0 : poolSize;
+    std::map<std::string, std::list<std::string> >::iterator it;
+    for (it = _pool.begin(); it != _pool.end(); it++)
+      while ((int)it->second.size() > _poolSize)
+        {
+          excess.push_back(it->second.back());
+          it->second.pop_back();
+        }
+  }
+  for (std::list<std::string>::iterator it = excess.begin(); it != excess.end(); it++)
+    {
+      try
+        {
+          CORBA::Object_var obj = _NS->Resolve((*it).c_str());
+          Engines::Container_var cont = Engines::Container::_narrow(obj);
+          if (!CORBA::is_nil(cont))
+            cont->Shutdown();
+        }
+      catch(const CORBA::Exception&)
+        {
+          INFOS("[SetPoolSize] CORBA::Exception ignored when shutting down " << *it);
+        }
+    }
+}
+
+CORBA::Long SALOME_ContainerManager::GetPoolSize()
+{
+  std::lock_guard<std::mutex> lock(_poolMutex);
+  return _poolSize;
+}
+
+CORBA::LongLong SALOME_ContainerManager::GetPoolHits()
+{
+  std::lock_guard<std::mutex> lock(_poolMutex);
+  return _poolHits;
+}
+
+CORBA::LongLong SALOME_ContainerManager::GetPoolMisses()
+{
+  std::lock_guard<std::mutex> lock(_poolMutex);
+  return _poolMisses;
+}
+
+//=============================================================================
+//! Take an idle container of the pool of a resource and give it its final name
+/*! The pool is then filled again asynchronously.
+ *  \return the container or nil if the pool is disabled or empty
+ */
+//=============================================================================
+Engines::Container_ptr
+SALOME_ContainerManager::TakeFromPool(const std::string& resource_selected,
+                                      const std::string& hostname,
+                                      const std::string& containerNameInNS,
+                                      const Engines::ContainerParameters& params)
+{
+  Engines::Container_var cont;
+  while (CORBA::is_nil(cont))
+    {
+      std::string poolName;
+      {
+        std::lock_guard<std::mutex> lock(_poolMutex);
+        if (_poolSize == 0)
+          return Engines::Container::_nil();
+        std::list<std::string>& idle(_pool[resource_selected]);
+        if (idle.empty())
+          {
+            _poolMisses++;
+            break;
+          }
+        poolName = idle.front();
+        idle.pop_front();
+      }
+      try
+        {
+          CORBA::Object_var obj = _NS->Resolve(poolName.c_str());
+          cont = Engines::Container::_narrow(obj);
+          if (!CORBA::is_nil(cont))
+            cont->adopt(containerNameInNS.c_str(), params.workingdir.in());
+        }
+      catch(const SALOME::SALOME_Exception& ex)
+        {
+          INFOS("[TakeFromPool] container " << poolName << " cannot be adopted: " << ex.details.text.in());
+          try { cont->Shutdown(); } catch(const CORBA::Exception&) {}
+          cont = Engines::Container::_nil();
+        }
+      catch(const CORBA::Exception&)
+        {
+          INFOS("[TakeFromPool] container " << poolName << " of the pool is not reachable");
+          cont = Engines::Container::_nil();
+        }
+    }
+  if (!CORBA::is_nil(cont))
+    {
+      BTRACE("[GiveContainer] container {} taken from the pool of {}", containerNameInNS, resource_selected);
+      std::lock_guard<std::mutex> lock(_poolMutex);
+      _poolHits++;
+    }
+  RefillPool(resource_selected, hostname);
+  return cont._retn();
+}
+
+//=============================================================================
+//! Start in background the containers missing in the pool of a resource
+//=============================================================================
+void SALOME_ContainerManager::RefillPool(const std::string& resource_selected,
+                                         const std::string& hostname)
+{
+  std::lock_guard<std::mutex> lock(_poolMutex);
+  int missing = _poolSize - (int)_pool[resource_selected].size() - _poolLaunching[resource_selected];
+  for (int i = 0; i < missing; i++)
+    {
+      _poolLaunching[resource_selected]++;
+      _poolLaunches++;
+      std::thread(&SALOME_ContainerManager::LaunchPoolContainer, this, resource_selected, hostname).detach();
+    }
+}
+
+//=============================================================================
+//! Start a generic container and add it to the pool of a resource
+//=============================================================================
+void SALOME_ContainerManager::LaunchPoolContainer(const std::string resource_selected,
+                                                  const std::string hostname)
+{
+  Engines::ContainerParameters params;
+  params.mode = "start";
+  params.nb_proc = 0;
+  params.isMPI = false;
+  {
+    std::lock_guard<std::mutex> lock(_poolMutex);
+    std::ostringstream name;
+    name << POOL_CONTAINER_NAME << ++_poolNumber;
+    params.container_name = name.str().c_str();
+  }
+  std::string containerNameInNS(_NS->BuildContainerNameForNS(params, hostname.c_str()));
+  Engines::Container_var cont;
+  try
+    {
+      cont = LaunchContainer(params, resource_selected, hostname, "", containerNameInNS, false);
+    }
+  catch(...)
+    {
+      INFOS("[LaunchPoolContainer] exception ignored when launching " << containerNameInNS);
+    }
+
+  bool kept(false);
+  {
+    std::lock_guard<std::mutex> lock(_poolMutex);
+    // the pool may have been reduced during the launch
+    std::list<std::string>& idle(_pool[resource_selected]);
+    if (!CORBA::is_nil(cont) && (int)idle.size() < _poolSize)
+      {
+        idle.push_back(containerNameInNS);
+        kept = true;
+      }
+  }
+  if (!CORBA::is_nil(cont) && !kept)
+    {
+      try
+        {
+          cont->Shutdown();
+        }
+      catch(const CORBA::Exception&)
+        {
+          INFOS("[LaunchPoolContainer] CORBA::Exception ignored when shutting down " << containerNameInNS);
+        }
+    }
+
+  std::lock_guard<std::mutex> lock(_poolMutex);
+  _poolLaunching[resource_selected]--;
+  _poolLaunches--;
+  _poolCondition.notify_all();
+}
+
+//=============================================================================
+//! Wait for the end of the launches started to fill the pools
+//=============================================================================
+void SALOME_ContainerManager::WaitForPoolLaunches()
+{
+  std::unique_lock<std::mutex> lock(_poolMutex);
+  _poolCondition.wait(lock, [this]() { return _poolLaunches == 0; });
+}
+
+//=============================================================================
+//! Record a container launched on a resource, its load is sampled with the others
+//=============================================================================
+void SALOME_ContainerManager::AddLaunchedContainer(const std::string& resource_selected,
+                                                   const std::string& containerNameInNS)
+{
+  std::lock_guard<std::mutex> lock(_loadMutex);
+  _launchedContainers[resource_selected].insert(containerNameInNS);
+}
+
+//=============================================================================
+//! Loop of the thread sampling the load of the resources
+/*!
+ *  Every LOAD_SAMPLING_PERIOD seconds, the free cores and the free memory of
+ *  each resource where a container has been launched are asked to one of its
+ *  containers and given to the resources manager for its "best" policy.
+ *  The containers which do not exist any more are forgotten.
+ */
+//=============================================================================
+void SALOME_ContainerManager::SampleLoads()
+{
+  std::unique_lock<std::mutex> lock(_loadMutex);
+  while (!_loadCondition.wait_for(lock, std::chrono::seconds(LOAD_SAMPLING_PERIOD),
+                                  [this]() { return _stopLoadSampling; }))
+    {
+      std::map<std::string, std::set<std::string> > launchedContainers(_launchedContainers);
+      lock.unlock();
+      std::map<std::string, std::set<std::string> > deadContainers;
+      for (std::map<std::string, std::set<std::string> >::const_iterator it = launchedContainers.begin();
+           it != launchedContainers.end(); it++)
+        {
+          bool hasLiveContainer = false;
+          for (std::set<std::string>::const_iterator itName = it->second.begin(); itName != it->second.end(); itName++)
+            {
+              try
+                {
+                  CORBA::Object_var obj = _NS ? _NS->Resolve((*itName).c_str()) : CORBA::Object::_nil();
+                  Engines::Container_var cont = Engines::Container::_narrow(obj);
+                  if (CORBA::is_nil(cont) || cont->_non_existent())
+                    {
+                      deadContainers[it->first].insert(*itName);
+                      continue;
+                    }
+                  hasLiveContainer = true;
+                  Engines::vectorOfDouble_var loads = cont->loadOfCPUCores();
+                  double nbFreeCores = 0.;
+                  for (CORBA::ULong i = 0; i < loads->length(); i++)
+                    nbFreeCores += 1. - loads[i];
+                  long freeMem = cont->getTotalPhysicalMemory() - cont->getTotalPhysicalMemoryInUse();
+                  _resManager->SetLoadOfResource(it->first, nbFreeCores, freeMem);
+                  break;
+                }
+              catch (const SALOME::SALOME_Exception& ex)
+                {
+                  INFOS("[SampleLoads] cannot get the load of " << *itName << ": " << ex.details.text.in());
+                }
+              catch (const CORBA::Exception&)
+                {
+                  deadContainers[it->first].insert(*itName);
+                }
+            }
+          // no container left to sample: forget the last load, the resource is free again as in its description
+          if (!hasLiveContainer)
+            {
+              try
+                {
+                  _resManager->ClearLoadOfResource(it->first);
+                }
+              catch (const CORBA::Exception&)
+                {
+                  INFOS("[SampleLoads] cannot clear the load of " << it->first);
+                }
+            }
+        }
+      lock.lock();
+      for (std::map<std::string, std::set<std::string> >::const_iterator it = deadContainers.begin();
+           it != deadContainers.end(); it++)
+        {
+          std::set<std::string>& names = _launchedContainers[it->first];
+          for (std::set<std::string>::const_iterator itName = it->second.begin(); itName != it->second.end(); itName++)
+            names.erase(*itName);
+          if (names.empty())
+            _launchedContainers.erase(it->first);
+        }
+    }
+}
+
+//=============================================================================
+//! Stop the thread sampling the load of the resources
+//=============================================================================
+void SALOME_ContainerManager::StopLoadSampling()
+{
+  {
+    std::lock_guard<std::mutex> lock(_loadMutex);
+    _stopLoadSampling = true;
+  }
+  _loadCondition.notify_all();
+  if (_loadSampler.joinable())
+    _loadSampler.join();
+}
+
 //=============================================================================
 //! Find a container given constraints (params) on a list of machines (possibleComputers)
 //! agy : this method is ThreadSafe
@@ -660,14 +1256,14 @@ SALOME_ContainerManager::LaunchContainer(const Engines::ContainerParameters& par
 
 Engines::Container_ptr SALOME_ContainerManager::FindContainer(const Engines::ContainerParameters& params, const Engines::ResourceList& possibleResources)
 {
-  MESSAGE("[FindContainer] FindContainer on " << possibleResources.length() << " resources");
+  BMESSAGE("[FindContainer] FindContainer on {} resources", possibleResources.length());
   for(unsigned int i=0; i < possibleResources.length();i++)
     {
       Engines::Container_ptr cont = FindContainer(params, possibleResources[i].in());
       if(!CORBA::is_nil(cont))
         return cont;
     }
-  MESSAGE("[FindContainer] no container found");
+  BMESSAGE("[FindContainer] no container found");
   return Engines::Container::_nil();
 }
 
@@ -685,7 +1281,7 @@ SALOME_ContainerManager::FindContainer(const Engines::ContainerParameters& param
   ParserResourcesType resource_definition = _resManager->GetResourceDefinition(resource);
   std::string hostname(resource_definition.HostName);
   std::string containerNameInNS(_NS->BuildContainerNameForNS(params, hostname.c_str()));
-  MESSAGE("[FindContainer] Try to find a container  " << containerNameInNS << " on resource " << resource);
+  BMESSAGE("[FindContainer] Try to find a container  {} on resource {}", containerNameInNS, resource);
   CORBA::Object_var obj = _NS->Resolve(containerNameInNS.c_str());
   try
   {
@@ -909,6 +1505,44 @@ std::string SALOME_ContainerManager::BuildCommandToLaunchLocalContainer(const En
 }
 
 
+//=============================================================================
+/*!
+ *  builds the arguments to spawn a local (not MPI) container without a shell.
+ *  Returns an empty vector if the container cannot be spawned directly.
+ */
+//=============================================================================
+std::vector<std::string> SALOME_ContainerManager::BuildArgvToLaunchLocalContainer(const Engines::ContainerParameters& params, const std::string& container_exe) const
+{
+  std::vector<std::string> argv;
+#ifndef WIN32
+#ifndef HAVE_POSIX_SPAWN_CHDIR
+  // the working directory is changed by the shell
+  if (std::string(params.workingdir.in()) != "")
+    return argv;
+#endif
+  argv.push_back(container_exe);
+  argv.push_back(_NS->ContainerName(params));
+  if( this->_isSSL )
+  {
+    Engines::EmbeddedNamingService_var ns = GetEmbeddedNamingService();
+    CORBA::String_var iorNS = _orb->object_to_string(ns);
+    argv.push_back(iorNS.in());
+  }
+  else
+  {
+    // same arguments as the command file of BuildCommandToLaunchLocalContainer
+    std::ostringstream o;
+    o << "-";
+    AddOmninamesParams(o);
+    std::istringstream args(o.str());
+    std::string arg;
+    while (args >> arg)
+      argv.push_back(arg);
+  }
+#endif
+  return argv;
+}
+
 //=============================================================================
 /*!
  *  removes the generated temporary file in case of a remote launch.
@@ -1455,6 +2089,58 @@ long SALOME_ContainerManager::SystemWithPIDThreadSafe(const std::vector<std::str
     }
 }
 
+/*!
+ * Start command[0] with posix_spawn, without shell, with stdout and stderr
+ * redirected to logFilename, in workingDir (created if needed) if not empty.
+ * \return the pid of the new process, -1 in case of failure
+ */
+long SALOME_ContainerManager::SpawnWithPIDThreadSafe(const std::vector<std::string>& command,
+                                                     const std::string& logFilename,
+                                                     const std::string& workingDir)
+{
+#ifndef WIN32
+  if(command.size()<1)
+    throw SALOME_Exception("SpawnWithPIDThreadSafe : command is expected to have a length of size 1 at least !");
+  // mkdir -p workingDir
+  for(std::size_t pos = workingDir.find('/', 1); !workingDir.empty(); pos = workingDir.find('/', pos + 1))
+    {
+      std::string dir(workingDir.substr(0, pos));
+      if (mkdir(dir.c_str(), 0777) != 0 && errno != EEXIST)
+        {
+          INFOS("SpawnWithPIDThreadSafe : cannot create directory " << dir);
+          return -1;
+        }
+      if (pos == std::string::npos)
+        break;
+    }
+
+  std::vector<char *> args;
+  for(std::size_t i=0; i < command.size(); i++)
+    args.push_back(const_cast<char *>(command[i].c_str()));
+  args.push_back(nullptr);
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, logFilename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+#ifdef HAVE_POSIX_SPAWN_CHDIR
+  if (!workingDir.empty())
+    posix_spawn_file_actions_addchdir_np(&actions, workingDir.c_str());
+#endif
+  pid_t pid;
+  int err = posix_spawnp(&pid, args[0], &actions, nullptr, &args[0], environ);
+  posix_spawn_file_actions_destroy(&actions);
+  if (err != 0)
+    {
+      INFOS("SpawnWithPIDThreadSafe : cannot launch " << command[0] << ": " << strerror(err));
+      return -1;
+    }
+  return pid;
+#else
+  throw SALOME_Exception("SpawnWithPIDThreadSafe : not implemented on Windows");
+#endif
+}
+
 #ifdef WITH_PACO_PARALLEL
 
 //=============================================================================
@@ -34,6 +34,13 @@
 
 #include <string>
 #include <set>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <list>
+#include <thread>
 
 class SALOME_NamingService_Abstract;
 class SALOME_ResourcesManager_Client;
@@ -50,6 +57,16 @@ public:
 
   void ShutdownContainers();
 
+  void ContainerRegistered(const char* containerNameInNS);
+
+  void SetPoolSize(CORBA::Long poolSize);
+
+  CORBA::Long GetPoolSize();
+
+  CORBA::LongLong GetPoolHits();
+
+  CORBA::LongLong GetPoolMisses();
+
   // C++ Methods
   void Shutdown();
 
@@ -83,6 +100,9 @@ protected:
   std::string BuildTempFileToLaunchRemoteContainer(const std::string& resource_name,
                                                    const Engines::ContainerParameters& params, std::string& tmpFileName) const;
 
+  std::vector<std::string> BuildArgvToLaunchLocalContainer(const Engines::ContainerParameters& params,
+                                                           const std::string& container_exe) const;
+
   static void RmTmpFile(std::string& tmpFile);
 
   void AddOmninamesParams(std::string& command) const;
@@ -106,7 +126,38 @@ protected:
                   const std::string & resource_selected,
                   const std::string & hostname,
                   const std::string & machFile,
-                  const std::string & containerNameInNS);
+                  const std::string & containerNameInNS,
+                  bool useWarmPool = true);
+
+  void ExpectContainer(const std::string& containerNameInNS);
+
+  Engines::Container_ptr WaitForContainer(const std::string& containerNameInNS,
+                                          const std::string& resource_selected);
+
+  void WatchContainerProcess(long pid, const std::string& containerNameInNS);
+
+  void ContainerExited(const std::string& containerNameInNS, long pid, int status);
+
+  bool BeginLaunch(const std::string& containerNameInNS, Engines::Container_var& cont);
+
+  void EndLaunch(const std::string& containerNameInNS, Engines::Container_ptr cont);
+
+  Engines::Container_ptr TakeFromPool(const std::string& resource_selected,
+                                      const std::string& hostname,
+                                      const std::string& containerNameInNS,
+                                      const Engines::ContainerParameters& params);
+
+  void RefillPool(const std::string& resource_selected, const std::string& hostname);
+
+  void LaunchPoolContainer(const std::string resource_selected, const std::string hostname);
+
+  void WaitForPoolLaunches();
+
+  void AddLaunchedContainer(const std::string& resource_selected, const std::string& containerNameInNS);
+
+  void SampleLoads();
+
+  void StopLoadSampling();
 
   CORBA::ORB_var _orb;
   PortableServer::POA_var _poa;
@@ -128,6 +179,51 @@ protected:
   //! attributes to allow concurrency for // GiveContainer
   Utils_Mutex _giveContainerMutex1;
 
+  //! launched containers not yet registered in the naming service,
+  //! REGISTERED once they have called ContainerRegistered,
+  //! EXITED if their process ended before; pid is the process spawned
+  //! for this launch (0 if unknown), so that the end of the process of a
+  //! previous launch under the same name is ignored, as is its container
+  //! while its name is still bound in the naming service
+  enum LaunchState { LAUNCHING, REGISTERED, EXITED };
+  struct ExpectedContainer
+  {
+    LaunchState state = LAUNCHING;
+    long pid = 0;
+  };
+  std::map<std::string, ExpectedContainer> _expectedContainers;
+  std::mutex _expectedContainersMutex;
+  std::condition_variable _expectedContainersCondition;
+
+  //! launches in progress, shared by the concurrent GiveContainer requests
+  //! for the same container name
+  struct LaunchInProgress
+  {
+    bool done = false;
+    Engines::Container_var container;
+  };
+  std::map<std::string, std::shared_ptr<LaunchInProgress> > _launchesInProgress;
+
+  //! warm pool: names in the naming service of the idle generic containers
+  //! started in advance on each resource, and number of them being started
+  std::map<std::string, std::list<std::string> > _pool;
+  std::map<std::string, int> _poolLaunching;
+  int _poolSize;
+  int _poolLaunches;
+  int _poolNumber;
+  CORBA::LongLong _poolHits;
+  CORBA::LongLong _poolMisses;
+  std::mutex _poolMutex;
+  std::condition_variable _poolCondition;
+
+  //! containers launched on each resource, whose load is sampled every
+  //! LOAD_SAMPLING_PERIOD seconds for the "best" policy of the resources manager
+  std::map<std::string, std::set<std::string> > _launchedContainers;
+  bool _stopLoadSampling;
+  std::mutex _loadMutex;
+  std::condition_variable _loadCondition;
+  std::thread _loadSampler;
+
   pid_t _pid_mpiServer;
 
   // Begin of PacO++ Parallel extension
@@ -172,13 +268,23 @@ public:
   static std::string GetenvThreadSafeAsString(const char *name);
   static int SystemThreadSafe(const char *command);
   static long SystemWithPIDThreadSafe(const std::vector<std::string>& command);
+  static long SpawnWithPIDThreadSafe(const std::vector<std::string>& command,
+                                     const std::string& logFilename,
+                                     const std::string& workingDir);
   static void AddOmninamesParams(std::ostream& fileStream, SALOME_NamingService_Abstract *ns);
   static void MakeTheCommandToBeLaunchedASync(std::string& command);
   static int GetTimeOutToLoaunchServer();
   static void SleepInSecond(int ellapseTimeInSecond);
  private:
   static const int TIME_OUT_TO_LAUNCH_CONT;
+  static const int FIRST_POLLING_DELAY_MS;
+  static const int MAX_POLLING_DELAY_MS;
+  static const char *POOL_CONTAINER_NAME;
+  static const int LOAD_SAMPLING_PERIOD;
   static Utils_Mutex _getenvMutex;
   static Utils_Mutex _systemMutex;
+  //! live managers, the threads reaping the containers must not notify a destroyed one
+  static std::mutex _managersMutex;
+  static std::set<SALOME_ContainerManager *> _managers;
 };
 #endif
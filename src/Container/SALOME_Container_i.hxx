@@ -107,6 +107,7 @@ public:
   char *workingdir();
   char *logfilename();
   void logfilename(const char *name);
+  void adopt(const char *containerNameInNS, const char *workingdir);
 
   virtual void Shutdown();
   char *getHostName();
@@ -0,0 +1,133 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "DF_Allocator.hxx"
+
+#include <new>
+
+namespace
+{
+  //Blocks are rounded to the granularity, blocks bigger than MAX_BLOCK are taken from the heap
+  const size_t GRANULARITY = 16;
+  const size_t MAX_BLOCK   = 512;
+  const size_t PAGE_SIZE   = 64*1024;
+
+  size_t RoundedSize(size_t theSize)
+  {
+    if(theSize == 0) theSize = 1;
+    return (theSize + GRANULARITY - 1) & ~(GRANULARITY - 1);
+  }
+}
+
+//Constructor
+DF_Allocator::DF_Allocator()
+  :_freeLists(MAX_BLOCK/GRANULARITY + 1, (void*)NULL),
+   _current(NULL),
+   _left(0),
+   _nbAllocations(0),
+   _nbLiveBlocks(0),
+   _nbBytesInUse(0),
+   _nbBytesReserved(0)
+{
+}
+
+//Destructor
+DF_Allocator::~DF_Allocator()
+{
+  Release();
+}
+
+//Returns a block of theSize bytes
+void* DF_Allocator::Allocate(size_t theSize)
+{
+  size_t aSize = RoundedSize(theSize);
+  _nbAllocations++;
+  _nbLiveBlocks++;
+  _nbBytesInUse += aSize;
+
+  if(aSize > MAX_BLOCK) return ::operator new(aSize);
+
+  void*& aFree = _freeLists[aSize/GRANULARITY];
+  if(aFree) {
+    void* aBlock = aFree;
+    aFree = *(void**)aBlock;
+    return aBlock;
+  }
+
+  if(_left < aSize) {
+    _current = (char*)::operator new(PAGE_SIZE);
+    _left = PAGE_SIZE;
+    _pages.push_back(_current);
+    _nbBytesReserved += PAGE_SIZE;
+  }
+
+  void* aBlock = _current;
+  _current += aSize;
+  _left -= aSize;
+  return aBlock;
+}
+
+//Gives back the block thePtr of theSize bytes
+void DF_Allocator::Deallocate(void* thePtr, size_t theSize)
+{
+  if(!thePtr) return;
+
+  size_t aSize = RoundedSize(theSize);
+  _nbLiveBlocks--;
+  _nbBytesInUse -= aSize;
+
+  if(aSize > MAX_BLOCK) {
+    ::operator delete(thePtr);
+    return;
+  }
+
+  void*& aFree = _freeLists[aSize/GRANULARITY];
+  *(void**)thePtr = aFree;
+  aFree = thePtr;
+}
+
+//Releases all the pages
+void DF_Allocator::Release()
+{
+  for(size_t i = 0, len = _pages.size(); i<len; i++)
+    ::operator delete(_pages[i]);
+  _pages.clear();
+
+  for(size_t i = 0, len = _freeLists.size(); i<len; i++)
+    _freeLists[i] = NULL;
+
+  _current = NULL;
+  _left = 0;
+  _nbAllocations = 0;
+  _nbLiveBlocks = 0;
+  _nbBytesInUse = 0;
+  _nbBytesReserved = 0;
+}
+
+//Returns the memory usage of this allocator
+DF_AllocatorStats DF_Allocator::GetStats() const
+{
+  DF_AllocatorStats aStats;
+  aStats.nbAllocations = _nbAllocations;
+  aStats.nbLiveBlocks = _nbLiveBlocks;
+  aStats.nbBytesInUse = _nbBytesInUse;
+  aStats.nbBytesReserved = _nbBytesReserved;
+  aStats.nbPages = _pages.size();
+  return aStats;
+}
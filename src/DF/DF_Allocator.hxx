@@ -0,0 +1,76 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef DFALLOCATOR_HXX
+#define DFALLOCATOR_HXX
+
+#include "DF_definitions.hxx"
+
+#include <vector>
+#include <cstddef>
+
+//Memory usage of a DF_Allocator
+struct DF_AllocatorStats
+{
+  long   nbAllocations;   //Number of blocks allocated since the creation (or the last release)
+  long   nbLiveBlocks;    //Number of blocks currently in use
+  size_t nbBytesInUse;    //Size of the blocks currently in use
+  size_t nbBytesReserved; //Size of the pages reserved by the allocator
+  size_t nbPages;         //Number of the pages reserved by the allocator
+};
+
+//Class DF_Allocator is a slab allocator used by DF_Document for its Label nodes and Attributes.
+//Blocks are carved from large pages, freed blocks are kept in per-size free lists and reused.
+//Release() gives all the pages back at once, consecutively created Labels (siblings) are
+//placed next to each other in memory.
+class DF_Allocator {
+public:
+  //Constructor
+  Standard_EXPORT DF_Allocator();
+
+  //Destructor, releases all the pages
+  Standard_EXPORT ~DF_Allocator();
+
+  //Returns a block of theSize bytes
+  Standard_EXPORT void* Allocate(size_t theSize);
+
+  //Gives back the block thePtr of theSize bytes allocated by this allocator
+  Standard_EXPORT void Deallocate(void* thePtr, size_t theSize);
+
+  //Releases all the pages, the blocks must not be used after this call
+  Standard_EXPORT void Release();
+
+  //Returns the memory usage of this allocator
+  Standard_EXPORT DF_AllocatorStats GetStats() const;
+
+private:
+  DF_Allocator(const DF_Allocator&);
+  DF_Allocator& operator=(const DF_Allocator&);
+
+  std::vector<char*> _pages;
+  std::vector<void*> _freeLists; //Heads of the free lists by size class
+  char*              _current;   //Free space of the current page
+  size_t             _left;
+  long               _nbAllocations;
+  long               _nbLiveBlocks;
+  size_t             _nbBytesInUse;
+  size_t             _nbBytesReserved;
+};
+
+#endif
@@ -20,13 +20,112 @@
 #include "DF_definitions.hxx"
 #include "DF_Label.hxx"
 #include "DF_Attribute.hxx"
+#include "DF_Document.hxx"
+
+#include <new>
+#include <mutex>
+#include <atomic>
+#include <list>
+#include <unordered_map>
+
+namespace
+{
+  //Header stored in front of each Attribute: the pool it comes from (NULL for the heap) and the block size
+  struct AttributeBlockHeader
+  {
+    DF_Allocator* allocator;
+    size_t        size;
+  };
+  const size_t HEADER_SIZE = 16;
+
+  //Registry of the Attribute types IDs interned into small integers.
+  //The registry is copied on write: lookups read the last published snapshot
+  //without locking, registrations of new types are serialized by the mutex.
+  typedef std::unordered_map<std::string, int> TypeMap;
+
+  std::mutex& TypeRegistryMutex()
+  {
+    static std::mutex aMutex;
+    return aMutex;
+  }
+
+  //All the published snapshots, kept alive as readers may still use an old one
+  std::list<TypeMap>& TypeRegistrySnapshots()
+  {
+    static std::list<TypeMap> aSnapshots;
+    return aSnapshots;
+  }
+
+  const TypeMap* EmptyTypeRegistry()
+  {
+    TypeRegistrySnapshots().push_back(TypeMap());
+    return &TypeRegistrySnapshots().back();
+  }
+
+  //The last published snapshot
+  std::atomic<const TypeMap*>& TypeRegistry()
+  {
+    static std::atomic<const TypeMap*> aRegistry(EmptyTypeRegistry());
+    return aRegistry;
+  }
+
+  int LookupTypeIndex(const std::string& theID, const std::string*& theInternedID)
+  {
+    const TypeMap* aRegistry = TypeRegistry().load(std::memory_order_acquire);
+    TypeMap::const_iterator it = aRegistry->find(theID);
+    if(it == aRegistry->end()) return -1;
+    theInternedID = &it->first;
+    return it->second;
+  }
+}
 
 //Class DF_Attribute is used to store some data defined by the DF_Attribute type
 
+//Allocates an Attribute in the memory pool of the Document of theLabel
+void* DF_Attribute::operator new(size_t theSize, const DF_Label& theLabel)
+{
+  DF_Document* aDoc = theLabel.GetDocument();
+  if(!aDoc) return DF_Attribute::operator new(theSize);
+
+  DF_Allocator* anAllocator = &aDoc->GetAllocator();
+  char* aBlock = (char*)anAllocator->Allocate(theSize + HEADER_SIZE);
+  AttributeBlockHeader* aHeader = (AttributeBlockHeader*)aBlock;
+  aHeader->allocator = anAllocator;
+  aHeader->size = theSize + HEADER_SIZE;
+  return aBlock + HEADER_SIZE;
+}
+
+//Allocates an Attribute in the heap
+void* DF_Attribute::operator new(size_t theSize)
+{
+  char* aBlock = (char*)::operator new(theSize + HEADER_SIZE);
+  AttributeBlockHeader* aHeader = (AttributeBlockHeader*)aBlock;
+  aHeader->allocator = NULL;
+  aHeader->size = theSize + HEADER_SIZE;
+  return aBlock + HEADER_SIZE;
+}
+
+//Called if the constructor of an Attribute allocated in a Document pool throws
+void DF_Attribute::operator delete(void* thePtr, const DF_Label& /*theLabel*/)
+{
+  DF_Attribute::operator delete(thePtr);
+}
+
+//Gives the memory of an Attribute back to the pool or the heap it comes from
+void DF_Attribute::operator delete(void* thePtr)
+{
+  if(!thePtr) return;
+  char* aBlock = (char*)thePtr - HEADER_SIZE;
+  AttributeBlockHeader* aHeader = (AttributeBlockHeader*)aBlock;
+  if(aHeader->allocator) aHeader->allocator->Deallocate(aBlock, aHeader->size);
+  else ::operator delete(aBlock);
+}
+
 //Constructor
 DF_Attribute::DF_Attribute()
 {
   _node = NULL;
+  _typeIndex = -1;
 }
 
 DF_Attribute::~DF_Attribute()
@@ -34,10 +133,10 @@ DF_Attribute::~DF_Attribute()
   //Remove an attribute from a map of the node's attributes to 
   //avoid double deletion on the node destruction
   if(_node) {
-	  std::map<std::string, DF_Attribute*>::iterator mi;
-    for(mi =_node->_attributes.begin(); mi != _node->_attributes.end(); mi++) {
-       if(mi->second == this) {
-         _node->_attributes.erase(mi);
+    DF_LabelNode::AttributeList::iterator ai;
+    for(ai =_node->_attributes.begin(); ai != _node->_attributes.end(); ai++) {
+       if(ai->attribute == this) {
+         _node->_attributes.erase(ai);
          return;
        } 
     }
@@ -57,4 +156,45 @@ DF_Attribute* DF_Attribute::FindAttribute(const std::string& theID) const
   return Label().FindAttribute(theID);
 }
 
+ //Searches an Attribute with given type index located on the same Label as this Attribute.
+DF_Attribute* DF_Attribute::FindAttribute(int theTypeIndex) const
+{
+  if(!_node) return NULL;
+  return Label().FindAttribute(theTypeIndex);
+}
+
+//Returns a small integer that uniquely identifies the Attribute type theID
+int DF_Attribute::TypeIndex(const std::string& theID)
+{
+  const std::string* anInternedID;
+  return TypeIndex(theID, anInternedID);
+}
+
+//The registered keys are never freed with their snapshot, theInternedID stays valid
+int DF_Attribute::TypeIndex(const std::string& theID, const std::string*& theInternedID)
+{
+  int anIndex = LookupTypeIndex(theID, theInternedID);
+  if(anIndex >= 0) return anIndex;
+
+  std::lock_guard<std::mutex> aGuard(TypeRegistryMutex());
+  const TypeMap* aRegistry = TypeRegistry().load(std::memory_order_relaxed);
+  TypeMap::const_iterator it = aRegistry->find(theID);
+  if(it != aRegistry->end()) {
+    theInternedID = &it->first;
+    return it->second;
+  }
+  std::list<TypeMap>& aSnapshots = TypeRegistrySnapshots();
+  aSnapshots.push_back(*aRegistry);
+  anIndex = (int)aRegistry->size();
+  it = aSnapshots.back().insert(std::make_pair(theID, anIndex)).first;
+  theInternedID = &it->first;
+  TypeRegistry().store(&aSnapshots.back(), std::memory_order_release);
+  return anIndex;
+}
 
+//Returns an index of the registered Attribute type theID or -1
+int DF_Attribute::FindTypeIndex(const std::string& theID)
+{
+  const std::string* anInternedID;
+  return LookupTypeIndex(theID, anInternedID);
+}
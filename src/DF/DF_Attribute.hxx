@@ -22,14 +22,17 @@
 
 #include "DF_definitions.hxx"
 #include <string>
+#include <cstddef>
 
 class DF_Label;
 class DF_LabelNode;
+class DF_Allocator;
 
 //Class DF_Attribute is used to store some data defined by the DF_Attribute type
 class DF_Attribute {
 protected:
   DF_LabelNode* _node;
+  int           _typeIndex;
 
 public:
   //Constructor
@@ -37,12 +40,39 @@ public:
 
   Standard_EXPORT virtual ~DF_Attribute();
 
+  //Allocates an Attribute in the memory pool of the Document of theLabel,
+  //use it as "new(theLabel) MyAttribute()" for Attributes that are added to theLabel.
+  Standard_EXPORT static void* operator new(size_t theSize, const DF_Label& theLabel);
+  Standard_EXPORT static void* operator new(size_t theSize);
+  Standard_EXPORT static void operator delete(void* thePtr, const DF_Label& theLabel);
+  Standard_EXPORT static void operator delete(void* thePtr);
+
   //Returns a Label on which this Attribute is located.
   Standard_EXPORT DF_Label Label() const;
 
   //Searches an Attribute with given ID located on the same Label as this Attribute.
   Standard_EXPORT DF_Attribute* FindAttribute(const std::string& theID) const;
 
+  //Searches an Attribute with given type index located on the same Label as this Attribute.
+  Standard_EXPORT DF_Attribute* FindAttribute(int theTypeIndex) const;
+
+  //Returns a small integer that uniquely identifies the Attribute type theID within the process.
+  //The ID is registered on the first call, further calls return the same index.
+  Standard_EXPORT static int TypeIndex(const std::string& theID);
+
+  //Returns an index of the already registered Attribute type theID or -1 if it is unknown.
+  Standard_EXPORT static int FindTypeIndex(const std::string& theID);
+
+  //Returns the type index of the Attribute class T, registered once from its static T::GetID().
+  template <class T> static int TypeIndexOf()
+  {
+    static const int anIndex = TypeIndex(T::GetID());
+    return anIndex;
+  }
+
+  //Returns the interned index of ID() (-1 until the Attribute is added to a Label)
+  int GetTypeIndex() const { return _typeIndex; }
+
 
   Standard_EXPORT virtual std::string Save() { return ""; } 
   Standard_EXPORT virtual void Load(const std::string&) {}
@@ -71,7 +101,10 @@ public:
 protected:
   void Backup() {}
 
-  
+private:
+  //Same as TypeIndex(theID), also gives the registered copy of theID that stays valid
+  static int TypeIndex(const std::string& theID, const std::string*& theInternedID);
+
 friend class DF_Label;
   
 };
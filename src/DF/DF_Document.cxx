@@ -22,6 +22,12 @@
 #include "DF_Label.hxx"
 #include "DF_ChildIterator.hxx"
 
+#include <new>
+#include <algorithm>
+
+//Number of resolved entries that are gathered before the first publication of the index
+static const size_t MIN_PUBLISHED_ENTRIES = 64;
+
 //Class DF_Document is container for user's data stored as a tree of Labels
 //with assigned Attributes
 
@@ -30,6 +36,7 @@ DF_Document::DF_Document(const std::string& theDocumentType)
   _id = -1;
   _type = theDocumentType;
   _modified = false;
+  _entries = NULL;
 }
 
 DF_Document::~DF_Document()
@@ -48,7 +55,7 @@ DF_Label DF_Document::Main()
   if(!_main.IsNull()) return _main;
 
   if(_root.IsNull()) {
-    _root = DF_Label(new DF_LabelNode());
+    _root = DF_Label(NewLabelNode());
     _root._node->_document = this;
   }
 
@@ -63,7 +70,7 @@ DF_Label DF_Document::Root()
   if(!_root.IsNull()) return _root;
   
   if(_root.IsNull()) {
-    _root = DF_Label(new DF_LabelNode());
+    _root = DF_Label(NewLabelNode());
     _root._node->_document = this;
   }
 
@@ -88,6 +95,13 @@ void DF_Document::Clear()
 {
   if(_root.IsNull()) return;
 
+  {
+    std::lock_guard<std::mutex> aGuard(_entriesMutex);
+    _entries = NULL;
+    _entriesSnapshots.clear();
+    _pendingEntries.clear();
+  }
+
   std::vector<DF_LabelNode*> vn;
   DF_ChildIterator CI(_root, true);
   for(; CI.More(); CI.Next()) {
@@ -95,11 +109,46 @@ void DF_Document::Clear()
     if(node) vn.push_back(node);
   }
 
+  //Attributes are destroyed with their nodes, then all the pages are released at once
   for(size_t i = 0, len = vn.size(); i<len; i++)
-    delete vn[i];
+    vn[i]->~DF_LabelNode();
 
-  _root._node->Reset();
+  _root._node->~DF_LabelNode();
   _root.Nullify();
+  _main.Nullify();
+  _allocator.Release();
+}
+
+//Returns the node indexed with theEntry, NULL if it is not indexed (yet)
+DF_LabelNode* DF_Document::FindEntry(const std::string& theEntry) const
+{
+  const EntryIndex* anIndex = _entries.load(std::memory_order_acquire);
+  if(!anIndex) return NULL;
+  EntryIndex::const_iterator anIt = anIndex->find(&theEntry);
+  return anIt != anIndex->end() ? anIt->second : NULL;
+}
+
+//Indexes theNode with its entry
+void DF_Document::AddEntry(DF_LabelNode* theNode)
+{
+  std::lock_guard<std::mutex> aGuard(_entriesMutex);
+  _pendingEntries.push_back(theNode);
+  const EntryIndex* anIndex = _entries.load(std::memory_order_relaxed);
+  if(_pendingEntries.size() < std::max(anIndex ? anIndex->size() : 0, MIN_PUBLISHED_ENTRIES)) return;
+
+  //The snapshots double in size, their copies cost O(1) per entry
+  _entriesSnapshots.push_back(anIndex ? *anIndex : EntryIndex());
+  EntryIndex& aNewIndex = _entriesSnapshots.back();
+  for(size_t i = 0, len = _pendingEntries.size(); i<len; i++)
+    aNewIndex.insert(std::make_pair(&_pendingEntries[i]->_entry, _pendingEntries[i]));
+  _pendingEntries.clear();
+  _entries.store(&aNewIndex, std::memory_order_release);
+}
+
+//Creates a new Label node in the pool of this Document
+DF_LabelNode* DF_Document::NewLabelNode()
+{
+  return new(_allocator.Allocate(sizeof(DF_LabelNode))) DF_LabelNode();
 }
 
 //Returns true if this document is empty
@@ -129,6 +178,18 @@ void DF_Document::SetModified(bool isModified)
 }
 
 
+//Returns the memory usage of the pool of this Document
+DF_AllocatorStats DF_Document::GetAllocatorStats() const
+{
+  return _allocator.GetStats();
+}
+
+//Returns the pool where the Labels and Attributes of this Document are allocated
+DF_Allocator& DF_Document::GetAllocator()
+{
+  return _allocator;
+}
+
 //Restores a content of the Document from the std::string theData
 void DF_Document::Load(const std::string& /*theData*/)
 {
@@ -22,8 +22,14 @@
 
 #include "DF_definitions.hxx"
 #include "DF_Label.hxx"
+#include "DF_Allocator.hxx"
 
 #include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <atomic>
+#include <mutex>
 
 class DF_Application;
 
@@ -70,9 +76,44 @@ public:
   //Converts a content of the Document into the std::string
   Standard_EXPORT virtual std::string Save();
 
+  //Returns the memory usage of the pool where the Labels and Attributes of this Document are allocated
+  Standard_EXPORT DF_AllocatorStats GetAllocatorStats() const;
+
+  //Returns the pool where the Labels and Attributes of this Document are allocated
+  Standard_EXPORT DF_Allocator& GetAllocator();
+
   friend class DF_Application;
+  friend class DF_Label;
 
 private:
+  //Creates a new Label node in the pool of this Document
+  DF_LabelNode* NewLabelNode();
+
+  //Index of the entries resolved by DF_Label::Label, keyed by the _entry of their nodes.
+  //It is filled by readers of the Document and copied on write: lookups read the last published
+  //snapshot without locking, the new entries are published at once when they are as many as the
+  //indexed ones.
+  struct EntryHash
+  {
+    size_t operator()(const std::string* theEntry) const { return std::hash<std::string>()(*theEntry); }
+  };
+  struct EntryEqual
+  {
+    bool operator()(const std::string* theLeft, const std::string* theRight) const { return *theLeft == *theRight; }
+  };
+  typedef std::unordered_map<const std::string*, DF_LabelNode*, EntryHash, EntryEqual> EntryIndex;
+
+  //Returns the node indexed with theEntry, NULL if it is not indexed (yet)
+  DF_LabelNode* FindEntry(const std::string& theEntry) const;
+
+  //Indexes theNode with its entry
+  void AddEntry(DF_LabelNode* theNode);
+
+  DF_Allocator _allocator;
+  std::atomic<const EntryIndex*> _entries;          //Last published snapshot of the index, NULL if none
+  std::list<EntryIndex>          _entriesSnapshots; //Kept until Clear(), readers may still use an old one
+  std::vector<DF_LabelNode*>     _pendingEntries;   //Resolved since the last publication
+  std::mutex                     _entriesMutex;     //Guards the snapshots and the pending entries
   DF_Label    _main;
   DF_Label    _root;
   std::string _type;
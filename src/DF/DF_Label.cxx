@@ -24,6 +24,10 @@
 #include "DF_ChildIterator.hxx"
 
 #include <algorithm>
+#include <unordered_map>
+
+//Number of children from which a node indexes its children by tag
+static const int CHILDREN_INDEX_THRESHOLD = 16;
 
 //Class DF_Label defines a persistence reference in DF_Document that contains a tree of Labels.
 //This reference is named "entry" and is a sequence of tags divided by ":". The root entry is "0:".
@@ -42,6 +46,10 @@ DF_Label DF_Label::Label(const DF_Label& theLabel, const std::string& theEntry,
   if(theEntry == "0:") return aLabel;
   if(theEntry == "0:1") return theLabel.GetDocument()->Main();
 
+  //Labels are never removed from a Document, once resolved an entry stays valid until the Document is cleared
+  DF_Document* aDoc = theLabel.GetDocument();
+  if(DF_LabelNode* aNode = aDoc->FindEntry(theEntry)) return DF_Label(aNode);
+
   char* cc = (char*)theEntry.c_str();
   int n = 0;
   int i=0;
@@ -66,6 +74,9 @@ DF_Label DF_Label::Label(const DF_Label& theLabel, const std::string& theEntry,
     }
   }
 
+  //Only the canonical spelling of an entry is indexed ("0:1:01" resolves to "0:1:1" but is not kept)
+  if(!aLabel.IsNull() && aLabel._node->_entry == theEntry)
+    aDoc->AddEntry(aLabel._node);
   return aLabel;
 }
 
@@ -134,24 +145,53 @@ bool DF_Label::IsAttached()
   return _node->_document != 0;
 }
 
+namespace
+{
+  bool AttributeIDLess(const DF_LabelNode::AttributeItem& theItem, const std::string& theID)
+  {
+    return *theItem.id < theID;
+  }
+
+  bool IDAttributeLess(const std::string& theID, const DF_LabelNode::AttributeItem& theItem)
+  {
+    return theID < *theItem.id;
+  }
+}
+
 //Searches an Attribute with given ID located on this Label.
 //Returns true if the Attribute is found.
 DF_Attribute* DF_Label::FindAttribute(const std::string& theID) const
 {
   if(!_node) return NULL;
 
-  std::map< std::string, DF_Attribute* >::iterator it=_node->_attributes.find(theID);
-  if(it == _node->_attributes.end()) return NULL;
-  return it->second;
+  //The Attributes are sorted by ID: no need to look the type index up
+  DF_LabelNode::AttributeList::const_iterator it =
+    std::lower_bound(_node->_attributes.begin(), _node->_attributes.end(), theID, AttributeIDLess);
+  if(it == _node->_attributes.end() || *it->id != theID) return NULL;
+  return it->attribute;
+}
+
+//Searches an Attribute with given type index located on this Label.
+DF_Attribute* DF_Label::FindAttribute(int theTypeIndex) const
+{
+  if(!_node || theTypeIndex < 0) return NULL;
 
+  DF_LabelNode::AttributeList::const_iterator it = _node->_attributes.begin();
+  for(; it != _node->_attributes.end(); it++)
+    if(it->type == theTypeIndex) return it->attribute;
+  return NULL;
 }
 
 //Returns true if there is an Attribute with given ID on this Label.
 bool DF_Label::IsAttribute(const std::string& theID) const
 {
-  if(!_node) return false;
+  return FindAttribute(theID) != NULL;
+}
 
-  return (_node->_attributes.find(theID) != _node->_attributes.end());
+//Returns true if there is an Attribute with given type index on this Label.
+bool DF_Label::IsAttribute(int theTypeIndex) const
+{
+  return FindAttribute(theTypeIndex) != NULL;
 }
 
 //Adds theAttribute to the Label where this Attribute is located.
@@ -160,9 +200,14 @@ bool DF_Label::AddAttribute(DF_Attribute* theAttribute) const
 {
   if(!_node) return false;
 
-  if(_node->_attributes.find(theAttribute->ID()) != _node->_attributes.end()) return false;
+  const std::string* anID;
+  int anIndex = DF_Attribute::TypeIndex(theAttribute->ID(), anID);
+  if(FindAttribute(anIndex)) return false;
   theAttribute->_node = _node;
-  _node->_attributes[theAttribute->ID()] = theAttribute;
+  theAttribute->_typeIndex = anIndex;
+  DF_LabelNode::AttributeItem anItem = { anIndex, anID, theAttribute };
+  _node->_attributes.insert(std::upper_bound(_node->_attributes.begin(), _node->_attributes.end(),
+                                             *anID, IDAttributeLess), anItem);
   theAttribute->AfterAddition();    
 
   return true;
@@ -173,10 +218,14 @@ bool DF_Label::ForgetAttribute(const std::string& theID) const
 {
   if(!_node) return false;
 
-  if(_node->_attributes.find(theID) == _node->_attributes.end()) return false;
-  DF_Attribute* attr = _node->_attributes[theID];
+  DF_LabelNode::AttributeList::iterator it =
+    std::lower_bound(_node->_attributes.begin(), _node->_attributes.end(), theID, AttributeIDLess);
+  if(it == _node->_attributes.end() || *it->id != theID) return false;
+  //BeforeForget does not change the Attributes of this Label, the position stays valid
+  size_t aPosition = it - _node->_attributes.begin();
+  DF_Attribute* attr = it->attribute;
   attr->BeforeForget();
-  _node->_attributes.erase(theID);
+  _node->_attributes.erase(_node->_attributes.begin() + aPosition);
   delete attr;
 
   return true;
@@ -234,21 +283,16 @@ bool DF_Label::HasAttributes() const
   return !(_node->_attributes.empty());
 }
 
-//Returns a list of Attributes of this Label.
+//Returns a list of Attributes of this Label sorted by their IDs.
 std::vector<DF_Attribute*> DF_Label::GetAttributes() const
 {
   std::vector<DF_Attribute*> attributes;
   if(!_node) return attributes;
   
-  typedef std::map<std::string, DF_Attribute*>::const_iterator AI;
-  std::vector<std::string> sorted;
-  for(AI p = _node->_attributes.begin(); p!=_node->_attributes.end(); p++)
-    sorted.push_back(p->first);
-    
-  sort(sorted.begin(), sorted.end());
-  size_t len = sorted.size();
-  for(size_t i = 0; i<len; i++)
-    attributes.push_back(_node->_attributes[sorted[i]]);
+  attributes.reserve(_node->_attributes.size());
+  DF_LabelNode::AttributeList::const_iterator it = _node->_attributes.begin();
+  for(; it != _node->_attributes.end(); it++)
+    attributes.push_back(it->attribute);
 
   return attributes;
 }
@@ -266,15 +310,7 @@ int DF_Label::NbChildren() const
 {
   if(!_node) return -1;
 
-  if(!_node->_firstChild) return 0;
-  int nb = 1;
-  DF_LabelNode* next = _node->_firstChild->_next;
-  while(next) {
-    nb++;
-    next = next->_next;
-  }
-
-  return nb;
+  return _node->_nbChildren;
 }
 
 //Returns the depth (a number of fathers required to identify the Label) of this Label in the tree.
@@ -326,21 +362,23 @@ DF_Label DF_Label::FindChild(int theTag, bool isCreate)
     if(_node->_lastChild->_tag < theTag) aPrevious = _node->_lastChild;
   }
   
-  if ( !aPrevious && _node->_firstChild )
+  if ( !aPrevious && _node->_childrenByTag )
   {
-    // IPAL54049: Operations on multiple study objects are very long
-    // Use _node->_firstChild->_previous to store the last found child
-    if ( _node->_firstChild->_previous &&
-         _node->_firstChild->_previous->_tag <= theTag )
-      aLabel = _node->_firstChild->_previous;
-    else
-      aLabel = _node->_firstChild;
+    std::map<int, DF_LabelNode*>::iterator anIt = _node->_childrenByTag->lower_bound(theTag);
+    if(anIt != _node->_childrenByTag->end()) {
+      if(anIt->first == theTag) return DF_Label(anIt->second);
+      aNext = anIt->second;
+    }
+    if(anIt != _node->_childrenByTag->begin()) aPrevious = (--anIt)->second;
+  }
+  else if ( !aPrevious && _node->_firstChild )
+  {
+    // Few children (see CHILDREN_INDEX_THRESHOLD): a linear search is enough.
+    // Nothing is memorized here, FindChild may be called by concurrent readers.
+    aLabel = _node->_firstChild;
 
     while(aLabel) {
-      if(aLabel->_tag == theTag) {
-        _node->_firstChild->_previous = aLabel;
-        return DF_Label(aLabel);
-      }
+      if(aLabel->_tag == theTag) return DF_Label(aLabel);
       if(aLabel->_tag > theTag) {
         aNext = aLabel;
         break;
@@ -352,11 +390,28 @@ DF_Label DF_Label::FindChild(int theTag, bool isCreate)
   
   if(!isCreate) return DF_Label();
 
-  DF_LabelNode* aChild = new DF_LabelNode();
+  DF_LabelNode* aChild = _node->_document->NewLabelNode();
   aChild->_father = this->_node;
   aChild->_document = _node->_document;
   aChild->_tag = theTag;
   aChild->_depth = _node->_depth+1;
+
+  //The entry is computed once here, a tag takes at most 10 digits and a separator
+  std::string& entry = aChild->_entry;
+  if(_node->_father) {
+    entry.reserve(_node->_entry.size() + 11);
+    entry.assign(_node->_entry);
+  }
+  else entry.assign("0");
+  char digits[10];
+  unsigned int tag = (unsigned int)theTag;
+  int nb = 0;
+  do {
+    digits[nb++] = '0' + (tag % 10);
+  } while(tag /= 10);
+  entry += ':';
+  while(nb > 0) entry += digits[--nb];
+
   if(aNext) {
     aChild->_previous = aNext->_previous;
     aChild->_next = aNext;
@@ -370,6 +425,16 @@ DF_Label DF_Label::FindChild(int theTag, bool isCreate)
     
   if(!_node->_firstChild || (aNext && aNext == _node->_firstChild) ) _node->_firstChild = aChild;
   if(!_node->_lastChild || !aNext) _node->_lastChild = aChild;
+
+  _node->_nbChildren++;
+  if(_node->_childrenByTag) {
+    (*_node->_childrenByTag)[theTag] = aChild;
+  }
+  else if(_node->_nbChildren > CHILDREN_INDEX_THRESHOLD) {
+    _node->_childrenByTag = new std::map<int, DF_LabelNode*>;
+    for(DF_LabelNode* aNode = _node->_firstChild; aNode; aNode = aNode->_next)
+      _node->_childrenByTag->insert(_node->_childrenByTag->end(), std::make_pair(aNode->_tag, aNode));
+  }
   
   return aChild;
 }
@@ -392,33 +457,13 @@ int DF_Label::LastChildTag() const
 }
 
 //Returns a string entry of this Label
+//The entry is computed when the node is created: a node never changes its father and tag,
+//so reading it needs no lock.
 std::string DF_Label::Entry() const
 {
-  DF_LabelNode* father = this->_node;
-  if(!father->_father)return "0:";
-  int tag;
-  char buff[128];
-  char* wstr= buff;
-  char* str = buff;
-
-  while(father)
-    {
-      tag=father->_tag;
-      do{
-         // Conversion. Number is reversed.
-         *wstr++ = '0' + (tag % 10);
-      }while(tag /= 10);
-      father = father->_father;
-      if(father)*wstr++ = ':';
-    }
-  *wstr-- = '\0';
-
-  //reverse the buffer
-  char aux;
-  while (wstr > str)
-    aux = *wstr, *wstr-- = *str, *str++ = aux;
-
-  return buff;
+  if(!_node) return "";
+  if(!_node->_father) return "0:";
+  return _node->_entry;
 }
 
 bool DF_Label::IsEqual(const DF_Label& theLabel)
@@ -431,7 +476,6 @@ bool DF_Label::IsEqual(const DF_Label& theLabel)
 
 void DF_Label::Nullify() 
 {
-  delete _node;
   _node = NULL;
 }
 
@@ -475,19 +519,19 @@ DF_LabelNode::DF_LabelNode()
   _lastChild = NULL;
   _previous = NULL;
   _next = NULL;
+  _nbChildren = 0;
+  _childrenByTag = NULL;
 }
 
 DF_LabelNode::~DF_LabelNode()
 {
-  std::vector<DF_Attribute*> va;
-  typedef std::map<std::string, DF_Attribute*>::const_iterator AI;
-  for(AI p = _attributes.begin(); p!=_attributes.end(); p++)
-    va.push_back(p->second);
+  delete _childrenByTag;
 
-  for(size_t i = 0, len = va.size(); i<len; i++) 
-    delete va[i];
+  AttributeList va;
+  va.swap(_attributes);
 
-  _attributes.clear();
+  for(size_t i = 0, len = va.size(); i<len; i++) 
+    delete va[i].attribute;
 }
 
 
@@ -496,19 +540,19 @@ void DF_LabelNode::Reset()
   _depth = 0;
   _tag = 0;
 
-  std::vector<DF_Attribute*> va;
-  typedef std::map<std::string, DF_Attribute*>::const_iterator AI;
-  for(AI p = _attributes.begin(); p!=_attributes.end(); p++)
-    va.push_back(p->second);
+  AttributeList va;
+  va.swap(_attributes);
 
   for(size_t i = 0, len = va.size(); i<len; i++) 
-    delete va[i];
-
-  _attributes.clear();
+    delete va[i].attribute;
   _document = NULL;
   _father = NULL;
   _firstChild = NULL;
   _lastChild = NULL;
   _previous = NULL;
   _next = NULL;  
+  _nbChildren = 0;
+  delete _childrenByTag;
+  _childrenByTag = NULL;
+  _entry.clear();
 }
@@ -26,6 +26,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <utility>
 
 class DF_Document;
 
@@ -33,6 +34,16 @@ class DF_Document;
 class DF_LabelNode
 {
 public:
+  //Attributes of the node with their interned type index and ID, sorted by ID.
+  //A node carries only a few Attributes, a linear scan of integers is cheaper than a map of GUIDs.
+  struct AttributeItem
+  {
+    int                type;
+    const std::string* id;
+    DF_Attribute*      attribute;
+  };
+  typedef std::vector<AttributeItem> AttributeList;
+
   DF_LabelNode();
   ~DF_LabelNode();
   void Reset();
@@ -45,7 +56,10 @@ private:
   DF_LabelNode*                            _firstChild;
   DF_LabelNode*                            _lastChild;
   DF_Document*                             _document;
-  std::map< std::string, DF_Attribute* >   _attributes;
+  AttributeList                            _attributes;
+  int                                      _nbChildren;
+  std::map<int, DF_LabelNode*>*            _childrenByTag; //Built when the node gets many children
+  std::string                              _entry;         //Computed when the node is created
 
   friend class DF_Document;
   friend class DF_Label;
@@ -102,9 +116,15 @@ public:
   //Returns true if the Attribute is found.
   Standard_EXPORT DF_Attribute* FindAttribute(const std::string& theID) const;
 
+  //Searches an Attribute with given type index (see DF_Attribute::TypeIndex) located on this Label.
+  Standard_EXPORT DF_Attribute* FindAttribute(int theTypeIndex) const;
+
   //Returns true if there is an Attribute with given ID on this Label.
   Standard_EXPORT bool IsAttribute(const std::string& theID) const;
 
+  //Returns true if there is an Attribute with given type index on this Label.
+  Standard_EXPORT bool IsAttribute(int theTypeIndex) const;
+
   //Adds theAttribute to the Label where this Attribute is located.
   //Returns true if theAttribute was added.
   Standard_EXPORT bool AddAttribute(DF_Attribute* theAttribute) const;
@@ -164,7 +184,7 @@ public:
   Standard_EXPORT void dump();
 
 private:
-  //Nullifies the content of the label
+  //Detaches the label from its node, the node itself is owned by the Document
   void Nullify();
 
 friend class DF_Document;
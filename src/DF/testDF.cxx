@@ -25,6 +25,10 @@
 #include <vector>
 #include <string>
 #include <string.h>
+#include <map>
+#include <chrono>
+#include <thread>
+#include <atomic>
 
 #include "DF_definitions.hxx"
 #include "DF_Application.hxx"
@@ -184,6 +188,231 @@ std::vector<std::string> splitString(const std::string& theValue, char separator
 }
 
 
+//Attribute with a GUID given at construction, used by the benchmarks below
+class TestAttribute : public DF_Attribute
+{
+public:
+  TestAttribute(const std::string& theID) : _id(theID) {}
+  virtual const std::string& ID() const { return _id; }
+  virtual void Restore(DF_Attribute*) {}
+  virtual DF_Attribute* NewEmpty() const { return new TestAttribute(_id); }
+  virtual void Paste(DF_Attribute*) {}
+private:
+  std::string _id;
+};
+
+double ElapsedMs(const std::chrono::steady_clock::time_point& theStart)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - theStart).count();
+}
+
+//Compares the attribute lookup through the GUID based std::map, that was used to store
+//the attributes of DF_LabelNode, with the string and interned type index API of DF_Label.
+void BenchAttributeLookup(DF_Application* appli)
+{
+  const int nbLabels = 100000, nbAttrTypes = 6, nbLoops = 10;
+  const char* guids[nbAttrTypes] = { "8650000D-63A0-4651-B621-CC95C9308598",
+                                     "92888E01-7074-11d5-A690-0800369C8A03",
+                                     "12837184-8F52-11d6-A8A3-0001021E8C7F",
+                                     "AA33D1B6-F4E5-4a11-8BF6-6A7F5EB7A2E2",
+                                     "0181B525-3F15-4ab2-9DE3-5E2F54B5F340",
+                                     "1AF2B35B-6E94-11d6-A8A0-0001021E8C7F" };
+  std::vector<std::string> ids(guids, guids+nbAttrTypes);
+
+  DF_Document* doc = appli->NewDocument("bench_attributes");
+  DF_Label main = doc->Main();
+  std::vector<DF_Label> labels;
+  std::vector< std::map<std::string, DF_Attribute*> > maps(nbLabels);
+  for(int i = 0; i<nbLabels; i++) {
+    DF_Label L = main.NewChild();
+    labels.push_back(L);
+    for(int j = 0; j<nbAttrTypes; j++) {
+      if((i+j) % 3 == 0) continue;
+      DF_Attribute* attr = new(L) TestAttribute(ids[j]);
+      L.AddAttribute(attr);
+      maps[i][ids[j]] = attr;
+    }
+  }
+
+  //The Attributes are added in an order that is not the one of their IDs
+  bool isSorted = true;
+  for(int i = 0; i<nbLabels && isSorted; i++) {
+    std::vector<DF_Attribute*> attributes = labels[i].GetAttributes();
+    std::map<std::string, DF_Attribute*>::const_iterator it = maps[i].begin();
+    for(size_t j = 0; j<attributes.size(); j++, it++)
+      isSorted = isSorted && it != maps[i].end() && attributes[j] == it->second
+                 && labels[i].FindAttribute(it->first) == it->second;
+    isSorted = isSorted && it == maps[i].end();
+  }
+  std::cout << "Attributes sorted by ID    : " << (isSorted ? "OK" : "KO") << std::endl;
+
+  long nbFound = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for(int k = 0; k<nbLoops; k++)
+    for(int i = 0; i<nbLabels; i++)
+      for(int j = 0; j<nbAttrTypes; j++)
+        if(maps[i].find(ids[j]) != maps[i].end()) nbFound++;
+  std::cout << "Lookup std::map<GUID>      : " << ElapsedMs(start) << " ms (" << nbFound << " found)" << std::endl;
+
+  nbFound = 0;
+  start = std::chrono::steady_clock::now();
+  for(int k = 0; k<nbLoops; k++)
+    for(int i = 0; i<nbLabels; i++)
+      for(int j = 0; j<nbAttrTypes; j++)
+        if(labels[i].FindAttribute(ids[j])) nbFound++;
+  std::cout << "Lookup DF_Label by GUID    : " << ElapsedMs(start) << " ms (" << nbFound << " found)" << std::endl;
+
+  std::vector<int> types;
+  for(int j = 0; j<nbAttrTypes; j++) types.push_back(DF_Attribute::TypeIndex(ids[j]));
+  nbFound = 0;
+  start = std::chrono::steady_clock::now();
+  for(int k = 0; k<nbLoops; k++)
+    for(int i = 0; i<nbLabels; i++)
+      for(int j = 0; j<nbAttrTypes; j++)
+        if(labels[i].FindAttribute(types[j])) nbFound++;
+  std::cout << "Lookup DF_Label by index   : " << ElapsedMs(start) << " ms (" << nbFound << " found)" << std::endl;
+
+  nbFound = 0;
+  start = std::chrono::steady_clock::now();
+  for(int k = 0; k<nbLoops; k++)
+    for(int i = 0; i<nbLabels; i++)
+      for(std::map<std::string, DF_Attribute*>::const_iterator it = maps[i].begin(); it != maps[i].end(); it++)
+        nbFound++;
+  std::cout << "Iteration std::map<GUID>   : " << ElapsedMs(start) << " ms (" << nbFound << " visited)" << std::endl;
+
+  nbFound = 0;
+  start = std::chrono::steady_clock::now();
+  for(int k = 0; k<nbLoops; k++)
+    for(int i = 0; i<nbLabels; i++)
+      nbFound += labels[i].GetAttributes().size();
+  std::cout << "Iteration DF_Label         : " << ElapsedMs(start) << " ms (" << nbFound << " visited)" << std::endl;
+
+  DF_AllocatorStats stats = doc->GetAllocatorStats();
+  std::cout << "Allocator : " << stats.nbAllocations << " allocations, " << stats.nbLiveBlocks << " live blocks, "
+            << stats.nbBytesInUse << " bytes in use, " << stats.nbBytesReserved << " bytes reserved in "
+            << stats.nbPages << " pages" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  appli->Close(doc);
+  std::cout << "Close document             : " << ElapsedMs(start) << " ms" << std::endl;
+}
+
+//Resolves random entries of a study like tree of 200000 labels (0:1:component:object:subobject)
+void BenchEntryLookup(DF_Application* appli)
+{
+  const int nbComponents = 10, nbObjects = 200, nbSubObjects = 100, nbLookups = 1000000;
+
+  DF_Document* doc = appli->NewDocument("bench_entries");
+  DF_Label main = doc->Main();
+  std::vector<std::string> entries;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for(int i = 1; i<=nbComponents; i++) {
+    DF_Label sco = main.FindChild(i, true);
+    for(int j = 1; j<=nbObjects; j++) {
+      DF_Label so = sco.FindChild(j, true);
+      for(int k = 1; k<=nbSubObjects; k++)
+        entries.push_back(so.FindChild(k, true).Entry());
+    }
+  }
+  std::cout << "Build " << entries.size() << " labels     : " << ElapsedMs(start) << " ms" << std::endl;
+
+  std::vector<size_t> picks;
+  srand(0);
+  for(int i = 0; i<nbLookups; i++) picks.push_back(((size_t)rand()*RAND_MAX + rand()) % entries.size());
+
+  long nbFound = 0;
+  start = std::chrono::steady_clock::now();
+  for(int i = 0; i<nbLookups; i++) {
+    //Walk through the tag indexed children as DF_Label::Label does for an unknown entry
+    const std::string& entry = entries[picks[i]];
+    int tags[3];
+    sscanf(entry.c_str(), "0:1:%d:%d:%d", &tags[0], &tags[1], &tags[2]);
+    DF_Label L = main.FindChild(tags[0], false).FindChild(tags[1], false).FindChild(tags[2], false);
+    if(!L.IsNull()) nbFound++;
+  }
+  std::cout << "Resolve by FindChild       : " << ElapsedMs(start) << " ms (" << nbFound << " found)" << std::endl;
+
+  nbFound = 0;
+  start = std::chrono::steady_clock::now();
+  for(int i = 0; i<nbLookups; i++)
+    if(!DF_Label::Label(main, entries[picks[i]], false).IsNull()) nbFound++;
+  std::cout << "Resolve by DF_Label::Label : " << ElapsedMs(start) << " ms (" << nbFound << " found)" << std::endl;
+
+  //A non canonical spelling of an entry resolves to the same label
+  for(int i = 0; i<2; i++)
+    std::cout << "Resolve 0:01:001:1:1       : " << DF_Label::Label(main, "0:01:001:1:1", false).Entry() << std::endl;
+
+  appli->Close(doc);
+}
+
+//Computes the entries of the labels of a deep tree (depth 12) several times
+void BenchEntry(DF_Application* appli)
+{
+  const int depth = 12, nbLeaves = 20000, nbLoops = 10;
+
+  DF_Document* doc = appli->NewDocument("bench_entry");
+  std::vector<DF_Label> labels;
+  for(int i = 1; i<=nbLeaves; i++) {
+    DF_Label L = doc->Main().FindChild(1 + i % 7, true);
+    for(int j = 2; j<depth; j++)
+      L = L.FindChild(1 + (i*j) % 1000, true);
+    labels.push_back(L.FindChild(i, true));
+  }
+
+  size_t length = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for(int i = 0; i<nbLeaves; i++) length += labels[i].Entry().size();
+  std::cout << "First Entry() at depth " << depth << " : " << ElapsedMs(start) << " ms (" << length << " chars)" << std::endl;
+
+  length = 0;
+  start = std::chrono::steady_clock::now();
+  for(int k = 0; k<nbLoops; k++)
+    for(int i = 0; i<nbLeaves; i++) length += labels[i].Entry().size();
+  std::cout << "Next Entry() calls x" << nbLoops << "   : " << ElapsedMs(start) << " ms (" << length << " chars)" << std::endl;
+
+  appli->Close(doc);
+}
+
+//Several threads read a tree at the same time, as the readers of a study locked shared do:
+//they resolve entries never resolved before, compute entries and find attributes.
+//Build testDF with -fsanitize=thread to check that the reads do not race.
+void TestConcurrentReaders(DF_Application* appli)
+{
+  const int nbThreads = 8, nbComponents = 4, nbObjects = 10, nbSubObjects = 30;
+
+  DF_Document* doc = appli->NewDocument("concurrent_readers");
+  DF_Label main = doc->Main();
+  std::vector<std::string> entries;
+  for(int i = 1; i<=nbComponents; i++) {
+    DF_Label sco = main.FindChild(i, true);
+    for(int j = 1; j<=nbObjects; j++) {
+      DF_Label so = sco.FindChild(j, true);
+      for(int k = 1; k<=nbSubObjects; k++) {
+        DF_Label L = so.FindChild(k, true);
+        DF_Container::Set(L);
+        entries.push_back(L.Entry());
+      }
+    }
+  }
+
+  std::atomic<int> nbErrors(0);
+  std::vector<std::thread> readers;
+  for(int t = 0; t<nbThreads; t++)
+    readers.push_back(std::thread([&, t]() {
+      for(size_t n = 0; n<entries.size(); n++) {
+        const std::string& entry = entries[(n + t*entries.size()/nbThreads) % entries.size()];
+        DF_Label L = DF_Label::Label(main, entry, false);
+        if(L.IsNull() || L.Entry() != entry || !L.FindAttribute(DF_Container::GetID()) ||
+           L.Father().FindChild(L.Tag(), false).IsNull())
+          nbErrors++;
+      }
+    }));
+  for(int t = 0; t<nbThreads; t++) readers[t].join();
+
+  std::cout << "Concurrent readers         : " << (nbErrors == 0 ? "OK" : "KO") << std::endl;
+  appli->Close(doc);
+}
+
 int main ()
 {
   std::cout << "Test started " << std::endl;
@@ -306,6 +535,11 @@ int main ()
     //CI2.Value().dump();
   }
 
+  TestConcurrentReaders(appli);
+  BenchAttributeLookup(appli);
+  BenchEntryLookup(appli);
+  BenchEntry(appli);
+
   delete appli;    
 
   std::cout << "Test finished " << std::endl;    
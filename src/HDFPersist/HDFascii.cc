@@ -35,6 +35,7 @@
 #include <fcntl.h>
 #include <stdio.h>
 #include <string>
+#include <vector>
 
 #ifdef WIN32
 #include <io.h>
@@ -48,28 +49,31 @@
 #define dir_separator '/'
 #endif
 
+class ASCIIWriter;
+class ASCIIReader;
+
 void Move(const std::string& fName, const std::string& fNameDst);
 bool Exists(const std::string thePath); 
-bool CreateAttributeFromASCII(HDFinternalObject *father, FILE* fp);
-bool CreateDatasetFromASCII(HDFcontainerObject *father, FILE *fp);
-bool CreateGroupFromASCII(HDFcontainerObject *father, FILE *fp);
+bool CreateFileFromASCII(HDFfile *hdf_file, ASCIIReader& in);
+bool CreateAttributeFromASCII(HDFinternalObject *father, ASCIIReader& in);
+bool CreateDatasetFromASCII(HDFcontainerObject *father, ASCIIReader& in);
+bool CreateGroupFromASCII(HDFcontainerObject *father, ASCIIReader& in);
 
-void SaveAttributeInASCIIfile(HDFattribute *hdf_attribute, FILE* fp, int ident);
-void SaveGroupInASCIIfile(HDFgroup *hdf_group, FILE* fp, int ident);
-void SaveDatasetInASCIIfile(HDFdataset *hdf_dataset, FILE* fp, int ident);
+void SaveAttributeInASCIIfile(HDFattribute *hdf_attribute, ASCIIWriter& out, int ident);
+void SaveGroupInASCIIfile(HDFgroup *hdf_group, ASCIIWriter& out, int ident);
+void SaveDatasetInASCIIfile(HDFdataset *hdf_dataset, ASCIIWriter& out, int ident);
 
 std::string GetTmpDir();
 char* makeName(char* name);
 char* restoreName(char* name);
-void write_float64(FILE* fp, hdf_float64* value);
-void read_float64(FILE* fp, hdf_float64* value);
 
-void WriteSimpleData( FILE* fp, HDFdataset *hdf_dataset, hdf_type type, long size );
+void WriteSimpleData( ASCIIWriter& out, HDFdataset *hdf_dataset, hdf_type type, long size );
 
 #define MAX_STRING_SIZE   65535
 #define MAX_ID_SIZE       20
 #define NB_FLOAT_IN_ROW   3
 #define NB_INTEGER_IN_ROW 9
+#define BUFFER_SIZE       1048576
 
 #define ASCIIHDF_ID  "ASCIIHDF"
 #define ATTRIBUTE_ID "ATTRIBUTE"
@@ -81,6 +85,202 @@ void WriteSimpleData( FILE* fp, HDFdataset *hdf_dataset, hdf_type type, long siz
 #define DATASET_ID_END   "DATASET_END"
 #define GROUP_ID_END     "GROUP_END"
 
+//============================================================================
+// class    : ASCIIWriter
+// purpose  : Buffered output of the ASCII format, the numbers are formatted
+//            by hand into the buffer (same text as the former fprintf calls)
+//============================================================================
+class ASCIIWriter
+{
+public:
+  ASCIIWriter(FILE* fp) : _fp(fp), _buffer(BUFFER_SIZE), _pos(0) {}
+  ~ASCIIWriter() { Flush(); }
+
+  void Flush()
+  {
+    if (_pos) fwrite(&_buffer[0], 1, _pos, _fp);
+    _pos = 0;
+  }
+
+  ASCIIWriter& Put(char c)
+  {
+    if (_pos == BUFFER_SIZE) Flush();
+    _buffer[_pos++] = c;
+    return *this;
+  }
+
+  ASCIIWriter& Put(const char* s) { return Put(s, strlen(s)); }
+
+  ASCIIWriter& Put(const char* s, size_t n)
+  {
+    if (n > BUFFER_SIZE - _pos) {
+      Flush();
+      if (n >= BUFFER_SIZE) {
+        fwrite(s, 1, n, _fp);
+        return *this;
+      }
+    }
+    memcpy(&_buffer[_pos], s, n);
+    _pos += n;
+    return *this;
+  }
+
+  // "%li"
+  ASCIIWriter& Int(long v)
+  {
+    char tmp[24];
+    char* end = tmp + sizeof(tmp);
+    char* p = end;
+    unsigned long u = v < 0 ? 0UL - (unsigned long)v : (unsigned long)v;
+    do {
+      *--p = (char)('0' + u % 10);
+      u /= 10;
+    } while (u);
+    if (v < 0) *--p = '-';
+    return Put(p, end - p);
+  }
+
+  // the bytes of the value in hexadecimal, each one as " %2x"
+  ASCIIWriter& Float64(hdf_float64 v)
+  {
+    static const char digits[] = "0123456789abcdef";
+    const unsigned char* array = (const unsigned char*)&v;
+    char tmp[3*sizeof(hdf_float64)];
+    for (size_t i = 0; i < sizeof(hdf_float64); i++) {
+      tmp[3*i] = ' ';
+      tmp[3*i+1] = array[i] < 16 ? ' ' : digits[array[i] >> 4];
+      tmp[3*i+2] = digits[array[i] & 15];
+    }
+    return Put(tmp, sizeof(tmp));
+  }
+
+private:
+  FILE* _fp;
+  std::vector<char> _buffer;
+  size_t _pos;
+};
+
+//============================================================================
+// class    : ASCIIReader
+// purpose  : Buffered input of the ASCII format, with the semantic of the
+//            former fscanf calls ("%s", "%li", " %x", "%c" and fread)
+//============================================================================
+class ASCIIReader
+{
+public:
+  ASCIIReader(FILE* fp) : _fp(fp), _buffer(BUFFER_SIZE), _pos(0), _end(0) {}
+
+  int Peek()
+  {
+    if (_pos == _end && !Fill()) return EOF;
+    return (unsigned char)_buffer[_pos];
+  }
+
+  int Get()
+  {
+    int c = Peek();
+    if (c != EOF) _pos++;
+    return c;
+  }
+
+  void SkipSpaces()
+  {
+    for (int c = Peek(); IsSpace(c); c = Peek())
+      _pos++;
+  }
+
+  // "%s", truncated to size-1 characters
+  bool Word(char* word, size_t size)
+  {
+    SkipSpaces();
+    size_t n = 0;
+    for (int c = Peek(); c != EOF && !IsSpace(c); c = Peek()) {
+      if (n + 1 < size) word[n++] = (char)c;
+      _pos++;
+    }
+    word[n] = 0;
+    return n > 0;
+  }
+
+  // "%li", nothing is consumed but the spaces if there is no number
+  bool Int(long& v)
+  {
+    SkipSpaces();
+    bool negative = false;
+    int c = Peek();
+    if (c == '-' || c == '+') {
+      negative = (c == '-');
+      _pos++;
+      c = Peek();
+    }
+    if (c < '0' || c > '9') return false;
+    unsigned long u = 0;
+    for (; c >= '0' && c <= '9'; c = Peek()) {
+      u = u * 10 + (c - '0');
+      _pos++;
+    }
+    v = negative ? (long)(0UL - u) : (long)u;
+    return true;
+  }
+
+  bool Int(int& v)
+  {
+    long l;
+    if (!Int(l)) return false;
+    v = (int)l;
+    return true;
+  }
+
+  // eight times " %x"
+  bool Float64(hdf_float64& v)
+  {
+    unsigned char* array = (unsigned char*)&v;
+    for (size_t i = 0; i < sizeof(hdf_float64); i++) {
+      SkipSpaces();
+      unsigned value = 0;
+      int c = Peek(), n = 0;
+      for (; ; c = Peek(), n++) {
+        if (c >= '0' && c <= '9') value = value * 16 + (c - '0');
+        else if (c >= 'a' && c <= 'f') value = value * 16 + (c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') value = value * 16 + (c - 'A' + 10);
+        else break;
+        _pos++;
+      }
+      if (!n) return false;
+      array[i] = (unsigned char)value;
+    }
+    return true;
+  }
+
+  // fread
+  size_t Raw(char* data, size_t size)
+  {
+    size_t n = _end - _pos < size ? _end - _pos : size;
+    memcpy(data, &_buffer[_pos], n);
+    _pos += n;
+    if (n < size)
+      n += fread(data + n, 1, size - n, _fp);
+    return n;
+  }
+
+private:
+  static bool IsSpace(int c)
+  {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+  }
+
+  bool Fill()
+  {
+    _pos = 0;
+    _end = fread(&_buffer[0], 1, BUFFER_SIZE, _fp);
+    return _end > 0;
+  }
+
+  FILE* _fp;
+  std::vector<char> _buffer;
+  size_t _pos, _end;
+};
+
 
 //============================================================================
 // function : isASCII
@@ -129,39 +329,43 @@ char* HDFascii::ConvertFromHDFToASCII(const char* thePath,
   HDFfile *hdf_file = new HDFfile((char*)thePath); 
   hdf_file->OpenOnDisk(HDF_RDONLY);
 
-  char name[HDF_NAME_MAX_LEN+1];
   int nbsons = hdf_file->nInternalObjects(), nbAttr = hdf_file->nAttributes(); 
 
   FILE* fp = fopen(aFileName.c_str(), "wb");
-  fprintf(fp, "%s\n", ASCIIHDF_ID);
-  fprintf(fp, "%i\n", nbsons+nbAttr);
+  ASCIIWriter out(fp);
+  out.Put(ASCIIHDF_ID).Put('\n');
+  out.Int(nbsons+nbAttr).Put('\n');
 
   for(int j=0; j<nbAttr; j++) {
     char* attr_name = hdf_file->GetAttributeName(j);
     HDFattribute *hdf_attribute = new HDFattribute(attr_name, hdf_file);
     delete attr_name;
-    SaveAttributeInASCIIfile(hdf_attribute, fp, 0);
+    SaveAttributeInASCIIfile(hdf_attribute, out, 0);
     hdf_attribute = 0;
   }
 
+  std::vector<char> names(nbsons*(HDF_NAME_MAX_LEN+1)+1);
+  hdf_file->InternalObjectsIndentify(nbsons, &names[0]);
+
   for (int i=0; i<nbsons; i++) {
-    hdf_file->InternalObjectIndentify(i,name);
+    char* name = &names[i*(HDF_NAME_MAX_LEN+1)];
     if (strncmp(name, "INTERNAL_COMPLEX",16) == 0) continue;
 
     hdf_object_type type = hdf_file->InternalObjectType(name);
 
     if(type == HDF_DATASET) { 
       HDFdataset* hdf_dataset = new HDFdataset(name, hdf_file);
-      SaveDatasetInASCIIfile(hdf_dataset, fp, 0);
+      SaveDatasetInASCIIfile(hdf_dataset, out, 0);
       hdf_dataset = 0; 
     } else if(type == HDF_GROUP) {
       HDFgroup *hdf_group = new HDFgroup(name, hdf_file); 
-      SaveGroupInASCIIfile(hdf_group, fp, 0);
+      SaveGroupInASCIIfile(hdf_group, out, 0);
       hdf_group = 0;
     }
   }
 
-  fprintf(fp, "%s", ASCIIHDF_ID_END);
+  out.Put(ASCIIHDF_ID_END);
+  out.Flush();
 
   fclose(fp);
 
@@ -187,31 +391,32 @@ char* HDFascii::ConvertFromHDFToASCII(const char* thePath,
 // function : SaveGroupInASCIIfile
 // purpose  : 
 //============================================================================
-void SaveGroupInASCIIfile(HDFgroup *hdf_group, FILE* fp, int ident)
+void SaveGroupInASCIIfile(HDFgroup *hdf_group, ASCIIWriter& out, int ident)
 {
   hdf_group->OpenOnDisk();
 
   int nbsons = hdf_group->nInternalObjects(), nbAttr = hdf_group->nAttributes(); 
 
-  fprintf(fp, "%s\n", GROUP_ID);
+  out.Put(GROUP_ID).Put('\n');
 
   char* name = makeName(hdf_group->GetName());
 
-  fprintf(fp, "%s %i\n", name, nbsons+nbAttr);
+  out.Put(name).Put(' ').Int(nbsons+nbAttr).Put('\n');
   delete [] name;
 
   for(int j=0; j<nbAttr; j++) {
     name = hdf_group->GetAttributeName(j);
     HDFattribute *hdf_attribute = new HDFattribute(name, hdf_group);
     delete [] name;
-    SaveAttributeInASCIIfile(hdf_attribute, fp, ident+1);
+    SaveAttributeInASCIIfile(hdf_attribute, out, ident+1);
     hdf_attribute = 0;
   }
 
-  char objName[HDF_NAME_MAX_LEN+1];
+  std::vector<char> names(nbsons*(HDF_NAME_MAX_LEN+1)+1);
+  hdf_group->InternalObjectsIndentify(nbsons, &names[0]);
  
   for (int i=0; i<nbsons; i++) {
-    hdf_group->InternalObjectIndentify(i, objName);
+    char* objName = &names[i*(HDF_NAME_MAX_LEN+1)];
 
     if (strncmp(objName, "INTERNAL_COMPLEX",16) == 0)  continue;
 
@@ -219,16 +424,16 @@ void SaveGroupInASCIIfile(HDFgroup *hdf_group, FILE* fp, int ident)
 
     if  (type == HDF_DATASET) {
       HDFdataset* hdf_dataset = new HDFdataset(objName, hdf_group);
-      SaveDatasetInASCIIfile(hdf_dataset, fp, ident+1);
+      SaveDatasetInASCIIfile(hdf_dataset, out, ident+1);
       hdf_dataset = 0;
     } else if (type == HDF_GROUP)   {      
       HDFgroup *hdf_subgroup = new HDFgroup(objName, hdf_group);
-      SaveGroupInASCIIfile(hdf_subgroup, fp, ident+1);
+      SaveGroupInASCIIfile(hdf_subgroup, out, ident+1);
       hdf_subgroup = 0;
     } 
   }
 
-  fprintf(fp, "%s\n", GROUP_ID_END);
+  out.Put(GROUP_ID_END).Put('\n');
 
   hdf_group->CloseOnDisk();  
 }
@@ -237,7 +442,7 @@ void SaveGroupInASCIIfile(HDFgroup *hdf_group, FILE* fp, int ident)
 // function : SaveDatasetInASCIIfile
 // purpose  : 
 //============================================================================
-void SaveDatasetInASCIIfile(HDFdataset *hdf_dataset, FILE* fp, int ident)
+void SaveDatasetInASCIIfile(HDFdataset *hdf_dataset, ASCIIWriter& out, int ident)
 {
   hdf_dataset->OpenOnDisk();
 
@@ -250,55 +455,55 @@ void SaveDatasetInASCIIfile(HDFdataset *hdf_dataset, FILE* fp, int ident)
 
   char* name = makeName(hdf_dataset->GetName());
 
-  fprintf(fp, "%s\n", DATASET_ID);
-  fprintf(fp, "%s %i %i\n", name, type, nbAttr);
+  out.Put(DATASET_ID).Put('\n');
+  out.Put(name).Put(' ').Int(type).Put(' ').Int(nbAttr).Put('\n');
   delete [] name;
 
   hdf_dataset->GetDim(dim);
-  fprintf(fp, " %li\n", ndim);
+  out.Put(' ').Int(ndim).Put('\n');
 
   for(int i = 0;i < ndim;i++) {
-    fprintf(fp, " %lu", (unsigned long)dim[i]);
+    out.Put(' ').Int((long)dim[i]);
   }
 
-  fprintf(fp, "\n");
+  out.Put('\n');
   delete [] dim;
 
-  fprintf(fp, "%li %i:", size, order);
+  out.Int(size).Put(' ').Int(order).Put(':');
   if( type == HDF_ARRAY ) {
     HDFarray *array = new HDFarray(hdf_dataset);
     hdf_type data_type = array->GetDataType();
-    fprintf(fp, "\n" );
-    fprintf(fp, " %i\n", data_type ); //Write array data type
+    out.Put('\n');
+    out.Put(' ').Int(data_type).Put('\n'); //Write array data type
 
     //Write nDim of the array
     int arr_ndim = array->nDim();
-    fprintf(fp, " %i\n", arr_ndim);
+    out.Put(' ').Int(arr_ndim).Put('\n');
     hdf_size *arr_dim = new hdf_size[arr_ndim];
     array->GetDim(arr_dim);
 
     for( int i = 0;i < arr_ndim; i++ ) {
-      fprintf(fp, " %lu", (unsigned long)arr_dim[i]);
+      out.Put(' ').Int((long)arr_dim[i]);
     }
         
     //And write the data array
-    WriteSimpleData( fp, hdf_dataset, data_type, size);
+    WriteSimpleData( out, hdf_dataset, data_type, size);
   } else {
-    WriteSimpleData( fp, hdf_dataset, type, size);
+    WriteSimpleData( out, hdf_dataset, type, size);
   }
   
-  fprintf(fp, "\n");
+  out.Put('\n');
 
   for ( int j=0; j<nbAttr; j++ )
   {
     name = hdf_dataset->GetAttributeName(j);
     HDFattribute *hdf_attribute = new HDFattribute(name, hdf_dataset);
     delete [] name;
-    SaveAttributeInASCIIfile(hdf_attribute, fp, ident+1);
+    SaveAttributeInASCIIfile(hdf_attribute, out, ident+1);
     hdf_attribute = 0;
   }
 
-  fprintf(fp, "%s\n", DATASET_ID_END);
+  out.Put(DATASET_ID_END).Put('\n');
 
   hdf_dataset->CloseOnDisk(); 
 }
@@ -308,7 +513,7 @@ void SaveDatasetInASCIIfile(HDFdataset *hdf_dataset, FILE* fp, int ident)
 // function : SaveAttributeInASCIIfile
 // purpose  : 
 //============================================================================
-void SaveAttributeInASCIIfile(HDFattribute *hdf_attribute, FILE* fp, int /*ident*/)
+void SaveAttributeInASCIIfile(HDFattribute *hdf_attribute, ASCIIWriter& out, int /*ident*/)
 {
   hdf_attribute->OpenOnDisk();
 
@@ -317,34 +522,34 @@ void SaveAttributeInASCIIfile(HDFattribute *hdf_attribute, FILE* fp, int /*ident
   char* name = makeName(hdf_attribute->GetName());
   size_t size = hdf_attribute->GetSize();
 
-  fprintf(fp, "%s\n", ATTRIBUTE_ID);
-  fprintf(fp, "%s %i %lu\n", name, type, size);
+  out.Put(ATTRIBUTE_ID).Put('\n');
+  out.Put(name).Put(' ').Int(type).Put(' ').Int((long)size).Put('\n');
 
   delete [] name;
 
   if (type == HDF_STRING) {    
     char* val = new char[size+1];
     hdf_attribute->ReadFromDisk(val);
-    fprintf(fp, ":");
-    fwrite(val, 1, size, fp);
-    fprintf(fp, "\n");
+    out.Put(':');
+    out.Put(val, size);
+    out.Put('\n');
     delete [] val;
   } else if (type == HDF_FLOAT64) {
     hdf_float64 val;
     hdf_attribute->ReadFromDisk(&val);
-    write_float64(fp, &val);
-    fprintf(fp, "\n");
+    out.Float64(val);
+    out.Put('\n');
   } else if(type == HDF_INT64) {
     hdf_int64 val;
     hdf_attribute->ReadFromDisk(&val);
-    fprintf(fp, "%li \n", val);
+    out.Int(val).Put(" \n");
   } else if(type == HDF_INT32) {
     hdf_int32 val;
     hdf_attribute->ReadFromDisk(&val);
-    fprintf(fp, "%i \n", val);
+    out.Int(val).Put(" \n");
   }
 
-  fprintf(fp, "%s\n", ATTRIBUTE_ID_END);
+  out.Put(ATTRIBUTE_ID_END).Put('\n');
 
   hdf_attribute->CloseOnDisk();  
 }
@@ -378,33 +583,94 @@ char* HDFascii::ConvertFromASCIIToHDF(const char* thePath,
   HDFfile *hdf_file = new HDFfile((char*)aFullName.c_str()); 
   hdf_file->CreateOnDisk();
   
-  char type[9];
-  int nbsons, i;
-  fscanf(fp, "%s", type);
-  fscanf(fp, "%i",&nbsons);
+  ASCIIReader in(fp);
+  bool isOk = CreateFileFromASCII(hdf_file, in);
+  fclose(fp);
+  if(!isOk) return NULL;
 
-  if(strcmp(type, ASCIIHDF_ID) != 0) return NULL;
+  hdf_file->CloseOnDisk();
+  delete hdf_file;
+
+  if(isReplace) {
+    if(Exists(aFullName))
+      Move(aFullName, thePath);
+    else 
+      return NULL;
+  }
+
+  size_t length = strlen(aTmpDir.c_str());
+  char *new_str = new char[ 1+length ];
+  strcpy(new_str , aTmpDir.c_str()) ;
+
+  return new_str;
+}
+
+//============================================================================
+// function : LoadFromASCII
+// purpose  : Builds in memory the HDF file described by the ASCII file thePath,
+//            nothing is written on disk
+//            Returns the HDF file, opened, or NULL in case of failure
+//============================================================================
+HDFfile* HDFascii::LoadFromASCII(const char* thePath)
+{
+  FILE *fp = fopen(thePath, "rb");
+  if(!fp) return NULL;
+
+  HDFfile *hdf_file = new HDFfile((char*)thePath);
+  try {
+    hdf_file->CreateInMemory();
+  }
+  catch (HDFexception) {
+    fclose(fp);
+    delete hdf_file;
+    return NULL;
+  }
+
+  ASCIIReader in(fp);
+  bool isOk = CreateFileFromASCII(hdf_file, in);
+  fclose(fp);
+  if(!isOk) {
+    hdf_file->CloseOnDisk();
+    delete hdf_file;
+    return NULL;
+  }
+
+  return hdf_file;
+}
+
+
+//============================================================================
+// function : CreateFileFromASCII
+// purpose  : Fills a HDF file with the content of an ASCII file
+//============================================================================
+bool CreateFileFromASCII(HDFfile *hdf_file, ASCIIReader& in)
+{
+  char type[MAX_ID_SIZE];
+  int nbsons, i;
+  in.Word(type, MAX_ID_SIZE);
+  if(strcmp(type, ASCIIHDF_ID) != 0) return false;
+  if(!in.Int(nbsons)) return false;
 
   for(i = 0; i < nbsons; i++) {
     char id_of_begin[MAX_ID_SIZE];
-    fscanf(fp, "%s\n", id_of_begin);
+    in.Word(id_of_begin, MAX_ID_SIZE);
 
     if(strcmp(id_of_begin, GROUP_ID) == 0) {
-      if(!CreateGroupFromASCII(hdf_file, fp)) {
+      if(!CreateGroupFromASCII(hdf_file, in)) {
 	std::cout << "ConvertFromASCIIToHDF : Can not create group number " << i << std::endl;
-	return NULL;
+	return false;
       }
     }
     else if(strcmp(id_of_begin, DATASET_ID) == 0) {
-      if(!CreateDatasetFromASCII(hdf_file, fp)) {
+      if(!CreateDatasetFromASCII(hdf_file, in)) {
 	std::cout << "ConvertFromASCIIToHDF :Can not create dataset number " << i << std::endl;
-	return NULL;
+	return false;
       }
     }
     else if(strcmp(id_of_begin, ATTRIBUTE_ID) == 0) {
-      if(!CreateAttributeFromASCII(hdf_file, fp)) {
+      if(!CreateAttributeFromASCII(hdf_file, in)) {
 	std::cout << "ConvertFromASCIIToHDF :Can not create attribute number " << i << std::endl;
-	return NULL;
+	return false;
       }
     }
     else 
@@ -412,29 +678,13 @@ char* HDFascii::ConvertFromASCIIToHDF(const char* thePath,
   }
 
   char id_of_end[MAX_ID_SIZE];
-  fscanf(fp, "%s", id_of_end);
+  in.Word(id_of_end, MAX_ID_SIZE);
   if(strcmp(id_of_end, ASCIIHDF_ID_END) != 0) {
     std::cout << "ConvertFromASCIIToHDF : Can not find the end ASCII token " << std::endl;
-    return NULL;  
+    return false;  
   }
 
-  hdf_file->CloseOnDisk();
-  delete hdf_file;
-
-  if(isReplace) {
-    if(Exists(aFullName))
-      Move(aFullName, thePath);
-    else 
-      return NULL;
-  }
-
-  size_t length = strlen(aTmpDir.c_str());
-  char *new_str = new char[ 1+length ];
-  strcpy(new_str , aTmpDir.c_str()) ;
-
-  fclose(fp);
-
-  return new_str;
+  return true;
 }
 
 
@@ -442,12 +692,12 @@ char* HDFascii::ConvertFromASCIIToHDF(const char* thePath,
 // function : CreateGroupFromASCII
 // purpose  : Creates a HDF group from a set attributes situated under theLabel
 //============================================================================
-bool CreateGroupFromASCII(HDFcontainerObject *father, FILE *fp)
+bool CreateGroupFromASCII(HDFcontainerObject *father, ASCIIReader& in)
 {
   char name[HDF_NAME_MAX_LEN+1];
   int nbsons, i;
-  fscanf(fp, "%s %i\n", name, &nbsons);  
-
+  in.Word(name, HDF_NAME_MAX_LEN+1);
+  if(!in.Int(nbsons)) return false;
   char* new_name = restoreName(name);
 
   HDFgroup* hdf_group = new HDFgroup(new_name, father);
@@ -458,22 +708,22 @@ bool CreateGroupFromASCII(HDFcontainerObject *father, FILE *fp)
 
   for(i = 0; i < nbsons; i++) {
     char id_of_begin[MAX_ID_SIZE];
-    fscanf(fp, "%s\n", id_of_begin);
+    in.Word(id_of_begin, MAX_ID_SIZE);
     
     if(strcmp(id_of_begin, GROUP_ID) == 0) {
-      if(!CreateGroupFromASCII(hdf_group, fp)) {
+      if(!CreateGroupFromASCII(hdf_group, in)) {
 	std::cout << "Can not create subgroup " << i << " for group " << name << std::endl;
 	return false;
       }
     }
     else if(strcmp(id_of_begin, DATASET_ID) == 0) {
-      if(!CreateDatasetFromASCII(hdf_group, fp)) {
+      if(!CreateDatasetFromASCII(hdf_group, in)) {
 	std::cout << "Can not create dataset " << i << " for group " << name << std::endl;
 	return false;
       }
     }
     else if(strcmp(id_of_begin, ATTRIBUTE_ID) == 0) {
-      if(!CreateAttributeFromASCII(hdf_group, fp)) {
+      if(!CreateAttributeFromASCII(hdf_group, in)) {
 	std::cout << "Can not create attribute " << i << " for group " << name << std::endl;
 	return false;
       }
@@ -486,7 +736,7 @@ bool CreateGroupFromASCII(HDFcontainerObject *father, FILE *fp)
   hdf_group = 0; //will be deleted by father destructor
 
   char id_of_end[MAX_ID_SIZE];
-  fscanf(fp, "%s\n", id_of_end);
+  in.Word(id_of_end, MAX_ID_SIZE);
   if(strcmp(id_of_end, GROUP_ID_END) != 0) {
     std::cout << "CreateGroupFromASCII : Invalid end token : " << id_of_end << std::endl;
     return false;
@@ -500,7 +750,7 @@ bool CreateGroupFromASCII(HDFcontainerObject *father, FILE *fp)
 // function : CreateDatasetFromASCII
 // purpose  : Creates a HDF dataset from a set attributes situated under theLabel
 //============================================================================
-bool CreateDatasetFromASCII(HDFcontainerObject *father, FILE *fp)
+bool CreateDatasetFromASCII(HDFcontainerObject *father, ASCIIReader& in)
 {
   char name[HDF_NAME_MAX_LEN+1];
   int type;
@@ -508,25 +758,22 @@ bool CreateDatasetFromASCII(HDFcontainerObject *father, FILE *fp)
   int nbDim, nbAttr;
   long i, size;
 
-  fscanf(fp, "%s %i %i\n", name, &type, &nbAttr);
+  in.Word(name, HDF_NAME_MAX_LEN+1);
+  if(!in.Int(type) || !in.Int(nbAttr) || !in.Int(nbDim)) return false;
   char* new_name = restoreName(name);
 
-  fscanf(fp, "%i\n", &nbDim);
-
   hdf_size* sizeArray = new hdf_size[nbDim];
-  int dim = 0;
+  long dim = 0;
   for(i = 0; i<nbDim; i++) {
-    fscanf(fp, "%i\n", &dim);
+    in.Int(dim);
     sizeArray[i] = dim;
   }
  
    // order (2-d member) was not written in earlier versions
-  char tmp;
-  int nbRead = fscanf(fp, "%li %i%c", &size, &order, &tmp);
-  if ( nbRead < 2 ) { // fscanf stops before ":"
-    fscanf(fp, "%c", &tmp);
+  in.Int(size);
+  if ( !in.Int(order) ) // stops before ":"
     order = H5T_ORDER_NONE;
-  }
+  in.Get(); // ":"
   if ( type != HDF_FLOAT64 )  // use order only for FLOAT64
     order = H5T_ORDER_NONE;
 
@@ -536,14 +783,14 @@ bool CreateDatasetFromASCII(HDFcontainerObject *father, FILE *fp)
     //Get array information
     int arr_data_type;
     int arr_ndim;
-    fscanf(fp, "%c", &tmp);
-    fscanf(fp, " %i\n", &arr_data_type ); //Get array data type
-    fscanf(fp, " %i\n", &arr_ndim ); //Get array nDim
+    in.Get();
+    in.Int(arr_data_type); //Get array data type
+    in.Int(arr_ndim); //Get array nDim
     hdf_size *arr_dim = new hdf_size[arr_ndim];
 
-    int tdim = 0;
+    long tdim = 0;
     for( int i = 0;i < arr_ndim; i++ ) {
-      fscanf(fp, " %i", &tdim);
+      in.Int(tdim);
       arr_dim[i] = tdim;
     }
     anArray = new HDFarray(0, (hdf_type)arr_data_type, arr_ndim, arr_dim);
@@ -565,34 +812,36 @@ bool CreateDatasetFromASCII(HDFcontainerObject *father, FILE *fp)
 
   if (type == HDF_STRING) {	
     char *val = new char[size+1];
-    fread(val, 1, size, fp);
+    in.Raw(val, size);
     hdf_dataset->WriteOnDisk(val);
     delete [] val;
   } else if (type == HDF_FLOAT64) {
     hdf_float64* val = new hdf_float64[size];
     for(i=0; i<size; i++) {
-      read_float64(fp, &(val[i]));
+      in.Float64(val[i]);
     }
     hdf_dataset->WriteOnDisk(val);
     delete [] val;
   } else if(type == HDF_INT64) {
     hdf_int64* val = new hdf_int64[size];
     for(i=0; i<size; i++) {
-      fscanf(fp, " %li", &(val[i]));
+      in.Int(val[i]);
     }
     hdf_dataset->WriteOnDisk(val);
     delete [] val;
   } else if(type == HDF_INT32) {
     hdf_int32* val = new hdf_int32[size];
     for(i=0; i<size; i++) {
-      fscanf(fp, " %i", &(val[i]));
+      in.Int(val[i]);
     }
     hdf_dataset->WriteOnDisk(val);
     delete [] val;
   } else if(type == HDF_CHAR) {
     hdf_char* val = new hdf_char[size];
     for(i=0; i<size; i++) {
-      fscanf(fp, " %c", &(val[i]));
+      long c = 0; // written as numbers by WriteSimpleData
+      in.Int(c);
+      val[i] = (hdf_char)c;
     }
     hdf_dataset->WriteOnDisk(val);
     delete [] val;
@@ -601,10 +850,10 @@ bool CreateDatasetFromASCII(HDFcontainerObject *father, FILE *fp)
   char token[MAX_ID_SIZE];
 
   for(i = 0; i < nbAttr; i++) {
-    fscanf(fp, "%s\n", token);
+    in.Word(token, MAX_ID_SIZE);
     
     if(strcmp(token, ATTRIBUTE_ID) == 0) {
-      if(!CreateAttributeFromASCII(hdf_dataset, fp)) {
+      if(!CreateAttributeFromASCII(hdf_dataset, in)) {
 	std::cout << "Can not create attribute " << i << " for dataset " << name << std::endl;
 	return false;
       }
@@ -615,7 +864,7 @@ bool CreateDatasetFromASCII(HDFcontainerObject *father, FILE *fp)
     }
   }
   
-  fscanf(fp, "%s\n", token);
+  in.Word(token, MAX_ID_SIZE);
   if(strcmp(token, DATASET_ID_END) != 0) {
     std::cout << "CreateDatasetFromASCII : Invalid end token : " << token << std::endl;
     return false;
@@ -637,13 +886,14 @@ bool CreateDatasetFromASCII(HDFcontainerObject *father, FILE *fp)
 // function : CreateAttributeFromASCII
 // purpose  : Creates a HDF attribute from a set attributes situated under theLabel
 //============================================================================
-bool CreateAttributeFromASCII(HDFinternalObject *father, FILE* fp)
+bool CreateAttributeFromASCII(HDFinternalObject *father, ASCIIReader& in)
 {
   char name[HDF_NAME_MAX_LEN+1];
 
   int type;
   int size;
-  fscanf(fp, "%s %i %i\n", name, &type, &size);
+  in.Word(name, HDF_NAME_MAX_LEN+1);
+  if(!in.Int(type) || !in.Int(size)) return false;
   char* new_name = restoreName(name);
   HDFattribute* hdf_attribute = new HDFattribute(new_name, father, (hdf_type)type, size);
 
@@ -652,24 +902,24 @@ bool CreateAttributeFromASCII(HDFinternalObject *father, FILE* fp)
   delete [] new_name;
   
   if (type == HDF_STRING) {	
-    char tmp;
-    fscanf(fp, "%c", &tmp);
+    in.SkipSpaces();
+    in.Get(); // ":"
     char *val = new char[size+1];
     val[size] = (char)0;
-    fread(val, 1, size, fp);
+    in.Raw(val, size);
     hdf_attribute->WriteOnDisk(val);
     delete [] val;
   } else if (type == HDF_FLOAT64) {
     hdf_float64 val;
-    read_float64(fp, &val);
+    in.Float64(val);
     hdf_attribute->WriteOnDisk(&val);
   } else if(type == HDF_INT64) {
     hdf_int64 val;
-    fscanf(fp, "%li", &val);
+    in.Int(val);
     hdf_attribute->WriteOnDisk(&val);
   } else if(type == HDF_INT32) {
     hdf_int32 val;
-    fscanf(fp, "%i", &val);
+    in.Int(val);
     hdf_attribute->WriteOnDisk(&val);
   }
   
@@ -678,7 +928,7 @@ bool CreateAttributeFromASCII(HDFinternalObject *father, FILE* fp)
 
 
   char id_of_end[MAX_ID_SIZE];
-  fscanf(fp, "%s\n", id_of_end);
+  in.Word(id_of_end, MAX_ID_SIZE);
   if(strcmp(id_of_end, ATTRIBUTE_ID_END) != 0) {
     std::cout << "CreateAttributeFromASCII : Invalid end token : " << id_of_end << std::endl;
     return false;
@@ -787,25 +1037,6 @@ char* restoreName(char* name)
   return new_str;
 }
 
-void write_float64(FILE* fp, hdf_float64* value)
-{
-  unsigned char* array = (unsigned char*)value;
-  for(int i = 0; i < (int)sizeof(hdf_float64); i++) {
-    unsigned tmp = (unsigned short)array[i];
-    fprintf(fp, " %2x", tmp);
-  }
-}
-
-void read_float64(FILE* fp, hdf_float64* value)
-{
-  unsigned char* array = (unsigned char*)value;
-  for(int i = 0; i < (int)sizeof(hdf_float64); i++) {
-    unsigned tmp;
-    fscanf(fp, " %x", &tmp); 
-    array[i] = (unsigned char)tmp;
-  }
-}
-
 bool Exists(const std::string thePath) 
 {
 #ifdef WIN32 
@@ -842,33 +1073,33 @@ void Move(const std::string& fName, const std::string& fNameDst)
 #endif
 }
 
-void WriteSimpleData( FILE* fp, HDFdataset *hdf_dataset, hdf_type type, long size ) {
+void WriteSimpleData( ASCIIWriter& out, HDFdataset *hdf_dataset, hdf_type type, long size ) {
   if (type == HDF_STRING) {	
     char* val = new char[size];
     hdf_dataset->ReadFromDisk(val);
-    fwrite(val, 1, size, fp);
+    out.Put(val, size);
     delete [] val;
   } else if (type == HDF_FLOAT64) {
     hdf_float64* val = new hdf_float64[size];
     hdf_dataset->ReadFromDisk(val);
-    fprintf(fp, "\n");
+    out.Put('\n');
     for (int i = 0, j = 0; i < size; i++) {
-      write_float64(fp, &val[i]);
+      out.Float64(val[i]);
       if(++j == NB_FLOAT_IN_ROW) {
-	fprintf(fp, "\n");
+	out.Put('\n');
 	j = 0;
       }
-      else fprintf(fp,"  ");
+      else out.Put("  ", 2);
     }
     delete [] val;
   } else if(type == HDF_INT64) {
     hdf_int64* val = new hdf_int64[size];
     hdf_dataset->ReadFromDisk(val);
-    fprintf(fp, "\n");
+    out.Put('\n');
     for (int i = 0, j = 0; i < size; i++) {
-      fprintf(fp, " %li", val[i]);
+      out.Put(' ').Int(val[i]);
       if(++j == NB_INTEGER_IN_ROW) {
-	fprintf(fp, "\n");
+	out.Put('\n');
 	j = 0;
       }
     }
@@ -876,11 +1107,11 @@ void WriteSimpleData( FILE* fp, HDFdataset *hdf_dataset, hdf_type type, long siz
   } else if(type == HDF_INT32) {
     hdf_int32* val = new hdf_int32[size];
     hdf_dataset->ReadFromDisk(val);
-    fprintf(fp, "\n");
+    out.Put('\n');
     for (int i = 0, j = 0; i < size; i++) {
-      fprintf(fp, " %i", val[i]);
+      out.Put(' ').Int(val[i]);
       if(++j == NB_INTEGER_IN_ROW) {
-	fprintf(fp, "\n");
+	out.Put('\n');
 	j = 0;
       }
     }
@@ -888,11 +1119,11 @@ void WriteSimpleData( FILE* fp, HDFdataset *hdf_dataset, hdf_type type, long siz
   }else if(type == HDF_CHAR) {
     hdf_char* val = new hdf_char[size];
     hdf_dataset->ReadFromDisk(val);
-    fprintf(fp, "\n");
+    out.Put('\n');
     for (int i = 0, j = 0; i < size; i++) {
-      fprintf(fp, " %i", val[i]);
+      out.Put(' ').Int(val[i]);
       if(++j == NB_INTEGER_IN_ROW) {
-	fprintf(fp, "\n");
+	out.Put('\n');
 	j = 0;
       }
     }
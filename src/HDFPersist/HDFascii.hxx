@@ -31,6 +31,7 @@
 
 #include "HDFexport.hxx"
 
+class HDFfile;
 
 class HDFPERSIST_EXPORT HDFascii                                
 {
@@ -42,6 +43,8 @@ public:
                                      
   static char* ConvertFromASCIIToHDF(const char* thePath, 
                                      bool isReplaced = false);
+
+  static HDFfile* LoadFromASCII(const char* thePath);
   
   static bool isASCII(const char* thePath);
 };
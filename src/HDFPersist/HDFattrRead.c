@@ -41,16 +41,15 @@ SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
 hdf_err HDFattrRead(hdf_idt id,void *val)
 {
   hdf_err ret = -1;
-  hdf_idt type_hdf;
+  hdf_idt type_hdf, mem_type;
   
   if ((type_hdf = H5Aget_type(id)) >= 0) {
-#if defined (PCLINUX) || defined (PCLINUX64)
-    if ((H5Tget_class(type_hdf) == H5T_INTEGER) && (H5Tget_size(type_hdf) == 4)) 
-      type_hdf = H5T_NATIVE_INT;
-#endif 
-    ret = H5Aread(id, type_hdf, val);
+    if ((mem_type = HDFmemType(type_hdf)) >= 0) {
+      ret = H5Aread(id, mem_type, val);
+      H5Tclose(mem_type);
+    }
+    H5Tclose(type_hdf);
   }
 
-  H5Tclose(type_hdf);
   return ret;
 }
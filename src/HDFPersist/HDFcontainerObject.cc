@@ -28,12 +28,15 @@
 #include "HDFcontainerObject.hxx"
 #include "HDFexception.hxx"
 
+#include <string.h>
+
 HDFcontainerObject::HDFcontainerObject(const char *name)
   : HDFinternalObject(name)
 {
   _nsons = 0;
   _firstson = NULL;
   _lastson = NULL;
+  memset(&_storage, 0, sizeof(_storage));
 }
 
 HDFcontainerObject::~HDFcontainerObject()
@@ -56,6 +59,12 @@ void HDFcontainerObject::InternalObjectIndentify(int /*rank*/, char* /*object_na
 {
 }
 
+void HDFcontainerObject::InternalObjectsIndentify(int n, char *object_names)
+{
+  for (int i = 0; i < n; i++)
+    InternalObjectIndentify(i, object_names + i * (HDF_NAME_MAX_LEN+1));
+}
+
 void HDFcontainerObject::AddSon(HDFinternalObject *son)
 {
   if (_nsons == 0)
@@ -86,3 +95,13 @@ int HDFcontainerObject::nSons()
 {
   return _nsons;
 }
+
+void HDFcontainerObject::SetStorage(const hdf_storage& storage)
+{
+  _storage = storage;
+}
+
+const hdf_storage& HDFcontainerObject::GetStorage()
+{
+  return _storage;
+}
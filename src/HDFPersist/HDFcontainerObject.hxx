@@ -38,16 +38,23 @@ private :
   HDFinternalObject *_firstson;
   HDFinternalObject *_lastson;
   int _nsons;
+  hdf_storage _storage;
 public :
   HDFcontainerObject(const char *name);
   virtual ~HDFcontainerObject();
 
   virtual int nInternalObjects();
   virtual void InternalObjectIndentify(int rank, char *object_name);
+  // names of the n first internal objects, HDF_NAME_MAX_LEN+1 bytes each
+  virtual void InternalObjectsIndentify(int n, char *object_names);
   
   void AddSon(HDFinternalObject *son);
   HDFinternalObject *GetFirstSon();
   HDFinternalObject *GetLastSon();
   int nSons();
+
+  // Storage policy (chunks, compression) of the datasets and groups created in this container
+  void SetStorage(const hdf_storage& storage);
+  const hdf_storage& GetStorage();
 };
 #endif
@@ -60,6 +60,7 @@ HDFdataset::HDFdataset(const char *name, HDFcontainerObject *father,hdf_type typ
       _size = _size * _dim[i];
     }
   _arrayId = -1;
+  _storage = _father->GetStorage();
 }
 
 
@@ -76,6 +77,7 @@ HDFdataset::HDFdataset(const char *name,HDFcontainerObject *father)
   _size = -1;
   _attribute = NULL;
   _arrayId = -1;
+  _storage = _father->GetStorage();
 }
 
 HDFdataset::~HDFdataset()
@@ -85,10 +87,22 @@ HDFdataset::~HDFdataset()
 
 void HDFdataset::CreateOnDisk()
 {
-  if ((_id = HDFdatasetCreate(_fid,_name,_type,_dim,_ndim,_byte_order,_arrayId)) < 0)
+  if ((_id = HDFdatasetCreate(_fid,_name,_type,_dim,_ndim,_byte_order,_arrayId,&_storage)) < 0)
     throw HDFexception("Can't create dataset");
 }
 
+// Creates an empty one dimension dataset of bytes (HDF_STRING) stored by chunks of chunk
+// bytes, filled with AppendOnDisk
+void HDFdataset::CreateChunkedOnDisk(hdf_size chunk)
+{
+  if (_ndim != 1)
+    throw HDFexception("Can't create chunked dataset");
+  if ((_id = HDFdatasetCreateChunked(_fid,_name,_type,chunk,&_storage)) < 0)
+    throw HDFexception("Can't create chunked dataset");
+  _dim[0] = 0;
+  _size = 0;
+}
+
 void HDFdataset::OpenOnDisk()
 {
   if ((_id = HDFdatasetOpen(_fid,_name)) < 0)
@@ -113,6 +127,38 @@ void HDFdataset::WriteOnDisk(void *values)
  
 }
 
+// Writes the block of count[i] elements starting at start[i] in each dimension i,
+// values holds the block in C order
+void HDFdataset::WriteOnDisk(void *values, hdf_size start[], hdf_size count[])
+{
+  hdf_err ret;
+
+  if ((ret = HDFdatasetWriteSlab(_id,start,count,values)) < 0)
+    throw HDFexception("Can't write dataset");
+}
+
+// Writes count elements of a one dimension dataset starting at element offset
+void HDFdataset::WriteOnDisk(void *values, hdf_size offset, hdf_size count)
+{
+  if (nDim() != 1)
+    throw HDFexception("Can't write dataset");
+  WriteOnDisk(values,&offset,&count);
+}
+
+// Writes count elements at the end of a dataset created by CreateChunkedOnDisk
+void HDFdataset::AppendOnDisk(void *values, hdf_size count)
+{
+  hdf_err ret;
+
+  if (count == 0)
+    return;
+  if ((ret = HDFdatasetExtend(_id,_dim[0]+count)) < 0)
+    throw HDFexception("Can't extend dataset");
+  WriteOnDisk(values,_dim[0],count);
+  _dim[0] += count;
+  _size = _dim[0];
+}
+
 void HDFdataset::ReadFromDisk(void *values)
 {
   hdf_err ret;
@@ -121,6 +167,24 @@ void HDFdataset::ReadFromDisk(void *values)
       throw HDFexception("Can't read dataset");
 }
 
+// Reads the block of count[i] elements starting at start[i] in each dimension i,
+// values receives the block in C order
+void HDFdataset::ReadFromDisk(void *values, hdf_size start[], hdf_size count[])
+{
+  hdf_err ret;
+
+  if ((ret = HDFdatasetReadSlab(_id,start,count,values)) < 0)
+    throw HDFexception("Can't read dataset");
+}
+
+// Reads count elements of a one dimension dataset starting at element offset
+void HDFdataset::ReadFromDisk(void *values, hdf_size offset, hdf_size count)
+{
+  if (nDim() != 1)
+    throw HDFexception("Can't read dataset");
+  ReadFromDisk(values,&offset,&count);
+}
+
 HDFcontainerObject *HDFdataset::GetFather()
 {
   return _father;
@@ -231,3 +295,8 @@ char* HDFdataset::GetAttributeName(unsigned idx)
 void HDFdataset::SetArrayId(hdf_idt arrayId) {
   _arrayId = arrayId;
 }
+
+// Overrides the storage policy inherited from the father, to be called before CreateOnDisk
+void HDFdataset::SetStorage(const hdf_storage& storage) {
+  _storage = storage;
+}
@@ -44,6 +44,7 @@ private :
   int _ndim;
   char* _attribute;
   hdf_idt _arrayId;
+  hdf_storage _storage;
 
 public:
   HDFdataset(const char *name, HDFcontainerObject *father,hdf_type type, 
@@ -53,11 +54,17 @@ public:
   virtual ~HDFdataset();
 
   void CreateOnDisk();
+  void CreateChunkedOnDisk(hdf_size chunk);
   void OpenOnDisk();
   void CloseOnDisk();
 
   void WriteOnDisk(void *values);
+  void WriteOnDisk(void *values, hdf_size start[], hdf_size count[]);
+  void WriteOnDisk(void *values, hdf_size offset, hdf_size count);
+  void AppendOnDisk(void *values, hdf_size count);
   void ReadFromDisk(void *values);
+  void ReadFromDisk(void *values, hdf_size start[], hdf_size count[]);
+  void ReadFromDisk(void *values, hdf_size offset, hdf_size count);
 
   HDFcontainerObject *GetFather();
   hdf_type GetType();
@@ -68,6 +75,7 @@ public:
   hdf_byte_order GetOrder();
 
   void SetArrayId(hdf_idt arrayId);
+  void SetStorage(const hdf_storage& storage);
 
   int nAttributes();
   char* GetAttributeName(unsigned idx);
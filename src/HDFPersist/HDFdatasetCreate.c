@@ -34,18 +34,20 @@ SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
  * - Parameters :
  *     - pid  (IN)     : father ID
  *     - name (IN)     : dataset name
- *     - type (IN)     : dataset type (HDF_STRING,HDF_INT32,HDF_INT64,HDF_FLOAT64)
+ *     - type (IN)     : dataset type (HDF_STRING,HDF_INT32,HDF_INT64,HDF_FLOAT64,HDF_CHAR)
  *     - dimd (IN)     : dataset size
  *     - order(IN)     : byte order (H5T_ORDER_NONE, H5T_ORDER_LE, H5T_ORDER_BE)
+ *     - storage(IN)   : storage policy (chunks, compression), NULL for a contiguous dataset
  * - Result : 
  *     - if success : returns dataset ID
  *     - if failure : -1
  */ 
 
 hdf_idt HDFdatasetCreate(hdf_idt pid,char *name,hdf_type type,
-                         hdf_size *dimd, int ndim, hdf_byte_order order, hdf_idt arrayId)
+                         hdf_size *dimd, int ndim, hdf_byte_order order, hdf_idt arrayId,
+                         const hdf_storage *storage)
 {
-  hdf_idt dataset, dataspace = 0;
+  hdf_idt dataset, dataspace = 0, plist;
   hdf_err ret;
   hdf_idt type_hdf = -1, new_type_hdf = -1;
 
@@ -71,6 +73,10 @@ hdf_idt HDFdatasetCreate(hdf_idt pid,char *name,hdf_type type,
       type_hdf = H5T_NATIVE_LONG;
       break;
 
+    case HDF_CHAR :
+      type_hdf = H5T_NATIVE_CHAR;
+      break;
+
     case HDF_STRING :           
       if((new_type_hdf = H5Tcopy(H5T_C_S1)) < 0)
         return -1;
@@ -101,9 +107,16 @@ hdf_idt HDFdatasetCreate(hdf_idt pid,char *name,hdf_type type,
     {
       if ((dataspace = H5Screate_simple(ndim, dimd, NULL)) < 0)                                                         
         return -1;
-      if ((dataset = H5Dcreate(pid,name,
-                               new_type_hdf < 0 ? type_hdf : new_type_hdf,
-                               dataspace, H5P_DEFAULT)) < 0)
+      if ((plist = HDFdatasetCreatePlist(storage,
+                                         new_type_hdf < 0 ? type_hdf : new_type_hdf,
+                                         dimd, ndim, NULL)) < 0)
+        return -1;
+      dataset = H5Dcreate(pid,name,
+                          new_type_hdf < 0 ? type_hdf : new_type_hdf,
+                          dataspace, plist);
+      if (plist != H5P_DEFAULT)
+        H5Pclose(plist);
+      if (dataset < 0)
         return -1;
     }
   else
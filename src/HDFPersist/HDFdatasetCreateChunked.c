@@ -0,0 +1,91 @@
+/* Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+ *
+ * Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+ * CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ * See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+ */
+
+/*----------------------------------------------------------------------------
+SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
+  File   : HDFdatasetCreateChunked.c
+  Module : SALOME
+----------------------------------------------------------------------------*/
+
+#include "hdfi.h"
+
+/*
+ * - Name : HDFdatasetCreateChunked
+ * - Description : creates an empty one dimension HDF dataset stored by chunks,
+ *                 that can be extended later (see HDFdatasetExtend)
+ * - Parameters :
+ *     - pid   (IN)     : father ID
+ *     - name  (IN)     : dataset name
+ *     - type  (IN)     : dataset type (only HDF_STRING, a stream of bytes)
+ *     - chunk (IN)     : number of elements of a chunk
+ *     - storage (IN)   : compression of the chunks, may be NULL (see HDFdatasetCreatePlist)
+ * - Result : 
+ *     - if success : returns dataset ID
+ *     - if failure : -1
+ */ 
+
+hdf_idt HDFdatasetCreateChunked(hdf_idt pid,char *name,hdf_type type,hdf_size chunk,
+                                const hdf_storage *storage)
+{
+  hdf_idt dataset, dataspace, plist, type_hdf;
+  hdf_size dimd[1], maxd[1];
+  hdf_err ret;
+
+  if (type != HDF_STRING || chunk == 0)
+    return -1;
+
+  if ((dataset = H5Dopen(pid,name)) >= 0)
+    {
+      H5Dclose(dataset);
+      return -1;
+    }
+
+  if ((type_hdf = H5Tcopy(H5T_C_S1)) < 0)
+    return -1;
+  if ((ret = H5Tset_size(type_hdf,1)) < 0)
+    {
+      H5Tclose(type_hdf);
+      return -1;
+    }
+
+  dimd[0] = 0;
+  maxd[0] = H5S_UNLIMITED;
+  if ((dataspace = H5Screate_simple(1, dimd, maxd)) < 0)
+    {
+      H5Tclose(type_hdf);
+      return -1;
+    }
+  if ((plist = HDFdatasetCreatePlist(storage, type_hdf, dimd, 1, &chunk)) < 0)
+    {
+      H5Sclose(dataspace);
+      H5Tclose(type_hdf);
+      return -1;
+    }
+
+  dataset = H5Dcreate(pid,name,type_hdf,dataspace,plist);
+
+  H5Pclose(plist);
+  H5Sclose(dataspace);
+  H5Tclose(type_hdf);
+
+  return dataset < 0 ? -1 : dataset;
+}
@@ -0,0 +1,160 @@
+/* Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+ *
+ * Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+ * CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ * See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+ */
+
+/*----------------------------------------------------------------------------
+SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
+  File   : HDFdatasetCreatePlist.c
+  Module : SALOME
+----------------------------------------------------------------------------*/
+
+#include "hdfi.h"
+
+#define HDF_DEFAULT_CHUNK_BYTES 1048576
+
+/* falls back to deflate, then to no compression, if the filter is not usable */
+static hdf_filter HDFavailableFilter(hdf_filter filter, hdf_idt type_hdf, hdf_size chunk_size)
+{
+  unsigned int config = 0;
+
+  if (filter == HDF_ZSTD && H5Zfilter_avail(HDF_FILTER_ZSTD) <= 0)
+    filter = HDF_DEFLATE;
+  if (filter == HDF_SZIP)
+    {
+      /* szip does not encode strings nor blocks smaller than 32 elements */
+      if (H5Zfilter_avail(H5Z_FILTER_SZIP) <= 0 ||
+          H5Zget_filter_info(H5Z_FILTER_SZIP, &config) < 0 ||
+          !(config & H5Z_FILTER_CONFIG_ENCODE_ENABLED) ||
+          H5Tget_class(type_hdf) == H5T_STRING || chunk_size < 32)
+        filter = HDF_DEFLATE;
+    }
+  if (filter == HDF_DEFLATE && H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0)
+    filter = HDF_NO_FILTER;
+  return filter;
+}
+
+/*
+ * - Name : HDFdatasetCreatePlist
+ * - Description : builds the creation property list of a dataset according
+ *                 to a storage policy
+ * - Parameters :
+ *     - storage  (IN)     : storage policy, may be NULL
+ *     - type_hdf (IN)     : HDF5 type of the dataset elements
+ *     - dimd     (IN)     : dataset size
+ *     - ndim     (IN)     : dataset rank
+ *     - chunkd   (IN)     : chunk shape imposed by the caller (extendible
+ *                           datasets), NULL to follow the policy
+ * - Result : 
+ *     - if success : returns H5P_DEFAULT for a contiguous dataset, the ID
+ *                    of a property list to close with H5Pclose otherwise
+ *     - if failure : -1
+ */ 
+
+hdf_idt HDFdatasetCreatePlist(const hdf_storage *storage, hdf_idt type_hdf,
+                              hdf_size *dimd, int ndim, hdf_size *chunkd)
+{
+  hdf_idt plist;
+  hdf_size chunk[H5S_MAX_RANK];
+  hdf_size total, elem, chunk_size;
+  size_t typesize;
+  hdf_filter filter;
+  hdf_err ret = 0;
+  unsigned int cd_values[1];
+  int i;
+
+  if ((typesize = H5Tget_size(type_hdf)) == 0 || ndim > H5S_MAX_RANK)
+    return -1;
+
+  if (chunkd == NULL)
+    {
+      if (storage == NULL || ndim < 1)
+        return H5P_DEFAULT;
+      if (storage->filter == HDF_NO_FILTER && storage->nchunk == 0)
+        return H5P_DEFAULT;
+
+      total = typesize;
+      for (i = 0; i < ndim; i++)
+        total *= dimd[i];
+      if (total == 0 || total < storage->min_bytes)
+        return H5P_DEFAULT;
+
+      if (storage->nchunk == ndim)
+        for (i = 0; i < ndim; i++)
+          chunk[i] = storage->chunk[i] == 0 ? 1 :
+                     (storage->chunk[i] < dimd[i] ? storage->chunk[i] : dimd[i]);
+      else
+        {
+          /* fill the chunk from the fastest varying dimension */
+          elem = (storage->chunk_bytes ? storage->chunk_bytes : HDF_DEFAULT_CHUNK_BYTES) / typesize;
+          for (i = ndim-1; i >= 0; i--)
+            {
+              chunk[i] = elem == 0 ? 1 : (elem < dimd[i] ? elem : dimd[i]);
+              elem /= chunk[i];
+            }
+        }
+      chunkd = chunk;
+    }
+
+  chunk_size = 1;
+  for (i = 0; i < ndim; i++)
+    chunk_size *= chunkd[i];
+
+  if ((plist = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+    return -1;
+  if (H5Pset_chunk(plist, ndim, chunkd) < 0)
+    {
+      H5Pclose(plist);
+      return -1;
+    }
+
+  filter = storage == NULL ? HDF_NO_FILTER :
+           HDFavailableFilter(storage->filter, type_hdf, chunk_size);
+  if (filter != HDF_NO_FILTER && storage->shuffle)
+    ret = H5Pset_shuffle(plist);
+
+  switch (filter)
+    {
+    case HDF_DEFLATE :
+      if (ret >= 0)
+        ret = H5Pset_deflate(plist, storage->level > 0 ? storage->level : 6);
+      break;
+    case HDF_SZIP :
+      if (ret >= 0)
+        ret = H5Pset_szip(plist, H5_SZIP_NN_OPTION_MASK, 32);
+      break;
+    case HDF_ZSTD :
+      /* optional : a chunk which does not compress is stored as is */
+      cd_values[0] = storage->level > 0 ? storage->level : 3;
+      if (ret >= 0)
+        ret = H5Pset_filter(plist, HDF_FILTER_ZSTD, H5Z_FLAG_OPTIONAL, 1, cd_values);
+      break;
+    default :
+      break;
+    }
+
+  if (ret < 0)
+    {
+      H5Pclose(plist);
+      return -1;
+    }
+
+  return plist;
+}
@@ -0,0 +1,51 @@
+/* Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+ *
+ * Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+ * CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ * See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+ */
+
+/*----------------------------------------------------------------------------
+SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
+  File   : HDFdatasetExtend.c
+  Module : SALOME
+----------------------------------------------------------------------------*/
+
+#include "hdfi.h"
+
+/*
+ * - Name : HDFdatasetExtend
+ * - Description : changes the size of a one dimension dataset created by
+ *                 HDFdatasetCreateChunked
+ * - Parameters :
+ *     - id   (IN)     : dataset ID
+ *     - size (IN)     : new number of elements of the dataset
+ * - Result : 
+ *     - if success : 0
+ *     - if failure : -1
+ */ 
+hdf_err HDFdatasetExtend(hdf_idt id, hdf_size size)
+{
+  hdf_size dimd[1];
+
+  dimd[0] = size;
+  if (H5Dset_extent(id, dimd) < 0)
+    return -1;
+
+  return 0;
+}
@@ -29,12 +29,27 @@ SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
 #include <hdf5.h>
 #include "hdfi.h"
 
+/* size in bytes of the data, which differs from the size of its storage
+   when the dataset is chunked or compressed */
 long HDFdatasetGetSize(hdf_idt id)
 {
-  hdf_size size;
+  hdf_idt space, type;
+  hssize_t npoints;
+  size_t size;
 
-  if ((long)(size = H5Dget_storage_size(id)) < 0)
+  if ((space = H5Dget_space(id)) < 0)
+    return -1;
+  npoints = H5Sget_simple_extent_npoints(space);
+  H5Sclose(space);
+  if (npoints < 0)
+    return -1;
+
+  if ((type = H5Dget_type(id)) < 0)
+    return -1;
+  size = H5Tget_size(type);
+  H5Tclose(type);
+  if (size == 0)
     return -1;
 
-  return (long) size;
+  return (long) npoints * (long) size;
 }
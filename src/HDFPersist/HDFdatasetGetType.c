@@ -43,7 +43,9 @@ HDFdatasetGetType(hdf_idt id)
     {
     case H5T_INTEGER :
       size = H5Tget_size(type_id);
-      if (size == 4)
+      if (size == 1)
+        type = HDF_CHAR;
+      else if (size == 4)
         type = HDF_INT32;
       else
         type = HDF_INT64;
@@ -40,19 +40,18 @@ SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
  */ 
 hdf_err HDFdatasetRead(hdf_idt id, void *val)
 {
-  hdf_idt datatype;
+  hdf_idt datatype, memtype;
   hdf_err ret;
 
   if ((datatype = H5Dget_type(id)) < 0)
     return -1;
-
-/*#if defined (PCLINUX) || defined (PCLINUX64)*/
-  if ((H5Tget_class(datatype) == H5T_INTEGER) && (H5Tget_size(datatype) == 4)) 
-    datatype = H5T_NATIVE_INT;
-/*#endif*/
-
-  if ((ret = H5Dread(id,datatype,H5S_ALL,H5S_ALL,H5P_DEFAULT, val)) < 0)
+  memtype = HDFmemType(datatype);
+  H5Tclose(datatype);
+  if (memtype < 0)
     return -1;
 
-  return 0;
+  ret = H5Dread(id, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, val);
+  H5Tclose(memtype);
+
+  return ret < 0 ? -1 : 0;
 }
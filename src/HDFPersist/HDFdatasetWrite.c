@@ -27,62 +27,32 @@ SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
 ----------------------------------------------------------------------------*/
 
 #include "hdfi.h"
-#include <stdlib.h>
 
 /*
  * - Name : _MEDdatasetWrite
  * - Description : writes a HDF dataset
  * - Parameters :
  *     - id  (IN)     : dataset ID
- *     - val  (IN)    : datset values
+ *     - val  (IN)    : datset values, left untouched (HDF5 converts
+ *                      them to the file type in its own buffers)
  * - Result : 
  *     - if success : 0
  *     - if failure : -1
  */ 
 hdf_err HDFdatasetWrite(hdf_idt id, void *val)
 {
-  hdf_idt datatype;
+  hdf_idt datatype, memtype;
   hdf_err ret;
-#if defined (PCLINUX) || defined (PCLINUX64)
-  int i, ndim;
-  hdf_size *dim;
-  int isI32BE = 0;
-  int size = 0;
-#endif
 
   if ((datatype = H5Dget_type(id)) < 0)
     return -1;
-
-#if defined (PCLINUX) || defined (PCLINUX64)
-  if((H5Tget_class(datatype) == H5T_INTEGER) && (H5Tget_size(datatype) == 4)) {
-    isI32BE = 1; /* See HDFdatasetCreate */
-
-    /*SRN : bug IPAL9619:  replaced the method of getting the size of INT32 dataset */ 
-
-    ndim = HDFdatasetGetnDim(id);
-    if(ndim < 0) return -1;
-    
-    dim = (hdf_size *) malloc(sizeof(hdf_size)*ndim);
-    if ((ret = HDFdatasetGetDim(id, dim)) < 0)  return -1;
-        
-    for(i=0; i<ndim; i++) size+=dim[i];    
-    free(dim);
-    /*SRN : end of the fix */
-    
-    if(size == 0) 
-      return -1;
-    if(H5Tconvert(H5T_NATIVE_INT, H5T_STD_I32BE, size, (void *)val, NULL, (hid_t)0) < 0) 
-      return -1;
-  }
-#endif
-
-  if ((ret = H5Dwrite(id, datatype, H5S_ALL, H5S_ALL, H5P_DEFAULT, val)) < 0) 
+  memtype = HDFmemType(datatype);
+  H5Tclose(datatype);
+  if (memtype < 0)
     return -1;
 
-#if defined (PCLINUX) || defined (PCLINUX64)
-  if (isI32BE && (H5Tconvert(H5T_STD_I32BE, H5T_NATIVE_INT, size, (void *)val, NULL, (hid_t)0) < 0)) 
-    return -1;
-#endif
+  ret = H5Dwrite(id, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, val);
+  H5Tclose(memtype);
 
-  return 0;
+  return ret < 0 ? -1 : 0;
 }
@@ -0,0 +1,84 @@
+/* Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+ *
+ * Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+ * CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ * See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+ */
+
+/*----------------------------------------------------------------------------
+SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
+  File   : HDFdatasetWriteSlab.c
+  Module : SALOME
+----------------------------------------------------------------------------*/
+
+#include "hdfi.h"
+
+/*
+ * - Name : HDFdatasetWriteSlab
+ * - Description : writes a block (hyperslab) of a HDF dataset
+ * - Parameters :
+ *     - id    (IN)     : dataset ID
+ *     - start (IN)     : index of the first element of the block in each dimension
+ *     - count (IN)     : size of the block in each dimension
+ *     - val   (IN)     : values of the block, in C order, left untouched
+ * - Result : 
+ *     - if success : 0
+ *     - if failure : -1
+ */ 
+hdf_err HDFdatasetWriteSlab(hdf_idt id, hdf_size *start, hdf_size *count, void *val)
+{
+  hdf_idt datatype, memtype, filespace, memspace;
+  hdf_err ret = -1;
+  int i, ndim;
+
+  if ((filespace = H5Dget_space(id)) < 0)
+    return -1;
+  if ((ndim = H5Sget_simple_extent_ndims(filespace)) < 0)
+    {
+      H5Sclose(filespace);
+      return -1;
+    }
+  for (i = 0; i < ndim; i++)
+    if (count[i] == 0)
+      {
+        H5Sclose(filespace);
+        return 0;
+      }
+
+  if ((datatype = H5Dget_type(id)) < 0)
+    {
+      H5Sclose(filespace);
+      return -1;
+    }
+  memtype = HDFmemType(datatype);
+  H5Tclose(datatype);
+
+  if (memtype >= 0 && (memspace = H5Screate_simple(ndim, count, NULL)) >= 0)
+    {
+      if (H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, NULL, count, NULL) >= 0 &&
+          H5Dwrite(id, memtype, memspace, filespace, H5P_DEFAULT, val) >= 0)
+        ret = 0;
+      H5Sclose(memspace);
+    }
+
+  if (memtype >= 0)
+    H5Tclose(memtype);
+  H5Sclose(filespace);
+
+  return ret;
+}
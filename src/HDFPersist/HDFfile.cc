@@ -56,6 +56,14 @@ void HDFfile::CreateOnDisk()
     throw HDFexception("Can't create HDF file");
 }
 
+// the file only lives in memory, the name is not used on disk
+void HDFfile::CreateInMemory()
+{
+  _access_mode = HDF_RDWR;
+  if ((_id = HDFfileCreateInMemory(_name)) < 0) 
+    throw HDFexception("Can't create HDF file in memory");
+}
+
 void HDFfile::OpenOnDisk(hdf_access_mode access_mode)
 {
 	_access_mode = access_mode;
@@ -129,6 +137,12 @@ void HDFfile::InternalObjectIndentify(int rank, char *object_name)
     throw HDFexception("Can't identify an internal object");
 }
 
+void HDFfile::InternalObjectsIndentify(int n, char *object_names)
+{
+  if (HDFobjectIdentifyAll(_id,"/",n,object_names) < 0)
+    throw HDFexception("Can't identify the internal objects");
+}
+
 int HDFfile::ExistInternalObject(const char *object_name)
 {
   int n,i;
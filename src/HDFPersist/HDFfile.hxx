@@ -40,6 +40,7 @@ public :
   HDFfile(char *name);
 
   void CreateOnDisk();
+  void CreateInMemory();
   void OpenOnDisk(hdf_access_mode acess_mode);
   void CloseOnDisk();
 
@@ -48,6 +49,7 @@ public :
 
   int nInternalObjects();
   void InternalObjectIndentify(int rank, char *object_name);
+  void InternalObjectsIndentify(int n, char *object_names);
   int ExistInternalObject(const char *object_name);
   hdf_object_type InternalObjectType(char *object_name);
 
@@ -0,0 +1,63 @@
+/* Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+ *
+ * Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+ * CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ * See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+ */
+
+/*----------------------------------------------------------------------------
+SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
+  File   : HDFfileCreateInMemory.c
+  Module : SALOME
+----------------------------------------------------------------------------*/
+
+#include "hdfi.h"
+#include <hdf5.h>
+
+/* memory is allocated by increments of this size */
+#define HDF_CORE_INCREMENT 1048576
+
+/*
+ * - Name : HDFfileCreateInMemory
+ * - Description : creates a HDF file held in memory, nothing is
+ *                 written on disk, even when the file is closed
+ * - Parameters :
+ *     - name (IN) : file name
+ * - Result : 
+ *     - success : file ID
+ *     - failure : -1 
+ */ 
+hdf_idt HDFfileCreateInMemory(char *name)
+{
+  hdf_idt fid, fapl;
+
+  if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+    return -1;
+
+  if (H5Pset_fapl_core(fapl,HDF_CORE_INCREMENT,0) < 0) {
+    H5Pclose(fapl);
+    return -1;
+  }
+
+  fid = H5Fcreate(name,H5F_ACC_TRUNC,H5P_DEFAULT,fapl);
+  H5Pclose(fapl);
+  if (fid < 0)
+    return -1;
+
+  return fid;
+}
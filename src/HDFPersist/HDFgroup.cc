@@ -42,6 +42,7 @@ HDFgroup::HDFgroup(const char *name, HDFcontainerObject *father)
   _father = father;
   _fid = _father->GetId();
   _father->AddSon(this);
+  SetStorage(_father->GetStorage());
   _mid = -1;
   _attribute = NULL;
 }
@@ -96,6 +97,12 @@ void HDFgroup::InternalObjectIndentify(int rank, char *object_name)
     throw HDFexception("Can't identify an internal object");
 }
 
+void HDFgroup::InternalObjectsIndentify(int n, char *object_names)
+{
+  if (HDFobjectIdentifyAll(_fid,_name,n,object_names) < 0)
+    throw HDFexception("Can't identify the internal objects");
+}
+
 int HDFgroup::ExistInternalObject(const char *object_name)
 {
   int n,i;
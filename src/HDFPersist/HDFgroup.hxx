@@ -56,6 +56,7 @@ class HDFPERSIST_EXPORT HDFgroup : public HDFcontainerObject
 
   int  nInternalObjects();
   void InternalObjectIndentify(int rank, char *object_name);
+  void InternalObjectsIndentify(int n, char *object_names);
   int  ExistInternalObject(const char *object_name);
   hdf_object_type InternalObjectType(char *object_name);
   void GetAllObjects( std::vector< std::string > & object_names );
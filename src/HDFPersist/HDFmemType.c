@@ -0,0 +1,50 @@
+/* Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+ *
+ * Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+ * CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ * See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+ */
+
+/*----------------------------------------------------------------------------
+SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
+  File   : HDFmemType.c
+  Module : SALOME
+----------------------------------------------------------------------------*/
+
+#include "hdfi.h"
+
+/*
+ * - Name : HDFmemType
+ * - Description : returns the memory type used to read or write values
+ *                 stored with a given file type; HDF5 converts the values
+ *                 between both types in its own buffers
+ *                 (32 bits integers are stored big endian on Linux, see
+ *                 HDFdatasetCreate; the other types are transferred as is)
+ * - Parameters :
+ *     - file_type (IN)  : type of a dataset or of an attribute
+ * - Result : 
+ *     - if success : type ID, to close with H5Tclose
+ *     - if failure : -1
+ */ 
+hdf_idt HDFmemType(hdf_idt file_type)
+{
+  if ((H5Tget_class(file_type) == H5T_INTEGER) && (H5Tget_size(file_type) == 4))
+    return H5Tcopy(H5T_NATIVE_INT);
+
+  return H5Tcopy(file_type);
+}
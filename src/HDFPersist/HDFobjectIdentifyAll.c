@@ -0,0 +1,78 @@
+/* Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+ *
+ * Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+ * CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+ *
+ * See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+ */
+
+/*----------------------------------------------------------------------------
+SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
+  File   : HDFobjectIdentifyAll.c
+  Module : SALOME
+----------------------------------------------------------------------------*/
+
+#include "hdfi.h"
+#include <string.h>
+
+/*
+ * - Name: HDFobjectIdentifyAll
+ * - Description : find the names of the n first HDF objects of the HDF
+ *     group "path" in one pass, where n calls of HDFobjectIdentify would
+ *     iterate over the group n times
+ * - Parameters :
+ *     - fid     (IN)     : file ID
+ *     - path  (IN)       : group access path
+ *     - n (IN)           : number of names
+ *     - names (OUT)      : expected names, HDF_NAME_MAX_LEN+1 bytes each
+ * - Result : 
+ *     - if success : 0
+ *     - if failure : -1
+ */ 
+
+typedef struct {
+  int n;
+  int count;
+  char *names;
+} hdf_names;
+
+static hdf_err NamesInfo(hdf_idt id, const char *name, void *data)
+{
+  hdf_names *names = (hdf_names*)data;
+  (void)id;
+
+  strncpy(names->names + names->count * (HDF_NAME_MAX_LEN+1), name, HDF_NAME_MAX_LEN);
+  names->names[names->count * (HDF_NAME_MAX_LEN+1) + HDF_NAME_MAX_LEN] = 0;
+
+  return ++names->count < names->n ? 0 : 1;
+}
+
+hdf_err HDFobjectIdentifyAll(hdf_idt fid,const char *path,int n,char *names)
+{
+  hdf_names data;
+
+  if (n <= 0)
+    return 0;
+
+  data.n = n;
+  data.count = 0;
+  data.names = names;
+  if (H5Giterate(fid,path,NULL,NamesInfo,&data) < 0 || data.count < n)
+    return -1;
+
+  return 0;
+}
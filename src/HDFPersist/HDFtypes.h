@@ -60,6 +60,28 @@ typedef enum {HDF_NONE,HDF_STRING, HDF_INT32, HDF_INT64, HDF_FLOAT64, HDF_CHAR,
    - HDF_ARRAY    : Array
 */
 
+/* Compression filters of HDF datasets */
+typedef enum {HDF_NO_FILTER, HDF_DEFLATE, HDF_SZIP, HDF_ZSTD} hdf_filter;
+/* - HDF_DEFLATE  : gzip, always available in HDF5 builds with zlib
+   - HDF_SZIP     : szip, only if the HDF5 library has it (integers and floats only)
+   - HDF_ZSTD     : zstd, registered filter 32015, needs the HDF5 filter plugin
+   A filter which is not available falls back to HDF_DEFLATE, then to no compression.
+*/
+
+/* identifier of the registered zstd filter */
+#define HDF_FILTER_ZSTD 32015
+
+/* Storage policy of HDF datasets (creation properties) */
+typedef struct {
+  int         nchunk;               /* rank of chunk, 0 : chunk shape computed from the dataset shape */
+  hdf_size    chunk[H5S_MAX_RANK];  /* chunk shape, in elements */
+  hdf_size    chunk_bytes;          /* target size of a computed chunk, 0 : 1 MiB */
+  hdf_size    min_bytes;            /* smaller datasets are stored contiguous and uncompressed */
+  hdf_filter  filter;               /* HDF_NO_FILTER : contiguous storage unless chunk is given */
+  int         level;                /* compression level, 0 : filter default */
+  int         shuffle;              /* shuffle bytes before compression */
+} hdf_storage;
+
 /* HDF object types */
 typedef enum {HDF_OBJECT,HDF_FILE,HDF_GROUP,HDF_DATASET,
               HDF_ATTRIBUTE, HDF_ARRAY_TYPE } hdf_object_type;
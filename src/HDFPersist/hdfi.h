@@ -40,6 +40,9 @@ extern "C" {
 extern
 hdf_idt HDFfileCreate(char *name);
 
+extern
+hdf_idt HDFfileCreateInMemory(char *name);
+
 extern
 hdf_err HDFfileClose(hdf_idt fid);
 
@@ -71,11 +74,29 @@ hdf_err HDFdatasetClose(hdf_idt id);
 
 extern
 hdf_idt HDFdatasetCreate(hdf_idt pid,char *name, hdf_type type,
-                         hdf_size *dimd, int ndim, hdf_byte_order order, hdf_idt arrayId);
+                         hdf_size *dimd, int ndim, hdf_byte_order order, hdf_idt arrayId,
+                         const hdf_storage *storage);
+
+extern
+hdf_idt HDFdatasetCreatePlist(const hdf_storage *storage, hdf_idt type_hdf,
+                              hdf_size *dimd, int ndim, hdf_size *chunkd);
 
 extern
 hdf_err HDFdatasetWrite(hdf_idt id, void *val);
 
+extern
+hdf_idt HDFdatasetCreateChunked(hdf_idt pid,char *name,hdf_type type,hdf_size chunk,
+                                const hdf_storage *storage);
+
+extern
+hdf_err HDFdatasetExtend(hdf_idt id, hdf_size size);
+
+extern
+hdf_err HDFdatasetWriteSlab(hdf_idt id, hdf_size *start, hdf_size *count, void *val);
+
+extern
+hdf_err HDFdatasetReadSlab(hdf_idt id, hdf_size *start, hdf_size *count, void *val);
+
 extern
 hdf_err HDFdatasetRead(hdf_idt id, void *val);
 
@@ -146,8 +167,14 @@ HDFnObjects(hdf_idt fid,const char *path,int *n);
 extern
 hdf_err HDFobjectIdentify(hdf_idt fid,const char *path,int i,char *name);
 
+extern
+hdf_err HDFobjectIdentifyAll(hdf_idt fid,const char *path,int n,char *names);
+
 extern
 hdf_err HDFobjectType(hdf_idt id, char *name, hdf_object_type *type);
+
+extern
+hdf_idt HDFmemType(hdf_idt file_type);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,206 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+// CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
+//  File   : test10.cxx
+//  Module : SALOME
+//
+//  Benchmark of the storage policies of HDFdataset on a synthetic study :
+//  a few big component streams and many small attribute datasets.
+//  Usage : test10 [size in MB, default 1024]
+//
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "HDFOI.hxx"
+
+static const int NB_COMPONENTS = 8;
+static const int NB_ATTRIBUTES = 20000;
+static const char* FILE_NAME = "file_storage.hdf";
+
+// text looking like what the engines and the attributes serialize
+static void fillStream(std::vector<char>& buffer, size_t size, int seed)
+{
+  buffer.resize(size);
+  char line[64];
+  size_t pos = 0;
+  for (long i = seed; pos < size; i++) {
+    int len = sprintf(line, "%ld %.6e %.6e %.6e\n", i, i*0.001, i*0.5+seed, 1.0/(i+1));
+    size_t n = pos + len < size ? len : size - pos;
+    memcpy(&buffer[pos], line, n);
+    pos += n;
+  }
+}
+
+static double seconds(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static long checksum(const std::vector<char>& buffer)
+{
+  long sum = 0;
+  for (size_t i = 0; i < buffer.size(); i += 4093)
+    sum = sum * 31 + buffer[i];
+  return sum + (long)buffer.size();
+}
+
+static void save(const std::vector<char>* streams, const hdf_storage* storage)
+{
+  HDFfile *hdf_file = new HDFfile((char*)FILE_NAME);
+  hdf_file->CreateOnDisk();
+  if (storage)
+    hdf_file->SetStorage(*storage);
+
+  HDFgroup *hdf_group = new HDFgroup("DATACOMPONENT",hdf_file);
+  hdf_group->CreateOnDisk();
+  for (int c = 0; c < NB_COMPONENTS; c++) {
+    char name[32];
+    sprintf(name, "COMPONENT_%d", c);
+    hdf_size size[1] = { streams[c].size() };
+    HDFdataset *hdf_dataset = new HDFdataset(name,hdf_group,HDF_STRING,size,1);
+    hdf_dataset->CreateOnDisk();
+    hdf_dataset->WriteOnDisk((void*)&streams[c][0]);
+    hdf_dataset->CloseOnDisk();
+  }
+  hdf_group->CloseOnDisk();
+
+  hdf_group = new HDFgroup("STUDY_STRUCTURE",hdf_file);
+  hdf_group->CreateOnDisk();
+  for (int a = 0; a < NB_ATTRIBUTES; a++) {
+    char name[32], value[64];
+    sprintf(name, "AttributeName_%d", a);
+    sprintf(value, "object number %d of the study", a);
+    hdf_size size[1] = { strlen(value)+1 };
+    HDFdataset *hdf_dataset = new HDFdataset(name,hdf_group,HDF_STRING,size,1);
+    hdf_dataset->CreateOnDisk();
+    hdf_dataset->WriteOnDisk(value);
+    hdf_dataset->CloseOnDisk();
+  }
+  hdf_group->CloseOnDisk();
+
+  hdf_file->CloseOnDisk();
+  delete hdf_file;
+}
+
+static long load()
+{
+  long sum = 0;
+  HDFfile *hdf_file = new HDFfile((char*)FILE_NAME);
+  hdf_file->OpenOnDisk(HDF_RDONLY);
+
+  HDFgroup *hdf_group = new HDFgroup("DATACOMPONENT",hdf_file);
+  hdf_group->OpenOnDisk();
+  for (int c = 0; c < NB_COMPONENTS; c++) {
+    char name[32];
+    sprintf(name, "COMPONENT_%d", c);
+    HDFdataset *hdf_dataset = new HDFdataset(name,hdf_group);
+    hdf_dataset->OpenOnDisk();
+    std::vector<char> buffer(hdf_dataset->GetSize());
+    hdf_dataset->ReadFromDisk(&buffer[0]);
+    hdf_dataset->CloseOnDisk();
+    sum += checksum(buffer);
+  }
+  hdf_group->CloseOnDisk();
+
+  hdf_group = new HDFgroup("STUDY_STRUCTURE",hdf_file);
+  hdf_group->OpenOnDisk();
+  for (int a = 0; a < NB_ATTRIBUTES; a++) {
+    char name[32], value[64];
+    sprintf(name, "AttributeName_%d", a);
+    HDFdataset *hdf_dataset = new HDFdataset(name,hdf_group);
+    hdf_dataset->OpenOnDisk();
+    hdf_dataset->ReadFromDisk(value);
+    hdf_dataset->CloseOnDisk();
+    sum += value[0];
+  }
+  hdf_group->CloseOnDisk();
+
+  hdf_file->CloseOnDisk();
+  delete hdf_file;
+  return sum;
+}
+
+int main(int argc, char** argv)
+{
+  size_t total = (size_t)(argc > 1 ? atol(argv[1]) : 1024) * 1024 * 1024;
+
+  std::vector<char> streams[NB_COMPONENTS];
+  long expected = 0;
+  for (int c = 0; c < NB_COMPONENTS; c++) {
+    fillStream(streams[c], total / NB_COMPONENTS, c * 1000003);
+    expected += checksum(streams[c]);
+  }
+
+  hdf_storage deflate;
+  memset(&deflate, 0, sizeof(deflate));
+  deflate.filter = HDF_DEFLATE;
+  deflate.level = 1;
+  deflate.min_bytes = 4096;
+  hdf_storage shuffled = deflate;
+  shuffled.shuffle = 1;
+  hdf_storage zstd = deflate;
+  zstd.filter = HDF_ZSTD;
+
+  struct { const char* name; const hdf_storage* storage; } policies[] = {
+    { "contiguous", NULL },
+    { "deflate 1", &deflate },
+    { "deflate 1 + shuffle", &shuffled },
+    { "zstd (or deflate)", &zstd }
+  };
+
+  std::cout << std::setw(22) << "policy" << std::setw(12) << "save (s)"
+            << std::setw(12) << "load (s)" << std::setw(14) << "size (MB)" << std::endl;
+  try {
+    for (size_t p = 0; p < sizeof(policies)/sizeof(policies[0]); p++) {
+      remove(FILE_NAME);
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      save(streams, policies[p].storage);
+      double save_time = seconds(start);
+
+      start = std::chrono::steady_clock::now();
+      long sum = load();
+      double load_time = seconds(start);
+
+      struct stat st;
+      stat(FILE_NAME, &st);
+      long attributes = 0;
+      for (int a = 0; a < NB_ATTRIBUTES; a++) attributes += 'o';
+      std::cout << std::setw(22) << policies[p].name << std::setw(12) << save_time
+                << std::setw(12) << load_time << std::setw(14) << st.st_size / 1048576.
+                << (sum == expected + attributes ? "" : "  ** content differs **") << std::endl;
+    }
+  }
+  catch (HDFexception)
+    {
+      std::cout << "!!!! HDFexception" << std::endl;
+      return 1;
+    }
+  remove(FILE_NAME);
+  return 0;
+}
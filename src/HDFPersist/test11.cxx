@@ -0,0 +1,187 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+// CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  SALOME HDFPersist : implementation of HDF persitent ( save/ restore )
+//  File   : test11.cxx
+//  Module : SALOME
+//
+//  Benchmark of the ASCII study format : conversion of a HDF file to ASCII,
+//  conversion back to a HDF file on disk and direct load in memory.
+//  Usage : test11 [number of values in millions, default 8]
+//
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "HDFOI.hxx"
+#include "HDFascii.hxx"
+
+static const int NB_ATTRIBUTES = 20000;
+static const char* FILE_NAME = "file_ascii.hdf";
+static const char* ASCII_NAME = "file_ascii.hdf.asc";
+
+static double seconds(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void save(long size)
+{
+  HDFfile *hdf_file = new HDFfile((char*)FILE_NAME);
+  hdf_file->CreateOnDisk();
+
+  HDFgroup *hdf_group = new HDFgroup("DATACOMPONENT",hdf_file);
+  hdf_group->CreateOnDisk();
+  std::vector<hdf_float64> reals(size);
+  std::vector<hdf_int32> integers(size);
+  for (long i = 0; i < size; i++) {
+    reals[i] = i * 0.001 - 1.0 / (i + 1);
+    integers[i] = (hdf_int32)(i * 7919 - size);
+  }
+  hdf_size dim[1] = { (hdf_size)size };
+  HDFdataset *hdf_dataset = new HDFdataset("REALS",hdf_group,HDF_FLOAT64,dim,1);
+  hdf_dataset->CreateOnDisk();
+  hdf_dataset->WriteOnDisk(&reals[0]);
+  hdf_dataset->CloseOnDisk();
+  hdf_dataset = new HDFdataset("INTEGERS",hdf_group,HDF_INT32,dim,1);
+  hdf_dataset->CreateOnDisk();
+  hdf_dataset->WriteOnDisk(&integers[0]);
+  hdf_dataset->CloseOnDisk();
+  hdf_group->CloseOnDisk();
+
+  hdf_group = new HDFgroup("STUDY_STRUCTURE",hdf_file);
+  hdf_group->CreateOnDisk();
+  for (int a = 0; a < NB_ATTRIBUTES; a++) {
+    char name[32], value[64];
+    sprintf(name, "AttributeName_%d", a);
+    sprintf(value, "object number %d of the study", a);
+    hdf_size size[1] = { strlen(value)+1 };
+    hdf_dataset = new HDFdataset(name,hdf_group,HDF_STRING,size,1);
+    hdf_dataset->CreateOnDisk();
+    hdf_dataset->WriteOnDisk(value);
+    HDFattribute *hdf_attribute = new HDFattribute((char*)"Index",hdf_dataset,HDF_INT64,sizeof(hdf_int64));
+    hdf_attribute->CreateOnDisk();
+    hdf_int64 index = -a;
+    hdf_attribute->WriteOnDisk(&index);
+    hdf_attribute->CloseOnDisk();
+    hdf_dataset->CloseOnDisk();
+  }
+  hdf_group->CloseOnDisk();
+
+  hdf_file->CloseOnDisk();
+  delete hdf_file;
+}
+
+// the file is expected to be opened, it is closed on return
+static bool check(HDFfile *hdf_file, long size)
+{
+  bool ok = true;
+  HDFgroup *hdf_group = new HDFgroup("DATACOMPONENT",hdf_file);
+  hdf_group->OpenOnDisk();
+  std::vector<hdf_float64> reals(size);
+  std::vector<hdf_int32> integers(size);
+  HDFdataset *hdf_dataset = new HDFdataset("REALS",hdf_group);
+  hdf_dataset->OpenOnDisk();
+  hdf_dataset->ReadFromDisk(&reals[0]);
+  hdf_dataset->CloseOnDisk();
+  hdf_dataset = new HDFdataset("INTEGERS",hdf_group);
+  hdf_dataset->OpenOnDisk();
+  hdf_dataset->ReadFromDisk(&integers[0]);
+  hdf_dataset->CloseOnDisk();
+  for (long i = 0; i < size; i++)
+    ok = ok && reals[i] == i * 0.001 - 1.0 / (i + 1) && integers[i] == (hdf_int32)(i * 7919 - size);
+  hdf_group->CloseOnDisk();
+
+  hdf_group = new HDFgroup("STUDY_STRUCTURE",hdf_file);
+  hdf_group->OpenOnDisk();
+  for (int a = 0; a < NB_ATTRIBUTES; a++) {
+    char name[32], value[64], expected[64];
+    sprintf(name, "AttributeName_%d", a);
+    sprintf(expected, "object number %d of the study", a);
+    hdf_dataset = new HDFdataset(name,hdf_group);
+    hdf_dataset->OpenOnDisk();
+    hdf_dataset->ReadFromDisk(value);
+    HDFattribute *hdf_attribute = new HDFattribute((char*)"Index",hdf_dataset);
+    hdf_attribute->OpenOnDisk();
+    hdf_int64 index = 1;
+    hdf_attribute->ReadFromDisk(&index);
+    hdf_attribute->CloseOnDisk();
+    hdf_dataset->CloseOnDisk();
+    ok = ok && strcmp(value, expected) == 0 && index == -a;
+  }
+  hdf_group->CloseOnDisk();
+
+  hdf_file->CloseOnDisk();
+  delete hdf_file;
+  return ok;
+}
+
+int main(int argc, char** argv)
+{
+  long size = (argc > 1 ? atol(argv[1]) : 8) * 1000000;
+
+  try {
+    remove(FILE_NAME);
+    save(size);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    char* aPath = HDFascii::ConvertFromHDFToASCII(FILE_NAME, false);
+    double to_ascii = seconds(start);
+    delete [] aPath;
+
+    start = std::chrono::steady_clock::now();
+    aPath = HDFascii::ConvertFromASCIIToHDF(ASCII_NAME);
+    double to_hdf = seconds(start);
+    std::string aHDFPath = std::string(aPath) + "hdf_from_ascii.hdf";
+    delete [] aPath;
+    HDFfile *hdf_file = new HDFfile((char*)aHDFPath.c_str());
+    hdf_file->OpenOnDisk(HDF_RDONLY);
+    bool converted = check(hdf_file, size);
+    remove(aHDFPath.c_str());
+
+    start = std::chrono::steady_clock::now();
+    hdf_file = HDFascii::LoadFromASCII(ASCII_NAME);
+    double to_memory = seconds(start);
+    bool loaded = hdf_file && check(hdf_file, size);
+
+    struct stat st;
+    stat(ASCII_NAME, &st);
+    std::cout << "ASCII file : " << st.st_size / 1048576. << " MB" << std::endl;
+    std::cout << std::setw(22) << "HDF => ASCII" << std::setw(12) << to_ascii << " s" << std::endl;
+    std::cout << std::setw(22) << "ASCII => HDF file" << std::setw(12) << to_hdf << " s"
+              << (converted ? "" : "  ** content differs **") << std::endl;
+    std::cout << std::setw(22) << "ASCII => memory" << std::setw(12) << to_memory << " s"
+              << (loaded ? "" : "  ** content differs **") << std::endl;
+  }
+  catch (HDFexception)
+    {
+      std::cout << "!!!! HDFexception" << std::endl;
+      return 1;
+    }
+  remove(FILE_NAME);
+  remove(ASCII_NAME);
+  return 0;
+}
@@ -33,6 +33,9 @@
 #include <fstream>
 #include <string>
 #include <cstdlib>
+#include <vector>
+#include <thread>
+#include <chrono>
 
 
 // --- uncomment to have some traces on standard error
@@ -508,6 +511,74 @@ LifeCycleCORBATest::testFindOrLoad_Component_ParamsContainerName()
   CPPUNIT_ASSERT(cname1.find(containerName) != std::string::npos);
 }
 
+// ============================================================================
+/*!
+ * Check concurrent GiveContainer requests.
+ * - launch NB_CONTAINERS local containers with distinct names from as many
+ *   threads, check that all of them are started and report the total time
+ * - two concurrent requests for the same name give the same container
+ */
+// ============================================================================
+
+void
+LifeCycleCORBATest::testGiveContainer_ConcurrentLaunches()
+{
+  const int NB_CONTAINERS = 8;
+  SALOME_LifeCycleCORBA _LCC(&_NS);
+  Engines::ContainerManager_var contManager = _LCC.getContainerManager();
+  CPPUNIT_ASSERT(!CORBA::is_nil(contManager));
+
+  Engines::ContainerParameters params;
+  _LCC.preSet(params);
+  params.mode = "start";
+  params.resource_params.hostname = Kernel_Utils::GetHostname().c_str();
+
+  // --- distinct names
+
+  std::vector<Engines::Container_var> containers(NB_CONTAINERS);
+  std::vector<std::thread> threads;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int i = 0; i < NB_CONTAINERS; i++)
+    {
+      threads.push_back(std::thread([&, i]()
+        {
+          Engines::ContainerParameters p(params);
+          std::string name = "concurrentContainer_" + std::to_string(i);
+          p.container_name = name.c_str();
+          try
+            {
+              containers[i] = contManager->GiveContainer(p);
+            }
+          catch (CORBA::Exception&) {}
+        }));
+    }
+  for (std::size_t i = 0; i < threads.size(); i++)
+    threads[i].join();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  std::cerr << NB_CONTAINERS << " containers launched concurrently in "
+            << elapsed.count() << " s" << std::endl;
+  for (int i = 0; i < NB_CONTAINERS; i++)
+    CPPUNIT_ASSERT(!CORBA::is_nil(containers[i]));
+
+  // --- same name, the two requests share the same launch
+  //     (getorstart: the second request may also come after the launch)
+
+  Engines::Container_var c1, c2;
+  params.mode = "getorstart";
+  params.container_name = "concurrentContainer_shared";
+  std::thread t1([&]() { try { c1 = contManager->GiveContainer(params); } catch (CORBA::Exception&) {} });
+  std::thread t2([&]() { try { c2 = contManager->GiveContainer(params); } catch (CORBA::Exception&) {} });
+  t1.join();
+  t2.join();
+  CPPUNIT_ASSERT(!CORBA::is_nil(c1));
+  CPPUNIT_ASSERT(!CORBA::is_nil(c2));
+  CPPUNIT_ASSERT(c1->_is_equivalent(c2));
+
+  for (int i = 0; i < NB_CONTAINERS; i++)
+    containers[i]->Shutdown();
+  c1->Shutdown();
+}
+
 // ============================================================================
 /*!
  * Check FindOrLoad_Component on remote computer
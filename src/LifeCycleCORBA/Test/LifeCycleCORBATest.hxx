@@ -55,6 +55,7 @@ class LIFECYCLECORBATEST_EXPORT LifeCycleCORBATest : public CppUnit::TestFixture
   CPPUNIT_TEST( testFindOrLoad_Component_ParamsEmpty );
   CPPUNIT_TEST( testFindOrLoad_Component_ParamsLocalContainer );
   CPPUNIT_TEST( testFindOrLoad_Component_ParamsContainerName );
+  CPPUNIT_TEST( testGiveContainer_ConcurrentLaunches );
 #ifdef SALOME_TEST_REMOTE
   CPPUNIT_TEST( testFindOrLoad_Component_RemoteComputer );
   CPPUNIT_TEST( testFindOrLoad_Component_ParamsRemoteComputer );
@@ -85,6 +86,7 @@ public:
   void testFindOrLoad_Component_ParamsEmpty();
   void testFindOrLoad_Component_ParamsLocalContainer();
   void testFindOrLoad_Component_ParamsContainerName();
+  void testGiveContainer_ConcurrentLaunches();
   void testFindOrLoad_Component_RemoteComputer();
   void testFindOrLoad_Component_ParamsRemoteComputer();
   void testFindOrLoad_Component_ParamsRemoteComputer2();
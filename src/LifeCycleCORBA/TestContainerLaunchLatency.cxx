@@ -0,0 +1,86 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  SALOME TestContainerLaunchLatency : time taken by GiveContainer to launch a container
+//  File   : TestContainerLaunchLatency.cxx
+//  Module : SALOME
+//
+#include "utilities.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <SALOMEconfig.h>
+#include "SALOME_NamingService.hxx"
+#include "SALOME_ContainerManager.hxx"
+#include "Utils_ORB_INIT.hxx"
+#include "Utils_SINGLETON.hxx"
+
+int main (int argc, char * argv[])
+{
+  int nbContainers = 50;
+  if (argc > 1 && atoi(argv[argc-1]) > 0)
+    nbContainers = atoi(argv[argc-1]);
+
+  // Initializing omniORB
+  ORB_INIT &init = *SINGLETON_<ORB_INIT>::Instance() ;
+  CORBA::ORB_ptr orb = init( argc , argv ) ;
+
+  SALOME_NamingService *_NS=new SALOME_NamingService(orb);
+
+  CORBA::Object_var obj = _NS->Resolve(SALOME_ContainerManager::_ContainerManagerNameInNS);
+  ASSERT( !CORBA::is_nil(obj));
+  Engines::ContainerManager_var _ContManager=Engines::ContainerManager::_narrow(obj);
+
+  Engines::ContainerParameters p;
+  p.mode = "start";
+  p.resource_params.hostname = "localhost";
+  p.resource_params.nb_proc_per_node = 1;
+  p.resource_params.nb_node = 1;
+  p.isMPI = false;
+
+  // each launch uses a new container name so that no container is reused
+  std::vector<double> latencies;
+  bool error = false;
+  char st[32];
+  for(int i=0;i<nbContainers;i++){
+    sprintf(st,"latency_%d",i);
+    p.container_name = CORBA::string_dup(st);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    Engines::Container_var cont = _ContManager->GiveContainer(p);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    if(CORBA::is_nil(cont)) error = true;
+    else latencies.push_back(elapsed.count());
+  }
+  _ContManager->ShutdownContainers();
+
+  if(latencies.empty()){
+    std::cout << "TEST KO: no container launched" << std::endl;
+    return 1;
+  }
+  std::sort(latencies.begin(), latencies.end());
+  double p50 = latencies[(latencies.size()-1)/2];
+  double p99 = latencies[(latencies.size()*99-1)/100];
+  std::cout << latencies.size() << " containers launched, GiveContainer latency: p50 "
+            << p50 << " ms, p99 " << p99 << " ms" << std::endl;
+  std::cout << (error ? "TEST KO" : "TEST OK") << std::endl;
+
+  return error ? 1 : 0;
+}
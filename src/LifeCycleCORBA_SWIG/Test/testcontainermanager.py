@@ -19,6 +19,7 @@
 #
 
 import os
+import time
 import unittest
 import salome
 import Engines
@@ -81,6 +82,27 @@ Test with catalog :
     name2="/Containers/%s/%s" % (host2,self.container_name)
     self.assertEqual(co._get_name(), name2)
 
+  def test3(self):
+    """warm pool: once the pool is filled, a start takes its container from the pool"""
+    cm.SetPoolSize(1)
+    misses=cm.GetPoolMisses()
+    hits=cm.GetPoolHits()
+    rp=LifeCycleCORBA.ResourceParameters(hostname="localhost")
+    p=LifeCycleCORBA.ContainerParameters(container_name=self.container_name,mode="start",resource_params=rp)
+    co=cm.GiveContainer( p )
+    self.assertEqual(cm.GetPoolMisses(), misses+1)
+    # the pool is filled in background
+    for i in range(60):
+      time.sleep(1)
+      co=cm.GiveContainer( p )
+      if cm.GetPoolHits() > hits:
+        break
+    self.assertEqual(cm.GetPoolHits(), hits+1)
+    name="/Containers/%s/%s" % (co.getHostName(),self.container_name)
+    self.assertEqual(co._get_name(), name)
+    cm.SetPoolSize(0)
+    self.assertEqual(cm.GetPoolSize(), 0)
+
 
 if __name__ == '__main__':
   #suite = unittest.TestLoader().loadTestsFromTestCase(TestContainerManager)
@@ -75,6 +75,17 @@ void Logger::putMessage(const char* message)
   myLock.unlock();
 }
 
+void Logger::putMessages(const SALOME_Logger::MessageList& messages)
+{
+  myLock.lock();
+  std::ostream& output = m_putIntoFile ? m_outputFile : std::cout;
+  for (CORBA::ULong i = 0; i < messages.length(); i++)
+    output << (const char*)messages[i];
+  if (m_putIntoFile)
+    m_outputFile << std::flush;
+  myLock.unlock();
+}
+
 void Logger::ping()
 {
   //cout<<" Logger::ping() pid "<< getpid()<<endl;
@@ -64,6 +64,8 @@ public:
 		virtual ~Logger();
         //put message into one special place for all servers
         void putMessage(const char* message);
+        //put a batch of messages, with only one flush
+        void putMessages(const SALOME_Logger::MessageList& messages);
         void ping();
         void SetOrb( CORBA::ORB_ptr orb ) { _orb = CORBA::ORB::_duplicate(orb); return; }
         void shutdown() { if(!CORBA::is_nil(_orb)) _orb->shutdown(0); };  
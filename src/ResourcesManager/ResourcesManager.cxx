@@ -79,7 +79,7 @@ ResourcesManager_cpp(const char *xmlFilePath)
   _resourceManagerMap["first"]=&first;
   _resourceManagerMap["cycl"]=&cycl;
   _resourceManagerMap["altcycl"]=&altcycl;
-  _resourceManagerMap["best"]=&altcycl;
+  _resourceManagerMap["best"]=&_best;
   _resourceManagerMap[""]=&altcycl;
 
   AddDefaultResourceInCatalog();
@@ -104,7 +104,7 @@ ResourcesManager_cpp::ResourcesManager_cpp()
   _resourceManagerMap["first"]=&first;
   _resourceManagerMap["cycl"]=&cycl;
   _resourceManagerMap["altcycl"]=&altcycl;
-  _resourceManagerMap["best"]=&altcycl;
+  _resourceManagerMap["best"]=&_best;
   _resourceManagerMap[""]=&altcycl;
 
   AddDefaultResourceInCatalog();
@@ -538,6 +538,41 @@ std::string ResourcesManager_cpp::Find(const std::string& policy, const std::vec
   return ((*it).second)->Find(listOfResources, _resourcesList);
 }
 
+//! threadsafe
+std::string ResourcesManager_cpp::Find(const std::string& policy, const std::vector<std::string>& listOfResources,
+                                       const resourceParams& params) const
+{
+  std::map<std::string , LoadRateManager*>::const_iterator it(_resourceManagerMap.find(policy));
+  if(it==_resourceManagerMap.end())
+    it=_resourceManagerMap.find("");
+  long nb_proc = params.nb_proc;
+  if(nb_proc <= 0 && params.nb_node > 0 && params.nb_proc_per_node > 0)
+    nb_proc = params.nb_node * params.nb_proc_per_node;
+  return ((*it).second)->Find(listOfResources, _resourcesList, nb_proc, params.mem_mb);
+}
+
+//=============================================================================
+/*!
+ *  Set the load of a resource, used by the "best" policy
+ */
+//=============================================================================
+
+void ResourcesManager_cpp::SetLoadOfResource(const std::string& name, const ResourceLoad& load)
+{
+  _best.SetLoad(name, load);
+}
+
+//=============================================================================
+/*!
+ *  Forget the load of a resource, which is then idle for the "best" policy
+ */
+//=============================================================================
+
+void ResourcesManager_cpp::ClearLoadOfResource(const std::string& name)
+{
+  _best.ClearLoad(name);
+}
+
 //=============================================================================
 /*!
  *  Gives a sublist of resources with matching OS.
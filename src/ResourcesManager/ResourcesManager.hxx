@@ -81,6 +81,15 @@ class RESOURCESMANAGER_EXPORT ResourcesManager_cpp
 
     std::string Find(const std::string& policy, const std::vector<std::string>& listOfResources) const;
 
+    std::string Find(const std::string& policy, const std::vector<std::string>& listOfResources,
+                     const resourceParams& params) const;
+
+    //! thread safe
+    void SetLoadOfResource(const std::string& name, const ResourceLoad& load);
+
+    //! thread safe
+    void ClearLoadOfResource(const std::string& name);
+
     void AddResourceInCatalog (const ParserResourcesType & new_resource);
 
     void DeleteResourceInCatalog(const char * name);
@@ -116,6 +125,9 @@ class RESOURCESMANAGER_EXPORT ResourcesManager_cpp
     //! a map that contains all the available load rate managers (the key is the name)
     std::map<std::string , LoadRateManager*> _resourceManagerMap;
 
+    //! load rate manager of the "best" policy, with the loads of the resources
+    LoadRateManagerBest _best;
+
     //! contain the time where resourcesList was created
     time_t _lasttime = 0;
 
@@ -93,3 +93,75 @@ std::string LoadRateManagerAltCycl::Find(const std::vector<std::string>& hosts,
   return selected;
 }
 
+std::string LoadRateManagerBest::Find(const std::vector<std::string>& hosts,
+                                      const MapOfParserResourcesType& resList)
+{
+  return Find(hosts, resList, -1, -1);
+}
+
+std::string LoadRateManagerBest::Find(const std::vector<std::string>& hosts,
+                                      const MapOfParserResourcesType& resList,
+                                      long nb_proc, long mem_mb)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  bool sampled = false;
+  for (std::vector<std::string>::const_iterator iter = hosts.begin(); iter != hosts.end() && !sampled; iter++)
+    sampled = _loads.count(*iter) != 0;
+  if (!sampled)
+    return LoadRateManagerAltCycl::Find(hosts, resList);
+
+  std::string selected;
+  bool selectedFits = false;
+  ResourceLoad selectedLoad;
+  for (std::vector<std::string>::const_iterator iter = hosts.begin(); iter != hosts.end(); iter++)
+    {
+      ResourceLoad load;
+      std::map<std::string,ResourceLoad>::const_iterator it(_loads.find(*iter));
+      if (it != _loads.end())
+        load = it->second;
+      else
+        {
+          // no container running there, all the resource is free
+          MapOfParserResourcesType::const_iterator itRes(resList.find(*iter));
+          if (itRes != resList.end())
+            {
+              const ResourceDataToSort& data = itRes->second.DataForSort;
+              load.nb_free_cores = data._nbOfProcPerNode * data._nbOfNodes;
+              load.free_mem_mb = data._memInMB;
+            }
+          if (load.nb_free_cores <= 0)
+            load.nb_free_cores = 1;
+        }
+      bool fits = (nb_proc <= 0 || load.nb_free_cores >= nb_proc) &&
+                  (mem_mb <= 0 || load.free_mem_mb >= mem_mb);
+      if (selected.empty() || (fits && !selectedFits) ||
+          (fits == selectedFits &&
+           (load.nb_free_cores > selectedLoad.nb_free_cores ||
+            (load.nb_free_cores == selectedLoad.nb_free_cores && load.free_mem_mb > selectedLoad.free_mem_mb))))
+        {
+          selected = *iter;
+          selectedFits = fits;
+          selectedLoad = load;
+        }
+    }
+
+  // what is given is not free any more until the next sample
+  selectedLoad.nb_free_cores -= nb_proc > 0 ? nb_proc : 1;
+  if (mem_mb > 0)
+    selectedLoad.free_mem_mb -= mem_mb;
+  _loads[selected] = selectedLoad;
+  return selected;
+}
+
+void LoadRateManagerBest::SetLoad(const std::string& resource, const ResourceLoad& load)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _loads[resource] = load;
+}
+
+void LoadRateManagerBest::ClearLoad(const std::string& resource)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _loads.erase(resource);
+}
+
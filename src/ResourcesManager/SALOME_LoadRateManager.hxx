@@ -26,12 +26,26 @@
 #include "ResourcesManager_Defs.hxx"
 #include <string>
 #include <map>
+#include <mutex>
 #include "SALOME_ResourcesCatalog_Parser.hxx"
 
 class RESOURCESMANAGER_EXPORT LoadRateManager
 {
   public:
     virtual std::string Find(const std::vector<std::string>& /*hosts*/, const MapOfParserResourcesType& /*resList*/) { return ""; }
+    //! nb_proc cores and mem_mb MB of memory are needed, <= 0 if not specified
+    virtual std::string Find(const std::vector<std::string>& hosts, const MapOfParserResourcesType& resList,
+                             long /*nb_proc*/, long /*mem_mb*/) { return Find(hosts, resList); }
+};
+
+//! Load of a resource, sampled from the containers running on it
+struct RESOURCESMANAGER_EXPORT ResourceLoad
+{
+  ResourceLoad() : nb_free_cores(0.), free_mem_mb(0) {}
+  ResourceLoad(double nbFreeCores, long freeMemInMB) : nb_free_cores(nbFreeCores), free_mem_mb(freeMemInMB) {}
+
+  double nb_free_cores; //!< sum over the cores of 1 - load of the core
+  long free_mem_mb;
 };
 
 class RESOURCESMANAGER_EXPORT LoadRateManagerFirst : public LoadRateManager
@@ -57,4 +71,26 @@ class RESOURCESMANAGER_EXPORT LoadRateManagerAltCycl : public LoadRateManager
     std::map<std::string,int> _numberOfUses;
 };
 
+// Chooses the resource with the most free cores, then the most free memory,
+// among the ones where nb_proc cores and mem_mb MB are free.
+// A resource without load sample is considered as idle, if no resource of the
+// list has been sampled the choice is the one of LoadRateManagerAltCycl.
+class RESOURCESMANAGER_EXPORT LoadRateManagerBest : public LoadRateManagerAltCycl
+{
+  public:
+    virtual std::string Find(const std::vector<std::string>& hosts,
+                             const MapOfParserResourcesType& resList);
+    virtual std::string Find(const std::vector<std::string>& hosts,
+                             const MapOfParserResourcesType& resList,
+                             long nb_proc, long mem_mb);
+
+    void SetLoad(const std::string& resource, const ResourceLoad& load);
+
+    void ClearLoad(const std::string& resource);
+
+  protected:
+    std::map<std::string,ResourceLoad> _loads;
+    std::mutex _mutex;
+};
+
 #endif
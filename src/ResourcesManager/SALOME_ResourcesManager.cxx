@@ -237,6 +237,29 @@ SALOME_ResourcesManager::Find(const char* policy, const Engines::ResourceList& l
   return CORBA::string_dup(_rm->Find(policy, rl).c_str());
 }
 
+char *
+SALOME_ResourcesManager::FindForParams(const char* policy, const Engines::ResourceList& listOfResources,
+                                       const Engines::ResourceParameters& params)
+{
+  // CORBA -> C++
+  std::vector<std::string> rl = resourceList_CORBAtoCPP(listOfResources);
+  resourceParams p = resourceParameters_CORBAtoCPP(params);
+
+  return CORBA::string_dup(_rm->Find(policy, rl, p).c_str());
+}
+
+void
+SALOME_ResourcesManager::SetLoadOfResource(const char* resource_name, CORBA::Double nb_free_cores, CORBA::Long free_mem_mb)
+{
+  _rm->SetLoadOfResource(resource_name, ResourceLoad(nb_free_cores, free_mem_mb));
+}
+
+void
+SALOME_ResourcesManager::ClearLoadOfResource(const char* resource_name)
+{
+  _rm->ClearLoadOfResource(resource_name);
+}
+
 Engines::ResourceDefinition*
 SALOME_ResourcesManager::GetResourceDefinition(const char * name)
 {
@@ -62,6 +62,10 @@ class SALOMERESOURCESMANAGER_EXPORT SALOME_ResourcesManager:
     Engines::ResourceList * GetFittingResources(const Engines::ResourceParameters& params);
     char* FindFirst(const Engines::ResourceList& listOfResources);
     char* Find(const char *policy, const Engines::ResourceList& listOfResources);
+    char* FindForParams(const char *policy, const Engines::ResourceList& listOfResources,
+                        const Engines::ResourceParameters& params);
+    void SetLoadOfResource(const char *resource_name, CORBA::Double nb_free_cores, CORBA::Long free_mem_mb);
+    void ClearLoadOfResource(const char *resource_name);
     Engines::ResourceDefinition * GetResourceDefinition(const char * name);
     void AddResource(const Engines::ResourceDefinition& new_resource,
                      CORBA::Boolean write,
@@ -57,6 +57,26 @@ string SALOME_ResourcesManager_Client::Find(const string & policy, const vector<
   return res;
 }
 
+string SALOME_ResourcesManager_Client::Find(const string & policy, const vector<string> & listOfResources,
+                                            const resourceParams& params)
+{
+  Engines::ResourceList_var corba_rl = resourceList_CPPtoCORBA(listOfResources);
+  Engines::ResourceParameters_var corba_params = resourceParameters_CPPtoCORBA(params);
+  CORBA::String_var corba_res = _rm->FindForParams(policy.c_str(), corba_rl, corba_params);
+  string res = corba_res.in();
+  return res;
+}
+
+void SALOME_ResourcesManager_Client::SetLoadOfResource(const string & name, double nb_free_cores, long free_mem_mb)
+{
+  _rm->SetLoadOfResource(name.c_str(), nb_free_cores, free_mem_mb);
+}
+
+void SALOME_ResourcesManager_Client::ClearLoadOfResource(const string & name)
+{
+  _rm->ClearLoadOfResource(name.c_str());
+}
+
 ParserResourcesType SALOME_ResourcesManager_Client::GetResourceDefinition(const std::string & name)
 {
   Engines::ResourceDefinition_var corba_res = _rm->GetResourceDefinition(name.c_str());
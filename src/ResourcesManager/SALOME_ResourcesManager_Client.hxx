@@ -39,6 +39,10 @@ public:
   std::vector<std::string> GetFittingResources(const resourceParams& params);
   //std::string FindFirst(const std::vector<std::string>& listOfResources) const;
   std::string Find(const std::string & policy, const std::vector<std::string> & listOfResources);
+  std::string Find(const std::string & policy, const std::vector<std::string> & listOfResources,
+                   const resourceParams& params);
+  void SetLoadOfResource(const std::string & name, double nb_free_cores, long free_mem_mb);
+  void ClearLoadOfResource(const std::string & name);
   ParserResourcesType GetResourceDefinition(const std::string & name);
   //void AddResource(const ParserResourcesType & new_resource, bool write, const std::string & xml_file);
   //void RemoveResource(const std::string & name, bool write, const std::string & xml_file);
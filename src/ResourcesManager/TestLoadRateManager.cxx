@@ -0,0 +1,135 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+// Checks the choices of the "best" policy with synthetic loads of resources
+
+#include "SALOME_LoadRateManager.hxx"
+#include <iostream>
+#include <string>
+#include <vector>
+
+static int nbErrors = 0;
+
+static void check(const std::string& what, const std::string& result, const std::string& expected)
+{
+  if (result != expected)
+    {
+      std::cout << what << ": " << result << " selected instead of " << expected << std::endl;
+      nbErrors++;
+    }
+}
+
+static void addResource(MapOfParserResourcesType& resList, const std::string& name,
+                        unsigned int nbOfProc, unsigned int memInMB)
+{
+  ParserResourcesType resource;
+  resource.Name = name;
+  resource.HostName = name;
+  resource.DataForSort = ResourceDataToSort(name, 1, nbOfProc, 0, memInMB);
+  resList[name] = resource;
+}
+
+int main()
+{
+  MapOfParserResourcesType resList;
+  addResource(resList, "node1", 8, 16000);
+  addResource(resList, "node2", 8, 16000);
+  addResource(resList, "node3", 4, 2000);
+  std::vector<std::string> hosts;
+  hosts.push_back("node1");
+  hosts.push_back("node2");
+  hosts.push_back("node3");
+
+  // without any load, the choices are the ones of the altcycl policy
+  {
+    LoadRateManagerBest best;
+    LoadRateManagerAltCycl altcycl;
+    for (int i = 0; i < 6; i++)
+      check("no load", best.Find(hosts, resList, 1, 0), altcycl.Find(hosts, resList));
+  }
+
+  // the resource with the most free cores is chosen, then the one with the most free memory
+  {
+    LoadRateManagerBest best;
+    best.SetLoad("node1", ResourceLoad(1.5, 12000));
+    best.SetLoad("node2", ResourceLoad(6., 1000));
+    best.SetLoad("node3", ResourceLoad(6., 1500));
+    check("most free cores", best.Find(hosts, resList, 1, 0), "node3");
+  }
+
+  // a resource without enough free memory is not chosen
+  {
+    LoadRateManagerBest best;
+    best.SetLoad("node1", ResourceLoad(1.5, 12000));
+    best.SetLoad("node2", ResourceLoad(6., 1000));
+    best.SetLoad("node3", ResourceLoad(3., 1500));
+    check("free memory", best.Find(hosts, resList, 1, 4000), "node1");
+    check("free cores", best.Find(hosts, resList, 4, 0), "node2");
+  }
+
+  // if no resource fits, the most free one is chosen
+  {
+    LoadRateManagerBest best;
+    best.SetLoad("node1", ResourceLoad(0.5, 12000));
+    best.SetLoad("node2", ResourceLoad(2., 1000));
+    best.SetLoad("node3", ResourceLoad(1., 1500));
+    check("nothing fits", best.Find(hosts, resList, 16, 64000), "node2");
+  }
+
+  // what is given is reserved until the next sample
+  {
+    LoadRateManagerBest best;
+    best.SetLoad("node1", ResourceLoad(4., 8000));
+    best.SetLoad("node2", ResourceLoad(3., 8000));
+    best.SetLoad("node3", ResourceLoad(0., 100));
+    check("reservation 1", best.Find(hosts, resList, 2, 0), "node1");
+    check("reservation 2", best.Find(hosts, resList, 2, 0), "node2");
+    check("reservation 3", best.Find(hosts, resList, 2, 0), "node1");
+    best.SetLoad("node2", ResourceLoad(8., 8000));
+    check("new sample", best.Find(hosts, resList, 2, 0), "node2");
+  }
+
+  // a resource without load is idle, with the cores and memory of its description
+  {
+    LoadRateManagerBest best;
+    best.SetLoad("node1", ResourceLoad(2., 16000));
+    best.SetLoad("node2", ResourceLoad(2., 16000));
+    check("idle resource", best.Find(hosts, resList, 3, 0), "node3");
+    check("idle resource memory", best.Find(hosts, resList, 1, 4000), "node1");
+  }
+
+  // a resource whose load is cleared is idle again
+  {
+    LoadRateManagerBest best;
+    best.SetLoad("node1", ResourceLoad(0., 100));
+    best.SetLoad("node2", ResourceLoad(1., 1000));
+    best.SetLoad("node3", ResourceLoad(2., 1000));
+    check("loaded resource", best.Find(hosts, resList, 1, 0), "node3");
+    best.ClearLoad("node1");
+    check("cleared resource", best.Find(hosts, resList, 1, 0), "node1");
+  }
+
+  if (nbErrors)
+    {
+      std::cout << "test KO" << std::endl;
+      return 1;
+    }
+  std::cout << "test OK" << std::endl;
+  return 0;
+}
@@ -47,24 +47,47 @@
 #include <SALOME_NamingService.hxx>
 
 // PAL8065: san -- Global recursive mutex for SALOMEDS methods
-Utils_Mutex SALOMEDS::Locker::MutexDS;
+Utils_RWMutex SALOMEDS::Locker::MutexDS;
 
 // PAL8065: san -- Global SALOMEDS locker
 SALOMEDS::Locker::Locker()
-: Utils_Locker( &MutexDS )
-{}
+{
+  MutexDS.lock();
+}
 
 SALOMEDS::Locker::~Locker()
-{}
+{
+  MutexDS.unlock();
+}
+
+SALOMEDS::ReadLocker::ReadLocker()
+{
+  Locker::MutexDS.lockShared();
+}
+
+SALOMEDS::ReadLocker::~ReadLocker()
+{
+  Locker::MutexDS.unlockShared();
+}
 
 void SALOMEDS::lock()
 {
-  Locker::MutexDS.lock();
+  Locker::MutexDS.resume();
 }
 
 void SALOMEDS::unlock()
 {
-  SALOMEDS::Locker::MutexDS.unlock();
+  SALOMEDS::Locker::MutexDS.suspend();
+}
+
+void SALOMEDS::lockWorker()
+{
+  Locker::MutexDS.lock();
+}
+
+void SALOMEDS::unlockWorker()
+{
+  Locker::MutexDS.unlock();
 }
 
 // srn: Added new library methods that create basic SALOMEDS objects (Study, SComponent, SObject)
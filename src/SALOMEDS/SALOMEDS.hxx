@@ -44,25 +44,46 @@ namespace SALOMEDS
   //
   //    Locker lock;
   //
-  class SALOMEDS_EXPORT Locker : public Utils_Locker
+  // The mutex is a reader-writer one: Locker takes it exclusive, ReadLocker
+  // takes it shared and is to be used by the methods which do not modify the study,
+  // so that they run in parallel
+  //
+  class SALOMEDS_EXPORT Locker
   {
   public:
     Locker();
     virtual ~Locker();
 
   private:
-    static Utils_Mutex MutexDS;
+    static Utils_RWMutex MutexDS;
 
+    friend class ReadLocker;
     friend void lock();
     friend void unlock();
+    friend void lockWorker();
+    friend void unlockWorker();
+  };
+
+  class SALOMEDS_EXPORT ReadLocker
+  {
+  public:
+    ReadLocker();
+    virtual ~ReadLocker();
   };
 
-  // Convenient functions to lock/unlock the global SALOMEDS mutex temporarily.
+  // Convenient functions to lock/unlock the global SALOMEDS mutex temporarily,
+  // lock() takes back the lock (shared or exclusive) released by unlock().
   // In particular, "unlock-dosomething-lock" scheme should be used, when some non-SALOMEDS
   // CORBA interface is called (component's engine), to avoid deadlocks in case of 
   // indirect recursion.
   void lock();
   void unlock();
+
+  // Take/release the global SALOMEDS mutex exclusive in a thread which does not hold it yet,
+  // such as a worker thread saving a component: unlike lock() and unlock(), they do not
+  // depend on a previous unlock()
+  void lockWorker();
+  void unlockWorker();
 }
 
 #endif
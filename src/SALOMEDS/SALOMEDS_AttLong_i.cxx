@@ -52,7 +52,7 @@ CORBA::Long SALOMEDS_AttLong_i::Get()
 {
   SALOMEDSImpl_AttributeInteger* Att = NULL;
   CORBA::Long x;
-  if ((Att=(SALOMEDSImpl_AttributeInteger*)_Lab.FindAttribute(SALOMEDSImpl_AttributeInteger::GetID())))
+  if ((Att=(SALOMEDSImpl_AttributeInteger*)_Lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeInteger>())))
     x = Att->Get ();
   return x;
 }
@@ -52,7 +52,8 @@ SALOMEDS_ChildIterator::~SALOMEDS_ChildIterator()
 void SALOMEDS_ChildIterator::Init()
 {
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
+    std::lock_guard<std::mutex> itLock(_itMutex);
     _local_impl->Init();
   }
   else _corba_impl->Init();
@@ -61,7 +62,8 @@ void SALOMEDS_ChildIterator::Init()
 void SALOMEDS_ChildIterator::InitEx(bool theAllLevels)
 {
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
+    std::lock_guard<std::mutex> itLock(_itMutex);
     _local_impl->InitEx(theAllLevels);
   }
   else _corba_impl->InitEx(theAllLevels);
@@ -71,7 +73,8 @@ bool SALOMEDS_ChildIterator::More()
 {
   bool ret = false;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
+    std::lock_guard<std::mutex> itLock(_itMutex);
     ret = _local_impl->More();
   }
   else ret = _corba_impl->More();
@@ -81,7 +84,8 @@ bool SALOMEDS_ChildIterator::More()
 void SALOMEDS_ChildIterator::Next() 
 {
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
+    std::lock_guard<std::mutex> itLock(_itMutex);
     _local_impl->Next();
   }
   else _corba_impl->Next();
@@ -91,7 +95,8 @@ _PTR(SObject) SALOMEDS_ChildIterator::Value()
 {
   SALOMEDSClient_SObject* aSO;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
+    std::lock_guard<std::mutex> itLock(_itMutex);
     aSO = new SALOMEDS_SObject(_local_impl->Value());
   }
   else {
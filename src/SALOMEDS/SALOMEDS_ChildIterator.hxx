@@ -30,6 +30,8 @@
 #include "SALOMEDSClient.hxx"
 #include "SALOMEDSImpl_ChildIterator.hxx"
 
+#include <mutex>
+
 // IDL headers
 #include <SALOMEconfig.h>
 #include CORBA_SERVER_HEADER(SALOMEDS)
@@ -40,6 +42,7 @@ private:
   bool                               _isLocal;
   SALOMEDSImpl_ChildIterator*        _local_impl;
   SALOMEDS::ChildIterator_var        _corba_impl;
+  std::mutex                         _itMutex; // the study is locked shared, the position of the iterator is guarded by this one
 
 public:
 
@@ -42,7 +42,7 @@ SALOMEDS_ChildIterator_i::SALOMEDS_ChildIterator_i(const SALOMEDSImpl_ChildItera
   GenericObj_i(SALOMEDS_Study_i::GetThePOA()),
   _it(theImpl.GetPersistentCopy())
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   _orb = CORBA::ORB::_duplicate(orb);
 }
 
@@ -80,7 +80,8 @@ PortableServer::POA_ptr SALOMEDS_ChildIterator_i::_default_POA()
 //============================================================================
 void SALOMEDS_ChildIterator_i::Init()
 { 
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
+  std::lock_guard<std::mutex> itLock(_itMutex);
   _it->Init();
 }
 
@@ -91,7 +92,8 @@ void SALOMEDS_ChildIterator_i::Init()
 //============================================================================
 void SALOMEDS_ChildIterator_i::InitEx(CORBA::Boolean allLevels)
 { 
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
+  std::lock_guard<std::mutex> itLock(_itMutex);
   _it->InitEx (allLevels);
 }
 
@@ -102,7 +104,8 @@ void SALOMEDS_ChildIterator_i::InitEx(CORBA::Boolean allLevels)
 //============================================================================
 CORBA::Boolean SALOMEDS_ChildIterator_i::More()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
+  std::lock_guard<std::mutex> itLock(_itMutex);
   return _it->More();
 }
 
@@ -113,7 +116,8 @@ CORBA::Boolean SALOMEDS_ChildIterator_i::More()
 //============================================================================
 void SALOMEDS_ChildIterator_i::Next()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
+  std::lock_guard<std::mutex> itLock(_itMutex);
   _it->Next();
 }
 
@@ -126,7 +130,8 @@ void SALOMEDS_ChildIterator_i::Next()
 
 SALOMEDS::SObject_ptr SALOMEDS_ChildIterator_i::Value()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
+  std::lock_guard<std::mutex> itLock(_itMutex);
   SALOMEDSImpl_SObject aSO = _it->Value();
   SALOMEDS::SObject_var so = SALOMEDS_SObject_i::New (aSO, _orb);
   return so._retn();
@@ -38,6 +38,7 @@
 // Cascade headers
 #include "SALOMEDSImpl_ChildIterator.hxx"
 #include <stdio.h>
+#include <mutex>
 
 class SALOMEDS_ChildIterator_i: public virtual POA_SALOMEDS::ChildIterator,
                                 public virtual PortableServer::ServantBase,
@@ -46,6 +47,7 @@ class SALOMEDS_ChildIterator_i: public virtual POA_SALOMEDS::ChildIterator,
 private:
   CORBA::ORB_var                     _orb;
   SALOMEDSImpl_ChildIterator*        _it;
+  std::mutex                         _itMutex; // the study is locked shared, the position of the iterator is guarded by this one
 public:
 
   //! standard constructor  
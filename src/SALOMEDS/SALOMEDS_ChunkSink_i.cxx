@@ -0,0 +1,72 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+// CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "SALOMEDS_ChunkSink_i.hxx"
+#include "SALOMEDS_Study_i.hxx"
+#include "SALOMEDS.hxx"
+
+#include "Utils_CorbaException.hxx"
+
+// The writer is called as the driver itself is called, with the study locked: the study released
+// its lock while the engine saves (see SALOMEDS_Driver_i::SaveByChunks), the calls of the engine take it.
+
+SALOMEDS_ChunkSink_i::SALOMEDS_ChunkSink_i(SALOMEDSImpl_ChunkWriter& theWriter) : _writer(theWriter)
+{
+}
+
+PortableServer::POA_ptr SALOMEDS_ChunkSink_i::_default_POA()
+{
+  return PortableServer::POA::_duplicate(SALOMEDS_Study_i::GetThePOA());
+}
+
+void SALOMEDS_ChunkSink_i::Open(CORBA::LongLong theLength)
+{
+  SALOMEDS::Locker lock;
+  try {
+    _writer.Open((long)theLength);
+  }
+  catch (...) {
+    THROW_SALOME_CORBA_EXCEPTION("Unable to write the data of the component", SALOME::INTERNAL_ERROR);
+  }
+}
+
+void SALOMEDS_ChunkSink_i::WriteChunk(const SALOMEDS::TMPFile& theChunk)
+{
+  SALOMEDS::Locker lock;
+  try {
+    _writer.WriteChunk(theChunk.get_buffer(), (long)theChunk.length());
+  }
+  catch (...) {
+    THROW_SALOME_CORBA_EXCEPTION("Unable to write the data of the component", SALOME::INTERNAL_ERROR);
+  }
+}
+
+void SALOMEDS_ChunkSink_i::Close()
+{
+  SALOMEDS::Locker lock;
+  try {
+    _writer.Close();
+  }
+  catch (...) {
+    THROW_SALOME_CORBA_EXCEPTION("Unable to write the data of the component", SALOME::INTERNAL_ERROR);
+  }
+}
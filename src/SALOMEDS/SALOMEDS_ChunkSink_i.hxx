@@ -0,0 +1,48 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+// CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef __SALOMEDS_CHUNKSINK_I_H__
+#define __SALOMEDS_CHUNKSINK_I_H__
+
+// IDL headers
+#include "SALOMEconfig.h"
+#include CORBA_SERVER_HEADER(SALOMEDS)
+
+#include "SALOMEDSImpl_Driver.hxx"
+
+//! Gives the chunks sent by a SALOMEDS::ChunkedDriver to the writer of the study (see SALOMEDS_Driver_i::SaveByChunks)
+class SALOMEDS_ChunkSink_i : public virtual POA_SALOMEDS::ChunkSink
+{
+public:
+  SALOMEDS_ChunkSink_i(SALOMEDSImpl_ChunkWriter& theWriter);
+
+  virtual PortableServer::POA_ptr _default_POA();
+
+  virtual void Open(CORBA::LongLong theLength);
+  virtual void WriteChunk(const SALOMEDS::TMPFile& theChunk);
+  virtual void Close();
+
+private:
+  SALOMEDSImpl_ChunkWriter& _writer;
+};
+
+#endif
@@ -22,6 +22,7 @@
 
 #include "SALOMEDS_Driver_i.hxx"
 #include "SALOMEDS_TMPFile_i.hxx"
+#include "SALOMEDS_ChunkSink_i.hxx"
 #include "utilities.h"
 #include "SALOMEDS_SObject_i.hxx"
 #include "SALOMEDS_SComponent_i.hxx"
@@ -29,6 +30,7 @@
 #include "SALOMEDS.hxx"
 #include <SALOMEDSImpl_IParameters.hxx>
 #include <SALOME_KernelServices.hxx>
+#include "Utils_SALOME_Exception.hxx"
 #include <stdlib.h>
 
 #include CORBA_CLIENT_HEADER(SALOME_Session)
@@ -111,6 +113,45 @@ SALOMEDSImpl_TMPFile* SALOMEDS_Driver_i::SaveASCII(const SALOMEDSImpl_SComponent
   return aTMPFile;
 }
 
+// The engines which implement SALOMEDS::ChunkedDriver send their data by chunks to a sink of the study,
+// the other ones return the whole stream from Save/SaveASCII, which is written as a single chunk.
+void SALOMEDS_Driver_i::SaveByChunks(const SALOMEDSImpl_SComponent& theComponent,
+                                     const std::string& theURL,
+                                     bool isMultiFile,
+                                     bool isASCII,
+                                     SALOMEDSImpl_ChunkWriter& theWriter)
+{
+  SALOMEDS::ChunkedDriver_var aDriver = SALOMEDS::ChunkedDriver::_narrow(_driver);
+  if ( CORBA::is_nil(aDriver) ) {
+    SALOMEDSImpl_Driver::SaveByChunks(theComponent, theURL, isMultiFile, isASCII, theWriter);
+    return;
+  }
+
+  SALOMEDS::SComponent_var sco = SALOMEDS_SComponent_i::New (theComponent, _orb);
+  CORBA::String_var url = CORBA::string_dup(theURL.c_str());
+  SALOMEDS_ChunkSink_i* aSinkServant = new SALOMEDS_ChunkSink_i(theWriter);
+  SALOMEDS::ChunkSink_var aSink = aSinkServant->_this();
+
+  SALOMEDS::unlock();
+  bool isOk = true;
+  try {
+    aDriver->SaveByChunks(sco.in(), url, isMultiFile, isASCII, aSink.in());
+  }
+  catch (...) {
+    isOk = false;
+  }
+
+  sco->UnRegister();
+  PortableServer::POA_var poa = aSinkServant->_default_POA();
+  PortableServer::ObjectId_var anObjectId = poa->servant_to_id(aSinkServant);
+  poa->deactivate_object(anObjectId.in());
+  aSinkServant->_remove_ref();
+  SALOMEDS::lock();
+
+  if ( !isOk )
+    throw SALOME_Exception(LOCALIZED("The engine failed to save its data"));
+}
+
 bool SALOMEDS_Driver_i::Load(const SALOMEDSImpl_SComponent& theComponent,
                              const unsigned char* theStream,
                              const long theStreamLength,
@@ -406,3 +447,37 @@ SALOMEDSImpl_Driver* SALOMEDS_DriverFactory_i::GetDriverByIOR(const std::string&
 
   return NULL;
 }
+
+//! The engines are saved one after the other if SALOMEDS_SEQUENTIAL_SAVE environment variable is set
+bool SALOMEDS_DriverFactory_i::CanSaveConcurrently()
+{
+  return getenv("SALOMEDS_SEQUENTIAL_SAVE") == 0;
+}
+
+//! The number of engines saving at the same time can be set by SALOMEDS_MAX_CONCURRENT_SAVES environment variable
+int SALOMEDS_DriverFactory_i::MaxConcurrentSaves()
+{
+  const char* aValue = getenv("SALOMEDS_MAX_CONCURRENT_SAVES");
+  int aMax = aValue ? atoi(aValue) : 0;
+  return aMax > 0 ? aMax : SALOMEDSImpl_DriverFactory::MaxConcurrentSaves();
+}
+
+void SALOMEDS_DriverFactory_i::Lock()
+{
+  SALOMEDS::lock();
+}
+
+void SALOMEDS_DriverFactory_i::Unlock()
+{
+  SALOMEDS::unlock();
+}
+
+void SALOMEDS_DriverFactory_i::LockWorker()
+{
+  SALOMEDS::lockWorker();
+}
+
+void SALOMEDS_DriverFactory_i::UnlockWorker()
+{
+  SALOMEDS::unlockWorker();
+}
@@ -56,6 +56,12 @@ public:
                                           const std::string& theURL,
                                           long& theStreamLength,
                                           bool isMultiFile);
+
+  virtual void SaveByChunks(const SALOMEDSImpl_SComponent& theComponent,
+                            const std::string& theURL,
+                            bool isMultiFile,
+                            bool isASCII,
+                            SALOMEDSImpl_ChunkWriter& theWriter);
   
   virtual bool Load(const SALOMEDSImpl_SComponent& theComponent,
                     const unsigned char* theStream,
@@ -126,6 +132,13 @@ public:
   virtual SALOMEDSImpl_Driver* GetDriverByType(const std::string& theComponentType);
 
   virtual SALOMEDSImpl_Driver* GetDriverByIOR(const std::string& theIOR);
+
+  virtual bool CanSaveConcurrently();
+  virtual int MaxConcurrentSaves();
+  virtual void Lock();
+  virtual void Unlock();
+  virtual void LockWorker();
+  virtual void UnlockWorker();
 };
 
 #endif 
@@ -78,7 +78,8 @@ PortableServer::POA_ptr SALOMEDS_SComponentIterator_i::_default_POA()
 //============================================================================
 void SALOMEDS_SComponentIterator_i::Init()
 { 
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
+  std::lock_guard<std::mutex> itLock(_itMutex);
   _impl->Init();
 }
 
@@ -89,7 +90,8 @@ void SALOMEDS_SComponentIterator_i::Init()
 //============================================================================
 CORBA::Boolean SALOMEDS_SComponentIterator_i::More()
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
+  std::lock_guard<std::mutex> itLock(_itMutex);
   return _impl->More();
 }
 
@@ -99,7 +101,8 @@ CORBA::Boolean SALOMEDS_SComponentIterator_i::More()
 //============================================================================
 void SALOMEDS_SComponentIterator_i::Next()
 { 
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
+  std::lock_guard<std::mutex> itLock(_itMutex);
   _impl->Next();
 }
 
@@ -111,7 +114,8 @@ void SALOMEDS_SComponentIterator_i::Next()
 //============================================================================
 SALOMEDS::SComponent_ptr SALOMEDS_SComponentIterator_i::Value()
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
+  std::lock_guard<std::mutex> itLock(_itMutex);
   SALOMEDS::SComponent_var sco = SALOMEDS_SComponent_i::New (_impl->Value(), _orb);
   return sco._retn();
 }
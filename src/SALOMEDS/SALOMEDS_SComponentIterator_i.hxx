@@ -29,6 +29,7 @@
 
 // std C++ headers
 #include <iostream>
+#include <mutex>
 
 // IDL headers
 #include <SALOMEconfig.h>
@@ -48,6 +49,7 @@ private:
 
   CORBA::ORB_var                   _orb;
   SALOMEDSImpl_SComponentIterator* _impl;
+  std::mutex                       _itMutex; // the study is locked shared, the position of the iterator is guarded by this one
 
 public:
   
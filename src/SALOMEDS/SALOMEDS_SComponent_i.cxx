@@ -60,7 +60,7 @@ SALOMEDS_SComponent_i::~SALOMEDS_SComponent_i()
 //============================================================================
 char* SALOMEDS_SComponent_i::ComponentDataType()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   std::string aType = dynamic_cast<SALOMEDSImpl_SComponent*>(_impl)->ComponentDataType();
   return CORBA::string_dup(aType.c_str());
 }
@@ -73,7 +73,7 @@ char* SALOMEDS_SComponent_i::ComponentDataType()
 //============================================================================
 CORBA::Boolean SALOMEDS_SComponent_i::ComponentIOR(CORBA::String_out IOR)
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   std::string ior;
   if(!dynamic_cast<SALOMEDSImpl_SComponent*>(_impl)->ComponentIOR(ior)) {
     IOR = CORBA::string_dup("");
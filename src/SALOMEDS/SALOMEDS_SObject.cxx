@@ -112,7 +112,7 @@ std::string SALOMEDS_SObject::GetID()
 {
   std::string aValue;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     aValue = _local_impl->GetID();
   }
   else aValue = (CORBA::String_var)_corba_impl->GetID();  
@@ -122,7 +122,7 @@ std::string SALOMEDS_SObject::GetID()
 _PTR(SComponent) SALOMEDS_SObject::GetFatherComponent()
 {
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     return _PTR(SComponent)(new SALOMEDS_SComponent(_local_impl->GetFatherComponent()));
   }
   return _PTR(SComponent)(new SALOMEDS_SComponent((SALOMEDS::SComponent_var)_corba_impl->GetFatherComponent()));
@@ -131,7 +131,7 @@ _PTR(SComponent) SALOMEDS_SObject::GetFatherComponent()
 _PTR(SObject) SALOMEDS_SObject::GetFather()
 {
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     return _PTR(SObject)(new SALOMEDS_SObject(_local_impl->GetFather()));
   }
   return _PTR(SObject)(new SALOMEDS_SObject((SALOMEDS::SObject_var)_corba_impl->GetFather()));
@@ -142,7 +142,7 @@ bool SALOMEDS_SObject::FindAttribute(_PTR(GenericAttribute)& anAttribute,
 {
   bool ret = false;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     DF_Attribute* anAttr = NULL;
     ret = _local_impl->FindAttribute(anAttr, aTypeOfAttribute);
     if(ret) {
@@ -163,7 +163,7 @@ bool SALOMEDS_SObject::ReferencedObject(_PTR(SObject)& theObject)
 {
   bool ret = false;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     SALOMEDSImpl_SObject aSO;
     ret = _local_impl->ReferencedObject(aSO);
     if(ret) theObject = _PTR(SObject)(new SALOMEDS_SObject(aSO));
@@ -182,7 +182,7 @@ bool SALOMEDS_SObject::FindSubObject(int theTag, _PTR(SObject)& theObject)
 {
   bool ret = false;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     SALOMEDSImpl_SObject aSO;
     ret = _local_impl->FindSubObject(theTag, aSO);
     if(ret) theObject = _PTR(SObject)(new SALOMEDS_SObject(aSO));
@@ -200,7 +200,7 @@ std::string SALOMEDS_SObject::Name()
 {
   std::string aName;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     aName = _local_impl->Name();
   }
   else aName = (CORBA::String_var)_corba_impl->Name();
@@ -224,7 +224,7 @@ std::vector<_PTR(GenericAttribute)> SALOMEDS_SObject::GetAllAttributes()
   SALOMEDSClient_GenericAttribute* anAttr;
 
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     std::vector<DF_Attribute*> aSeq = _local_impl->GetAllAttributes();
     aLength = (int)aSeq.size(); //!< TODO: conversion from size_t to int
     for (int i = 0; i < aLength; i++) {
@@ -248,7 +248,7 @@ std::string SALOMEDS_SObject::GetName()
 {
   std::string aName;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     aName = _local_impl->GetName();
   }
   else aName = (CORBA::String_var) _corba_impl->GetName();
@@ -260,7 +260,7 @@ std::string SALOMEDS_SObject::GetComment()
 {
   std::string aComment;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     aComment = _local_impl->GetComment();
   }
   else aComment = (CORBA::String_var) _corba_impl->GetComment();
@@ -272,7 +272,7 @@ std::string SALOMEDS_SObject::GetIOR()
 {
   std::string anIOR;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     anIOR = _local_impl->GetIOR();
   }
   else anIOR = (CORBA::String_var) _corba_impl->GetIOR();
@@ -283,7 +283,7 @@ std::string SALOMEDS_SObject::GetIOR()
 int SALOMEDS_SObject::Tag()
 {
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     return _local_impl->Tag();
   }
   return _corba_impl->Tag(); 
@@ -292,7 +292,7 @@ int SALOMEDS_SObject::Tag()
 int SALOMEDS_SObject::GetLastChildTag()
 {
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     return _local_impl->GetLastChildTag();
   }
   return _corba_impl->GetLastChildTag(); 
@@ -301,7 +301,7 @@ int SALOMEDS_SObject::GetLastChildTag()
 int SALOMEDS_SObject::Depth()
 {
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     return _local_impl->Depth();
   }
   return _corba_impl->Depth();  
@@ -311,7 +311,7 @@ CORBA::Object_ptr SALOMEDS_SObject::GetObject()
 {
   CORBA::Object_var obj;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     std::string anIOR = GetIOR();
     if (!anIOR.empty())
       obj = _orb->string_to_object(anIOR.c_str());
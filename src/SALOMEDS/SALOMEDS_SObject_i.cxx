@@ -110,7 +110,7 @@ PortableServer::POA_ptr SALOMEDS_SObject_i::_default_POA()
 
 CORBA::Boolean SALOMEDS_SObject_i::IsNull()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   return !_impl || _impl->IsNull();
 }
 
@@ -121,7 +121,7 @@ CORBA::Boolean SALOMEDS_SObject_i::IsNull()
 //============================================================================
 char* SALOMEDS_SObject_i::GetID()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   return CORBA::string_dup(_impl->GetID().c_str());
 }
 
@@ -132,7 +132,7 @@ char* SALOMEDS_SObject_i::GetID()
 //============================================================================
 SALOMEDS::SComponent_ptr SALOMEDS_SObject_i::GetFatherComponent()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   SALOMEDS::SComponent_var sco = SALOMEDS_SComponent_i::New (_impl->GetFatherComponent(), _orb);
   return sco._retn();
 }
@@ -144,7 +144,7 @@ SALOMEDS::SComponent_ptr SALOMEDS_SObject_i::GetFatherComponent()
 //============================================================================
 SALOMEDS::SObject_ptr SALOMEDS_SObject_i::GetFather()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   SALOMEDS::SObject_var so = SALOMEDS_SObject_i::New (_impl->GetFather(), _orb);
   return so._retn();
 }
@@ -157,7 +157,7 @@ SALOMEDS::SObject_ptr SALOMEDS_SObject_i::GetFather()
 CORBA::Boolean SALOMEDS_SObject_i::FindAttribute (SALOMEDS::GenericAttribute_out anAttribute,
                                                   const char* aTypeOfAttribute)
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   DF_Attribute* anAttr = NULL;
   if(_impl->FindAttribute(anAttr, (char*)aTypeOfAttribute)) {
     anAttribute = SALOMEDS_GenericAttribute_i::CreateAttribute(anAttr, _orb);
@@ -175,7 +175,7 @@ CORBA::Boolean SALOMEDS_SObject_i::FindAttribute (SALOMEDS::GenericAttribute_out
 
 SALOMEDS::ListOfAttributes* SALOMEDS_SObject_i::GetAllAttributes()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   std::vector<DF_Attribute*> aSeq = _impl->GetAllAttributes();
   SALOMEDS::ListOfAttributes_var SeqOfAttr = new SALOMEDS::ListOfAttributes;
   int length = (int)aSeq.size(); //!< TODO: conversion from size_t to int
@@ -203,7 +203,7 @@ SALOMEDS::ListOfAttributes* SALOMEDS_SObject_i::GetAllAttributes()
 //============================================================================
 CORBA::Boolean SALOMEDS_SObject_i::ReferencedObject(SALOMEDS::SObject_out obj)
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   SALOMEDSImpl_SObject aRefObj;
   if(!_impl->ReferencedObject(aRefObj)) return false;
 
@@ -218,7 +218,7 @@ CORBA::Boolean SALOMEDS_SObject_i::ReferencedObject(SALOMEDS::SObject_out obj)
 //============================================================================
 CORBA::Boolean SALOMEDS_SObject_i::FindSubObject(CORBA::Long atag, SALOMEDS::SObject_out obj)
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   SALOMEDSImpl_SObject aSubObj;
   if(!_impl->FindSubObject(atag, aSubObj)) return false;
 
@@ -234,7 +234,7 @@ CORBA::Boolean SALOMEDS_SObject_i::FindSubObject(CORBA::Long atag, SALOMEDS::SOb
 //============================================================================
 char* SALOMEDS_SObject_i::Name()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   return CORBA::string_dup(_impl->Name().c_str());
 }
 
@@ -257,7 +257,7 @@ void  SALOMEDS_SObject_i::Name(const char* name)
 //============================================================================
 CORBA::Short SALOMEDS_SObject_i::Tag()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   return (CORBA::Short)_impl->Tag(); //!< TODO: conversion from int to CORBA::Short
 }
 
@@ -268,7 +268,7 @@ CORBA::Short SALOMEDS_SObject_i::Tag()
 //============================================================================
 CORBA::Short SALOMEDS_SObject_i::GetLastChildTag()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   return (CORBA::Short) _impl->GetLastChildTag();
 }
 
@@ -279,7 +279,7 @@ CORBA::Short SALOMEDS_SObject_i::GetLastChildTag()
 //============================================================================
 CORBA::Short SALOMEDS_SObject_i::Depth()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   return (CORBA::Short)_impl->Depth(); //!< TODO: conversion from int to CORBA::Short
 }
 
@@ -290,7 +290,7 @@ CORBA::Short SALOMEDS_SObject_i::Depth()
 //============================================================================
 CORBA::Object_ptr SALOMEDS_SObject_i::GetObject()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   CORBA::Object_ptr obj = CORBA::Object::_nil();
   try {
     std::string IOR = _impl->GetIOR();
@@ -308,7 +308,7 @@ CORBA::Object_ptr SALOMEDS_SObject_i::GetObject()
 //============================================================================
 char* SALOMEDS_SObject_i::GetName()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   CORBA::String_var aStr = CORBA::string_dup(_impl->GetName().c_str());
   return aStr._retn();
 }
@@ -320,7 +320,7 @@ char* SALOMEDS_SObject_i::GetName()
 //============================================================================
 char* SALOMEDS_SObject_i::GetComment()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   CORBA::String_var aStr = CORBA::string_dup(_impl->GetComment().c_str());
   return aStr._retn();
 }
@@ -332,7 +332,7 @@ char* SALOMEDS_SObject_i::GetComment()
 //============================================================================
 char* SALOMEDS_SObject_i::GetIOR()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   CORBA::String_var aStr = CORBA::string_dup(_impl->GetIOR().c_str());
   return aStr._retn();
 }
@@ -263,7 +263,7 @@ std::string SALOMEDS_Study::GetPersistentReference()
 {
   std::string aRef;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     aRef = _local_impl->GetPersistentReference();
   }
   else aRef = (CORBA::String_var)_corba_impl->GetPersistentReference();
@@ -274,7 +274,7 @@ bool SALOMEDS_Study::IsEmpty()
 {
   bool ret;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     ret = _local_impl->IsEmpty();
   }
   else ret = _corba_impl->IsEmpty();
@@ -285,7 +285,7 @@ _PTR(SComponent) SALOMEDS_Study::FindComponent (const std::string& aComponentNam
 {
   SALOMEDSClient_SComponent* aSCO = NULL;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
 
     SALOMEDSImpl_SComponent aSCO_impl = _local_impl->FindComponent(aComponentName);
     if (!aSCO_impl) return _PTR(SComponent)(aSCO);
@@ -303,7 +303,7 @@ _PTR(SComponent) SALOMEDS_Study::FindComponentID(const std::string& aComponentID
 {  
   SALOMEDSClient_SComponent* aSCO = NULL;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
 
     SALOMEDSImpl_SComponent aSCO_impl = _local_impl->FindComponentID(aComponentID);
     if (!aSCO_impl) return _PTR(SComponent)(aSCO);
@@ -322,7 +322,7 @@ _PTR(SObject) SALOMEDS_Study::FindObject(const std::string& anObjectName)
   SALOMEDSClient_SObject* aSO = NULL;
 
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
 
     SALOMEDSImpl_SObject aSO_impl = _local_impl->FindObject(anObjectName);
     if (!aSO_impl) return _PTR(SObject)(aSO);
@@ -350,7 +350,7 @@ std::vector<_PTR(SObject)> SALOMEDS_Study::FindObjectByName(const std::string& a
   int i, aLength = 0;
 
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
 
     std::vector<SALOMEDSImpl_SObject> aSeq = _local_impl->FindObjectByName(anObjectName, aComponentName);
     aLength = (int)aSeq.size(); //!< TODO: conversion from size_t to int
@@ -371,7 +371,7 @@ _PTR(SObject) SALOMEDS_Study::FindObjectID(const std::string& anObjectID)
 {
   SALOMEDSClient_SObject* aSO = NULL;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
 
     SALOMEDSImpl_SObject aSO_impl = _local_impl->FindObjectID(anObjectID);
     if(!aSO_impl) return _PTR(SObject)(aSO);
@@ -406,7 +406,7 @@ _PTR(SObject) SALOMEDS_Study::FindObjectIOR(const std::string& anObjectIOR)
 {
   SALOMEDSClient_SObject* aSO = NULL;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
 
     SALOMEDSImpl_SObject aSO_impl = _local_impl->FindObjectIOR(anObjectIOR);
     if (!aSO_impl) return _PTR(SObject)(aSO);
@@ -424,7 +424,7 @@ _PTR(SObject) SALOMEDS_Study::FindObjectByPath(const std::string& thePath)
 {
   SALOMEDSClient_SObject* aSO = NULL;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
 
     SALOMEDSImpl_SObject aSO_impl = _local_impl->FindObjectByPath(thePath);
     if (!aSO_impl) return _PTR(SObject)(aSO);
@@ -444,13 +444,62 @@ std::string SALOMEDS_Study::GetObjectPath(const _PTR(SObject)& theSO)
   SALOMEDS_SObject* aSO = dynamic_cast<SALOMEDS_SObject*>(theSO.get());
   std::string aPath;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     aPath = _local_impl->GetObjectPath(*(aSO->GetLocalImpl()));
   }
   else aPath = _corba_impl->GetObjectPath(aSO->GetCORBAImpl());
   return aPath;
 }
 
+static SALOMEDS::ListOfStrings* ToListOfStrings(const std::vector<std::string>& theStrings)
+{
+  SALOMEDS::ListOfStrings_var aList = new SALOMEDS::ListOfStrings;
+  int aLength = (int)theStrings.size(); //!< TODO: conversion from size_t to int
+  aList->length(aLength);
+  for (int i = 0; i < aLength; i++)
+    aList[i] = CORBA::string_dup(theStrings[i].c_str());
+  return aList._retn();
+}
+
+static void FromListOfStrings(const SALOMEDS::ListOfStrings& theList, std::vector<std::string>& theStrings)
+{
+  theStrings.resize(theList.length());
+  for (int i = 0, n = theList.length(); i < n; i++)
+    theStrings[i] = theList[i].in();
+}
+
+void SALOMEDS_Study::GetObjectsAttributes(const std::vector<std::string>& theEntries,
+                                          bool theWithChildren,
+                                          const std::vector<std::string>& theAttributeTypes,
+                                          std::vector<std::string>& theObjectEntries,
+                                          std::vector<std::string>& theNames,
+                                          std::vector<std::string>& theIORs,
+                                          std::vector< std::vector<std::string> >& theObjectTypes,
+                                          std::vector<std::string>& theValues)
+{
+  if (_isLocal) {
+    SALOMEDS::ReadLocker lock;
+    _local_impl->GetObjectsAttributes(theEntries, theWithChildren, theAttributeTypes,
+                                      theObjectEntries, theNames, theIORs, theObjectTypes, theValues);
+  }
+  else {
+    SALOMEDS::ListOfStrings_var anEntries = ToListOfStrings(theEntries);
+    SALOMEDS::ListOfStrings_var aTypes = ToListOfStrings(theAttributeTypes);
+    SALOMEDS::ListOfStrings_var anObjectEntries, aNames, anIORs, aValues;
+    SALOMEDS::ListOfListOfStrings_var anObjectTypes;
+    _corba_impl->GetObjectsAttributes(anEntries, theWithChildren, aTypes,
+                                      anObjectEntries.out(), aNames.out(), anIORs.out(),
+                                      anObjectTypes.out(), aValues.out());
+    FromListOfStrings(anObjectEntries, theObjectEntries);
+    FromListOfStrings(aNames, theNames);
+    FromListOfStrings(anIORs, theIORs);
+    FromListOfStrings(aValues, theValues);
+    theObjectTypes.resize(anObjectTypes->length());
+    for (int i = 0, n = anObjectTypes->length(); i < n; i++)
+      FromListOfStrings(anObjectTypes[i], theObjectTypes[i]);
+  }
+}
+
 _PTR(ChildIterator) SALOMEDS_Study::NewChildIterator(const _PTR(SObject)& theSO)
 {
   SALOMEDS_SObject* aSO = dynamic_cast<SALOMEDS_SObject*>(theSO.get());
@@ -472,7 +521,7 @@ _PTR(SComponentIterator) SALOMEDS_Study::NewComponentIterator()
 {
   SALOMEDSClient_SComponentIterator* aCI = NULL; 
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
 
     SALOMEDSImpl_SComponentIterator aCIimpl = _local_impl->NewComponentIterator();
     aCI = new SALOMEDS_SComponentIterator(aCIimpl);
@@ -506,7 +555,7 @@ std::string SALOMEDS_Study::Name()
 {
   std::string aName;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     aName = _local_impl->Name();
   }
   else aName = Kernel_Utils::encode_s(_corba_impl->Name());
@@ -526,7 +575,7 @@ bool SALOMEDS_Study::IsSaved()
 {
   bool isSaved;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     isSaved = _local_impl->IsSaved();
   }
   else isSaved = _corba_impl->IsSaved();
@@ -546,7 +595,7 @@ bool SALOMEDS_Study::IsModified()
 {
   bool isModified;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     isModified = _local_impl->IsModified();
   }
   else isModified = _corba_impl->IsModified();
@@ -567,7 +616,7 @@ std::string SALOMEDS_Study::URL()
 {
   std::string aURL;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     aURL = _local_impl->URL();
   }
   else 
@@ -590,7 +639,7 @@ std::vector<_PTR(SObject)> SALOMEDS_Study::FindDependances(const _PTR(SObject)&
   SALOMEDS_SObject* aSO = dynamic_cast<SALOMEDS_SObject*>(theSO.get());
   int aLength, i;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
 
     std::vector<SALOMEDSImpl_SObject> aSeq = _local_impl->FindDependances(*(aSO->GetLocalImpl()));
     if (aSeq.size()) {
@@ -710,7 +759,7 @@ std::vector<std::string> SALOMEDS_Study::GetLockerID()
   std::vector<std::string> aVector;
   int aLength, i;
   if (_isLocal) {
-    SALOMEDS::Locker lock;
+    SALOMEDS::ReadLocker lock;
     aVector = _local_impl->GetLockerID();
   }
   else {
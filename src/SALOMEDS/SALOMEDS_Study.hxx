@@ -77,6 +77,14 @@ public:
   virtual _PTR(SObject) FindObjectIOR(const std::string& anObjectIOR);
   virtual _PTR(SObject) FindObjectByPath(const std::string& thePath);
   virtual std::string GetObjectPath(const _PTR(SObject)& theSO);
+  virtual void GetObjectsAttributes(const std::vector<std::string>& theEntries,
+                                    bool theWithChildren,
+                                    const std::vector<std::string>& theAttributeTypes,
+                                    std::vector<std::string>& theObjectEntries,
+                                    std::vector<std::string>& theNames,
+                                    std::vector<std::string>& theIORs,
+                                    std::vector< std::vector<std::string> >& theObjectTypes,
+                                    std::vector<std::string>& theValues);
   virtual _PTR(ChildIterator) NewChildIterator(const _PTR(SObject)& theSO);
   virtual _PTR(SComponentIterator) NewComponentIterator();
   virtual _PTR(StudyBuilder) NewBuilder();
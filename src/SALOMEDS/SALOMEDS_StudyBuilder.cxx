@@ -532,6 +532,35 @@ void SALOMEDS_StudyBuilder::SetIOR(const _PTR(SObject)& theSO, const std::string
   else _corba_impl->SetIOR(aSO->GetCORBAImpl(), (char*)theValue.c_str());
 }
 
+static SALOMEDS::ListOfStrings* ToListOfStrings(const std::vector<std::string>& theStrings)
+{
+  SALOMEDS::ListOfStrings_var aList = new SALOMEDS::ListOfStrings;
+  int aLength = (int)theStrings.size(); //!< TODO: conversion from size_t to int
+  aList->length(aLength);
+  for (int i = 0; i < aLength; i++)
+    aList[i] = CORBA::string_dup(theStrings[i].c_str());
+  return aList._retn();
+}
+
+void SALOMEDS_StudyBuilder::SetObjectsAttributes(const std::vector<std::string>& theEntries,
+                                                 const std::vector<std::string>& theAttributeTypes,
+                                                 const std::vector<std::string>& theValues)
+{
+  if (_isLocal) {
+    CheckLocked();
+    SALOMEDS::Locker lock;
+
+    if(!_local_impl->SetObjectsAttributes(theEntries, theAttributeTypes, theValues))
+      THROW_SALOME_CORBA_EXCEPTION(_local_impl->GetErrorCode().c_str(),SALOME::BAD_PARAM);
+  }
+  else {
+    SALOMEDS::ListOfStrings_var anEntries = ToListOfStrings(theEntries);
+    SALOMEDS::ListOfStrings_var aTypes = ToListOfStrings(theAttributeTypes);
+    SALOMEDS::ListOfStrings_var aValues = ToListOfStrings(theValues);
+    _corba_impl->SetObjectsAttributes(anEntries, aTypes, aValues);
+  }
+}
+
 SALOMEDS::StudyBuilder_ptr SALOMEDS_StudyBuilder::GetBuilder()
 {
   if(_isLocal) {
@@ -85,6 +85,9 @@ public:
   virtual void SetName(const _PTR(SObject)& theSO, const std::string& theValue);
   virtual void SetComment(const _PTR(SObject)& theSO, const std::string& theValue);
   virtual void SetIOR(const _PTR(SObject)& theSO, const std::string& theValue);
+  virtual void SetObjectsAttributes(const std::vector<std::string>& theEntries,
+                                    const std::vector<std::string>& theAttributeTypes,
+                                    const std::vector<std::string>& theValues);
 
   SALOMEDS::StudyBuilder_ptr GetBuilder();
 
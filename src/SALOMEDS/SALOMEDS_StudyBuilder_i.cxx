@@ -563,3 +563,28 @@ void SALOMEDS_StudyBuilder_i::SetIOR(SALOMEDS::SObject_ptr theSO, const char* th
   SALOMEDSImpl_SObject aSO = _impl->GetOwner()->GetSObject(anID.in());  
   _impl->SetIOR(aSO, std::string(theValue));
 }
+
+//============================================================================
+/*! Function : SetObjectsAttributes
+ *  Purpose  : Sets the attributes of several objects under one lock
+ */
+//============================================================================
+void SALOMEDS_StudyBuilder_i::SetObjectsAttributes(const SALOMEDS::ListOfStrings& theEntries,
+                                                   const SALOMEDS::ListOfStrings& theAttributeTypes,
+                                                   const SALOMEDS::ListOfStrings& theValues)
+{
+  SALOMEDS::Locker lock;
+  Unexpect aCatch(SBLockProtection);
+  CheckLocked();
+
+  std::vector<std::string> anEntries(theEntries.length()), aTypes(theAttributeTypes.length()), aValues(theValues.length());
+  for (int i = 0; i < (int)anEntries.size(); i++)
+    anEntries[i] = theEntries[i].in();
+  for (int i = 0; i < (int)aTypes.size(); i++)
+    aTypes[i] = theAttributeTypes[i].in();
+  for (int i = 0; i < (int)aValues.size(); i++)
+    aValues[i] = theValues[i].in();
+
+  if(!_impl->SetObjectsAttributes(anEntries, aTypes, aValues))
+    THROW_SALOME_CORBA_EXCEPTION(_impl->GetErrorCode().c_str(),SALOME::BAD_PARAM);
+}
@@ -125,6 +125,9 @@ public:
   virtual void SetName(SALOMEDS::SObject_ptr theSO, const char* theValue);
   virtual void SetComment(SALOMEDS::SObject_ptr theSO, const char* theValue);
   virtual void SetIOR(SALOMEDS::SObject_ptr theSO, const char* theValue);
+  virtual void SetObjectsAttributes(const SALOMEDS::ListOfStrings& theEntries,
+                                    const SALOMEDS::ListOfStrings& theAttributeTypes,
+                                    const SALOMEDS::ListOfStrings& theValues);
 
   SALOMEDSImpl_StudyBuilder* GetImpl() { return _impl; }
 
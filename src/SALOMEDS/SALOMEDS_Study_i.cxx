@@ -67,6 +67,9 @@ UNEXPECT_CATCH(LockProtection, SALOMEDS::StudyBuilder::LockProtection)
 
 static SALOMEDS_Driver_i* GetDriver(const SALOMEDSImpl_SObject& theObject, CORBA::ORB_ptr orb);
 
+//! The big datasets of the study file are compressed if SALOMEDS_COMPRESSED_SAVE environment variable is set
+static bool IsCompressedSave() { return getenv("SALOMEDS_COMPRESSED_SAVE") != 0; }
+
 static PortableServer::POA_var _poa;
 static SALOMEDS::Study_var _study;
 
@@ -549,7 +552,7 @@ CORBA::Boolean SALOMEDS_Study_i::Save(CORBA::Boolean theMultiFile, CORBA::Boolea
   SALOMEDS::Locker lock;
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();
-  return _impl->Save(_factory, theMultiFile, theASCII);
+  return _impl->Save(_factory, theMultiFile, theASCII, IsCompressedSave());
 }
 
 //=============================================================================
@@ -564,7 +567,7 @@ CORBA::Boolean SALOMEDS_Study_i::SaveAs(const wchar_t* aWUrl, CORBA::Boolean the
     throw SALOMEDS::Study::StudyInvalidReference();
   
   std::string aUrl = Kernel_Utils::encode_s(aWUrl);
-  return _impl->SaveAs(std::string(aUrl), _factory, theMultiFile, theASCII);
+  return _impl->SaveAs(std::string(aUrl), _factory, theMultiFile, theASCII, IsCompressedSave());
 }
 
 //============================================================================
@@ -680,7 +683,7 @@ SALOMEDS_Driver_i* GetDriver(const SALOMEDSImpl_SObject& theObject, CORBA::ORB_p
 //============================================================================
 char* SALOMEDS_Study_i::GetPersistentReference()
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
   return CORBA::string_dup(_impl->GetPersistentReference().c_str());
@@ -693,7 +696,7 @@ char* SALOMEDS_Study_i::GetPersistentReference()
 //============================================================================
 CORBA::Boolean SALOMEDS_Study_i::IsEmpty()
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
   return _impl->IsEmpty();
@@ -706,7 +709,7 @@ CORBA::Boolean SALOMEDS_Study_i::IsEmpty()
 //============================================================================
 SALOMEDS::SComponent_ptr SALOMEDS_Study_i::FindComponent (const char* aComponentName)
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
   
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
@@ -727,7 +730,7 @@ SALOMEDS::SComponent_ptr SALOMEDS_Study_i::FindComponent (const char* aComponent
 //============================================================================
 SALOMEDS::SComponent_ptr SALOMEDS_Study_i::FindComponentID(const char* aComponentID)
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
   
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
@@ -748,7 +751,7 @@ SALOMEDS::SComponent_ptr SALOMEDS_Study_i::FindComponentID(const char* aComponen
 //============================================================================
 SALOMEDS::SObject_ptr SALOMEDS_Study_i::FindObject(const char* anObjectName)
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
@@ -776,7 +779,7 @@ SALOMEDS::SObject_ptr SALOMEDS_Study_i::FindObject(const char* anObjectName)
 //============================================================================
 SALOMEDS::SObject_ptr SALOMEDS_Study_i::FindObjectID(const char* anObjectID)
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
@@ -822,7 +825,7 @@ SALOMEDS::SObject_ptr SALOMEDS_Study_i::CreateObjectID(const char* anObjectID)
 SALOMEDS::Study::ListOfSObject* SALOMEDS_Study_i::FindObjectByName( const char* anObjectName,
                                                                     const char* aComponentName )
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
@@ -848,7 +851,7 @@ SALOMEDS::Study::ListOfSObject* SALOMEDS_Study_i::FindObjectByName( const char*
 //============================================================================
 SALOMEDS::SObject_ptr SALOMEDS_Study_i::FindObjectIOR(const char* anObjectIOR)
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
@@ -869,7 +872,7 @@ SALOMEDS::SObject_ptr SALOMEDS_Study_i::FindObjectIOR(const char* anObjectIOR)
 //============================================================================
 SALOMEDS::SObject_ptr SALOMEDS_Study_i::FindObjectByPath(const char* thePath)
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
@@ -890,7 +893,7 @@ SALOMEDS::SObject_ptr SALOMEDS_Study_i::FindObjectByPath(const char* thePath)
 //============================================================================
 char* SALOMEDS_Study_i::GetObjectPath(CORBA::Object_ptr theObject)
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
@@ -916,6 +919,59 @@ char* SALOMEDS_Study_i::GetObjectPath(CORBA::Object_ptr theObject)
   return CORBA::string_dup(aPath.c_str());
 }
 
+//============================================================================
+/*! Function : GetObjectsAttributes
+ *  Purpose  : Returns the attributes of several objects under one lock
+ */
+//============================================================================
+static SALOMEDS::ListOfStrings* ToListOfStrings(const std::vector<std::string>& theStrings)
+{
+  SALOMEDS::ListOfStrings_var aList = new SALOMEDS::ListOfStrings;
+  int aLength = (int)theStrings.size(); //!< TODO: conversion from size_t to int
+  aList->length(aLength);
+  for (int anIndex = 0; anIndex < aLength; anIndex++)
+    aList[anIndex] = CORBA::string_dup(theStrings[anIndex].c_str());
+  return aList._retn();
+}
+
+void SALOMEDS_Study_i::GetObjectsAttributes(const SALOMEDS::ListOfStrings& theEntries,
+                                            CORBA::Boolean theWithChildren,
+                                            const SALOMEDS::ListOfStrings& theAttributeTypes,
+                                            SALOMEDS::ListOfStrings_out theObjectEntries,
+                                            SALOMEDS::ListOfStrings_out theNames,
+                                            SALOMEDS::ListOfStrings_out theIORs,
+                                            SALOMEDS::ListOfListOfStrings_out theObjectTypes,
+                                            SALOMEDS::ListOfStrings_out theValues)
+{
+  SALOMEDS::ReadLocker lock;
+
+  if (_closed)
+    throw SALOMEDS::Study::StudyInvalidReference();
+
+  std::vector<std::string> anEntries(theEntries.length()), aTypes(theAttributeTypes.length());
+  for (int i = 0; i < (int)anEntries.size(); i++)
+    anEntries[i] = theEntries[i].in();
+  for (int i = 0; i < (int)aTypes.size(); i++)
+    aTypes[i] = theAttributeTypes[i].in();
+
+  std::vector<std::string> anObjectEntries, aNames, anIORs, aValues;
+  std::vector< std::vector<std::string> > anObjectTypes;
+  _impl->GetObjectsAttributes(anEntries, theWithChildren, aTypes,
+                              anObjectEntries, aNames, anIORs, anObjectTypes, aValues);
+
+  theObjectEntries = ToListOfStrings(anObjectEntries);
+  theNames = ToListOfStrings(aNames);
+  theIORs = ToListOfStrings(anIORs);
+  theValues = ToListOfStrings(aValues);
+  theObjectTypes = new SALOMEDS::ListOfListOfStrings;
+  int aLength = (int)anObjectTypes.size(); //!< TODO: conversion from size_t to int
+  theObjectTypes->length(aLength);
+  for (int anIndex = 0; anIndex < aLength; anIndex++) {
+    SALOMEDS::ListOfStrings_var aList = ToListOfStrings(anObjectTypes[anIndex]);
+    (*theObjectTypes)[anIndex] = aList.in();
+  }
+}
+
 //============================================================================
 /*! Function : NewChildIterator
  *  Purpose  : Create a ChildIterator from an SObject
@@ -940,7 +996,7 @@ SALOMEDS::ChildIterator_ptr SALOMEDS_Study_i::NewChildIterator(SALOMEDS::SObject
 
 SALOMEDS_SComponentIterator_i *SALOMEDS_Study_i::NewComponentIteratorImpl()
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
@@ -987,7 +1043,7 @@ SALOMEDS::StudyBuilder_ptr SALOMEDS_Study_i::NewBuilder()
 //============================================================================
 wchar_t* SALOMEDS_Study_i::Name()
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
   // Name is specified as IDL attribute: user exception cannot be raised
   return CORBA::wstring_dup(Kernel_Utils::decode_s(_impl->Name()));
 }
@@ -1011,7 +1067,7 @@ void SALOMEDS_Study_i::Name(const wchar_t* wname)
 //============================================================================
 CORBA::Boolean SALOMEDS_Study_i::IsSaved()
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
   // IsSaved is specified as IDL attribute: user exception cannot be raised
   return (!_closed) ? _impl->IsSaved() : false;
 }
@@ -1036,7 +1092,7 @@ void SALOMEDS_Study_i::IsSaved(CORBA::Boolean save)
 //============================================================================
 CORBA::Boolean SALOMEDS_Study_i::IsModified()
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
@@ -1066,7 +1122,7 @@ void SALOMEDS_Study_i::Modified()
 //============================================================================
 wchar_t* SALOMEDS_Study_i::URL()
 {
-  SALOMEDS::Locker lock;
+  SALOMEDS::ReadLocker lock;
   // URL is specified as IDL attribute: user exception cannot be raised
   return CORBA::wstring_dup(Kernel_Utils::decode_s(_impl->URL()));
 }
@@ -1106,7 +1162,7 @@ void SALOMEDS_Study_i::IORUpdated(SALOMEDSImpl_AttributeIOR* theAttribute)
 
 SALOMEDS::Study::ListOfSObject* SALOMEDS_Study_i::FindDependances(SALOMEDS::SObject_ptr anObject) 
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
@@ -1164,6 +1220,26 @@ SALOMEDS::ListOfDates* SALOMEDS_Study_i::GetModificationsDate()
   return aDates._retn();
 }
 
+void SALOMEDS_Study_i::GetLastSaveTimings(SALOMEDS::ListOfStrings_out theComponents, SALOMEDS::ListOfDoubles_out theSeconds)
+{
+  SALOMEDS::ReadLocker lock;
+
+  if (_closed)
+    throw SALOMEDS::Study::StudyInvalidReference();
+
+  std::vector< std::pair<std::string, double> > aTimings = _impl->GetLastSaveTimings();
+
+  int aLength = (int)aTimings.size(); //!< TODO: conversion from size_t to int
+  theComponents = new SALOMEDS::ListOfStrings;
+  theSeconds = new SALOMEDS::ListOfDoubles;
+  theComponents->length(aLength);
+  theSeconds->length(aLength);
+  for (int anIndex = 0; anIndex < aLength; anIndex++) {
+    (*theComponents)[anIndex] = CORBA::string_dup(aTimings[anIndex].first.c_str());
+    (*theSeconds)[anIndex] = aTimings[anIndex].second;
+  }
+}
+
 //============================================================================
 /*! Function : GetUseCaseBuilder
  *  Purpose  : Returns a UseCase builder
@@ -1365,7 +1441,7 @@ void SALOMEDS_Study_i::UnLockStudy(const char* theLockerID)
 //============================================================================
 SALOMEDS::ListOfStrings* SALOMEDS_Study_i::GetLockerID()
 {
-  SALOMEDS::Locker lock; 
+  SALOMEDS::ReadLocker lock; 
 
   if (_closed)
     throw SALOMEDS::Study::StudyInvalidReference();  
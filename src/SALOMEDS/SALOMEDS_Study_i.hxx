@@ -203,6 +203,21 @@ public:
   */
   virtual char* GetObjectPath(CORBA::Object_ptr theObject);
 
+  //! method to get the attributes of several SObjects in one call
+  /*!
+    \param theEntries entries of the SObjects
+    \param theWithChildren whether the descendants of the SObjects are walked too
+    \param theAttributeTypes types of the attributes whose persistent values are returned
+  */
+  virtual void GetObjectsAttributes(const SALOMEDS::ListOfStrings& theEntries,
+                                    CORBA::Boolean theWithChildren,
+                                    const SALOMEDS::ListOfStrings& theAttributeTypes,
+                                    SALOMEDS::ListOfStrings_out theObjectEntries,
+                                    SALOMEDS::ListOfStrings_out theNames,
+                                    SALOMEDS::ListOfStrings_out theIORs,
+                                    SALOMEDS::ListOfListOfStrings_out theObjectTypes,
+                                    SALOMEDS::ListOfStrings_out theValues);
+
   //! method to Create a ChildIterator from an SObject 
   /*!
     \param aSO  SObject_ptr arguments
@@ -281,6 +296,8 @@ public:
 
   virtual SALOMEDS::ListOfDates* GetModificationsDate();
 
+  virtual void GetLastSaveTimings(SALOMEDS::ListOfStrings_out theComponents, SALOMEDS::ListOfDoubles_out theSeconds);
+
   virtual char* ConvertObjectToIOR(CORBA::Object_ptr theObject) {return _orb->object_to_string(theObject); }
   virtual CORBA::Object_ptr ConvertIORToObject(const char* theIOR) { return _orb->string_to_object(theIOR); };
 
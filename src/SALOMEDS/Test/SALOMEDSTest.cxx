@@ -33,6 +33,7 @@
 #include <string>
 #include <vector>
 #include <cstdlib>
+#include <algorithm>
 
 #include "SALOMEDSClient.hxx"
 #include "SALOMEDS_Study.hxx"
@@ -110,6 +111,7 @@ void SALOMEDSTest::tearDown()
 #include "SALOMEDSTest_Study.cxx"
 #include "SALOMEDSTest_StudyBuilder.cxx"
 #include "SALOMEDSTest_UseCase.cxx"
+#include "SALOMEDSTest_Concurrency.cxx"
 
 
 // ============================================================================
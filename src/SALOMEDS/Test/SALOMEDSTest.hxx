@@ -128,6 +128,7 @@ public:
   void testStudy();
   void testStudyBuilder();
   void testUseCase();
+  void testConcurrentAccess();
 
 protected:
 
@@ -181,6 +182,7 @@ class SALOMEDSTEST_EXPORT SALOMEDSTest_Embedded : public SALOMEDSTest
   CPPUNIT_TEST( testStudyBuilder ); 
   CPPUNIT_TEST( testChildIterator );
   CPPUNIT_TEST( testUseCase );
+  CPPUNIT_TEST( testConcurrentAccess );
   
   CPPUNIT_TEST_SUITE_END();
 
@@ -0,0 +1,96 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// Copyright (C) 2003-2007  OPEN CASCADE, EADS/CCR, LIP6, CEA/DEN,
+// CEDRAT, EDF R&D, LEG, PRINCIPIA R&D, BUREAU VERITAS
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include <thread>
+#include <atomic>
+#include <chrono>
+
+/*!
+ * Check that the readers of the study run in parallel with a writer,
+ * and report the number of reads per second for 1 to 8 readers
+ */
+
+void SALOMEDSTest::testConcurrentAccess()
+{
+  _PTR(Study) study(new SALOMEDS_Study(_study));
+  CPPUNIT_ASSERT(study);
+  _PTR(StudyBuilder) studyBuilder = study->NewBuilder();
+  CPPUNIT_ASSERT(studyBuilder);
+
+  const int aNbObjects = 1000, aNbWrites = 200;
+  _PTR(SComponent) sco = studyBuilder->NewComponent("TestConcurrentAccess");
+  CPPUNIT_ASSERT(sco);
+  std::vector<std::string> anEntries;
+  for (int i = 0; i < aNbObjects; i++) {
+    _PTR(SObject) so = studyBuilder->NewObject(sco);
+    studyBuilder->SetName(so, "object_" + std::to_string(i));
+    anEntries.push_back(so->GetID());
+  }
+
+  int aNbCreated = 0;
+  for (int aNbReaders = 1; aNbReaders <= 8; aNbReaders *= 2) {
+    std::atomic<bool> isWriting(true), isBroken(false);
+    std::atomic<long> aNbReads(0);
+
+    // the readers look the objects up by entry and by name, and walk through the component
+    std::vector<std::thread> aReaders;
+    for (int aReader = 0; aReader < aNbReaders; aReader++)
+      aReaders.push_back(std::thread([&, aReader]() {
+        for (long i = aReader; isWriting; i++) {
+          _PTR(SObject) so = study->FindObjectID(anEntries[i % aNbObjects]);
+          std::string aName = so ? so->GetName() : "";
+          if (aName.compare(0, 7, "object_") != 0 || !study->FindObject(aName))
+            isBroken = true;
+          int aNbChildren = 0;
+          _PTR(ChildIterator) it = study->NewChildIterator(sco);
+          for (; it->More() && aNbChildren < 50; it->Next()) aNbChildren++;
+          if (aNbChildren != 50)
+            isBroken = true;
+          aNbReads++;
+        }
+      }));
+
+    // the writer renames the objects and adds new ones
+    auto aStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < aNbWrites; i++, aNbCreated++) {
+      _PTR(SObject) so = study->FindObjectID(anEntries[i % aNbObjects]);
+      studyBuilder->SetName(so, "object_" + std::to_string(i % aNbObjects));
+      studyBuilder->SetName(studyBuilder->NewObject(sco), "object_" + std::to_string(aNbObjects + aNbCreated));
+    }
+    isWriting = false;
+    for (size_t i = 0; i < aReaders.size(); i++)
+      aReaders[i].join();
+    double aSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - aStart).count();
+
+    CPPUNIT_ASSERT(!isBroken);
+    std::cout << "testConcurrentAccess: " << aNbReaders << " reader(s) and 1 writer: "
+              << aNbReads / aSeconds << " reads/s, "
+              << aNbWrites / aSeconds << " writes/s" << std::endl;
+  }
+
+  int aNbChildren = 0;
+  for (_PTR(ChildIterator) it = study->NewChildIterator(sco); it->More(); it->Next())
+    aNbChildren++;
+  CPPUNIT_ASSERT(aNbChildren == aNbObjects + aNbCreated);
+
+  studyBuilder->RemoveComponent(sco);
+}
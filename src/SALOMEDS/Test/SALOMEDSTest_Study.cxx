@@ -150,6 +150,20 @@ void SALOMEDSTest::testStudy()
   path = study->GetObjectPath(emptySO);
   CPPUNIT_ASSERT(path.empty());
 
+  //Check method GetObjectsAttributes
+  std::vector<std::string> entries(1, so1->GetID()), types(1, "AttributeIOR"), objEntries, names, iors, values;
+  std::vector< std::vector<std::string> > objTypes;
+  study->GetObjectsAttributes(entries, true, types, objEntries, names, iors, objTypes, values);
+  CPPUNIT_ASSERT(objEntries.size() == 2 && objEntries[0] == so1->GetID() && objEntries[1] == so2->GetID());
+  CPPUNIT_ASSERT(names[0] == "so1" && names[1] == "so2" && iors[0] == ior && iors[1].empty());
+  CPPUNIT_ASSERT(values.size() == 2 && values[0] == ior && values[1].empty());
+  CPPUNIT_ASSERT(std::find(objTypes[0].begin(), objTypes[0].end(), "AttributeIOR") != objTypes[0].end());
+
+  //Try with an unknown entry, without the children
+  entries.push_back("0:9:9:9");
+  study->GetObjectsAttributes(entries, false, types, objEntries, names, iors, objTypes, values);
+  CPPUNIT_ASSERT(objEntries.size() == 1 && objEntries[0] == so1->GetID());
+
   //Check method FindObjectByPath
   _PTR(SObject) so6 = study->FindObjectByPath("so1");
   CPPUNIT_ASSERT(so6 && so6->GetID() == so1->GetID());
@@ -160,6 +160,42 @@ void SALOMEDSTest::testStudyBuilder()
   studyBuilder->SetIOR(so1, ior);
   CPPUNIT_ASSERT(so1->GetIOR() == ior);
 
+  //Check method SetObjectsAttributes
+  std::vector<std::string> entries, types, values;
+  entries.push_back(so1->GetID()); types.push_back("AttributeName"); values.push_back("bulk name");
+  entries.push_back(so1->GetID()); types.push_back("AttributeComment"); values.push_back("bulk comment");
+  entries.push_back(so1->GetID()); types.push_back("AttributeInteger"); values.push_back("7");
+  studyBuilder->SetObjectsAttributes(entries, types, values);
+  CPPUNIT_ASSERT(so1->GetName() == "bulk name" && so1->GetComment() == "bulk comment");
+  CPPUNIT_ASSERT(studyBuilder->FindAttribute(so1, ga, "AttributeInteger"));
+  _PTR(AttributeInteger) ai = ga;
+  CPPUNIT_ASSERT(ai && ai->Value() == 7);
+
+  //Try to set attributes of an unknown object: an exception is raised and nothing is set
+  values[0] = "other name";
+  entries.push_back("0:9:9:9"); types.push_back("AttributeName"); values.push_back("unknown");
+  isRaised = false;
+  try {
+    studyBuilder->SetObjectsAttributes(entries, types, values);
+  }
+  catch(...) {
+    isRaised = true;
+  }
+  CPPUNIT_ASSERT(isRaised);
+  CPPUNIT_ASSERT(so1->GetName() == "bulk name");
+
+  //Try to set an attribute of an unknown type after a valid one: nothing is set
+  entries.back() = so1->GetID(); types.back() = "AttributeUnknown";
+  isRaised = false;
+  try {
+    studyBuilder->SetObjectsAttributes(entries, types, values);
+  }
+  catch(...) {
+    isRaised = true;
+  }
+  CPPUNIT_ASSERT(isRaised);
+  CPPUNIT_ASSERT(so1->GetName() == "bulk name");
+
   study->Clear();
 
   //Check method LoadWith
@@ -180,6 +216,21 @@ void SALOMEDSTest::testStudyBuilder()
   ior = _orb->object_to_string(drv);
   sb2->DefineComponentInstance(sco, ior);
 
+  //Check the save of the engines one after the other, in the thread that writes the file
+#ifdef WIN32
+  _putenv("SALOMEDS_SEQUENTIAL_SAVE=1");
+#else
+  setenv("SALOMEDS_SEQUENTIAL_SAVE", "1", 1);
+#endif
+  bool isSaved = study2->SaveAs("srn_SALOMEDS_UnitTests_sequential.hdf", false, false);
+#ifdef WIN32
+  _putenv("SALOMEDS_SEQUENTIAL_SAVE=");
+#else
+  unsetenv("SALOMEDS_SEQUENTIAL_SAVE");
+#endif
+  CPPUNIT_ASSERT(isSaved);
+  system("rm -f srn_SALOMEDS_UnitTests_sequential.hdf");
+
   study2->SaveAs("srn_SALOMEDS_UnitTests.hdf", false, false);
   study2->Clear();
 
@@ -66,6 +66,14 @@ public:
   virtual _PTR(SObject) FindObjectIOR(const std::string& anObjectIOR) = 0;
   virtual _PTR(SObject) FindObjectByPath(const std::string& thePath) = 0;
   virtual std::string GetObjectPath(const _PTR(SObject)& theSO) = 0;
+  virtual void GetObjectsAttributes(const std::vector<std::string>& theEntries,
+                                    bool theWithChildren,
+                                    const std::vector<std::string>& theAttributeTypes,
+                                    std::vector<std::string>& theObjectEntries,
+                                    std::vector<std::string>& theNames,
+                                    std::vector<std::string>& theIORs,
+                                    std::vector< std::vector<std::string> >& theObjectTypes,
+                                    std::vector<std::string>& theValues) = 0;
   virtual _PTR(ChildIterator) NewChildIterator(const _PTR(SObject)& theSO) = 0;
   virtual _PTR(SComponentIterator) NewComponentIterator() = 0;
   virtual _PTR(StudyBuilder) NewBuilder() = 0;
@@ -32,6 +32,7 @@
 #include "SALOMEDSClient_SComponent.hxx"
 #include "SALOMEDSClient_GenericAttribute.hxx"
 #include <string> 
+#include <vector>
 
 class SALOMEDSClient_StudyBuilder
 {
@@ -69,6 +70,9 @@ public:
   virtual void SetName(const _PTR(SObject)& theSO, const std::string& theValue) = 0;
   virtual void SetComment(const _PTR(SObject)& theSO, const std::string& theValue) = 0;
   virtual void SetIOR(const _PTR(SObject)& theSO, const std::string& theValue) = 0;
+  virtual void SetObjectsAttributes(const std::vector<std::string>& theEntries,
+                                    const std::vector<std::string>& theAttributeTypes,
+                                    const std::vector<std::string>& theValues) = 0;
 };
 
 #endif
@@ -40,8 +40,8 @@ SALOMEDSImpl_AttributeComment* SALOMEDSImpl_AttributeComment::Set (const DF_Labe
                                                                    const std::string& Val) 
 {
   SALOMEDSImpl_AttributeComment* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeComment*)L.FindAttribute(SALOMEDSImpl_AttributeComment::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeComment(); 
+  if (!(A=(SALOMEDSImpl_AttributeComment*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeComment>()))) {
+    A = new(L) SALOMEDSImpl_AttributeComment(); 
     L.AddAttribute(A);
   }
 
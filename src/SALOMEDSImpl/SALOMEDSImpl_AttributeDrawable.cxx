@@ -46,8 +46,8 @@ SALOMEDSImpl_AttributeDrawable* SALOMEDSImpl_AttributeDrawable::Set (const DF_La
                                                                      const int value) 
 {
   SALOMEDSImpl_AttributeDrawable* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeDrawable*)L.FindAttribute(SALOMEDSImpl_AttributeDrawable::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeDrawable(); 
+  if (!(A=(SALOMEDSImpl_AttributeDrawable*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeDrawable>()))) {
+    A = new(L) SALOMEDSImpl_AttributeDrawable(); 
     L.AddAttribute(A);
   }
   
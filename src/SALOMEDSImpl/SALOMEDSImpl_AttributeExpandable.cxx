@@ -46,8 +46,8 @@ SALOMEDSImpl_AttributeExpandable* SALOMEDSImpl_AttributeExpandable::Set (const D
                                                                         const int value) 
 {
   SALOMEDSImpl_AttributeExpandable* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeExpandable*)L.FindAttribute(SALOMEDSImpl_AttributeExpandable::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeExpandable(); 
+  if (!(A=(SALOMEDSImpl_AttributeExpandable*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeExpandable>()))) {
+    A = new(L) SALOMEDSImpl_AttributeExpandable(); 
     L.AddAttribute(A);
   }
   
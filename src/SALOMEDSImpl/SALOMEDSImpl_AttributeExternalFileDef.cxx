@@ -45,8 +45,8 @@ SALOMEDSImpl_AttributeExternalFileDef::Set (const DF_Label& L, const std::string
 {
 
   SALOMEDSImpl_AttributeExternalFileDef* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeExternalFileDef*)L.FindAttribute(SALOMEDSImpl_AttributeExternalFileDef::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeExternalFileDef(); 
+  if (!(A=(SALOMEDSImpl_AttributeExternalFileDef*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeExternalFileDef>()))) {
+    A = new(L) SALOMEDSImpl_AttributeExternalFileDef(); 
     L.AddAttribute(A);
   }
   
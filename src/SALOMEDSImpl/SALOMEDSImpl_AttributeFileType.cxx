@@ -49,8 +49,8 @@ SALOMEDSImpl_AttributeFileType* SALOMEDSImpl_AttributeFileType::Set (const DF_La
 {
 
   SALOMEDSImpl_AttributeFileType* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeFileType*)L.FindAttribute(SALOMEDSImpl_AttributeFileType::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeFileType(); 
+  if (!(A=(SALOMEDSImpl_AttributeFileType*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeFileType>()))) {
+    A = new(L) SALOMEDSImpl_AttributeFileType(); 
     L.AddAttribute(A);
   }
   
@@ -50,9 +50,9 @@ SALOMEDSImpl_AttributeFlags* SALOMEDSImpl_AttributeFlags::Set(const DF_Label& L,
                                                               const int value )
 {
   SALOMEDSImpl_AttributeFlags* A = NULL;
-  if ( !(A=(SALOMEDSImpl_AttributeFlags*)L.FindAttribute(SALOMEDSImpl_AttributeFlags::GetID())) )
+  if ( !(A=(SALOMEDSImpl_AttributeFlags*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeFlags>())) )
   {
-    A = new  SALOMEDSImpl_AttributeFlags();
+    A = new(L) SALOMEDSImpl_AttributeFlags();
     L.AddAttribute( A );
   }
 
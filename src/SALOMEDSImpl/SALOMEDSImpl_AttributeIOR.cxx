@@ -47,8 +47,8 @@ SALOMEDSImpl_AttributeIOR* SALOMEDSImpl_AttributeIOR::Set (const DF_Label&    L,
                                                            const std::string& S) 
 {
   SALOMEDSImpl_AttributeIOR* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeIOR*)L.FindAttribute(SALOMEDSImpl_AttributeIOR::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeIOR(); 
+  if (!(A=(SALOMEDSImpl_AttributeIOR*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeIOR>()))) {
+    A = new(L) SALOMEDSImpl_AttributeIOR(); 
     L.AddAttribute(A);
   }
 
@@ -41,8 +41,8 @@ const std::string& SALOMEDSImpl_AttributeInteger::GetID ()
 SALOMEDSImpl_AttributeInteger* SALOMEDSImpl_AttributeInteger::Set (const DF_Label& L, int Val) 
 {
   SALOMEDSImpl_AttributeInteger* A = NULL;
-  if (!(A = (SALOMEDSImpl_AttributeInteger*)L.FindAttribute(SALOMEDSImpl_AttributeInteger::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeInteger(); 
+  if (!(A = (SALOMEDSImpl_AttributeInteger*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeInteger>()))) {
+    A = new(L) SALOMEDSImpl_AttributeInteger(); 
     L.AddAttribute(A);
   }
 
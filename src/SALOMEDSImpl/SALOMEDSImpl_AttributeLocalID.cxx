@@ -49,8 +49,8 @@ SALOMEDSImpl_AttributeLocalID* SALOMEDSImpl_AttributeLocalID::Set (const DF_Labe
                                                                    const int value) 
 {
   SALOMEDSImpl_AttributeLocalID* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeLocalID*)L.FindAttribute(SALOMEDSImpl_AttributeLocalID::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeLocalID(); 
+  if (!(A=(SALOMEDSImpl_AttributeLocalID*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeLocalID>()))) {
+    A = new(L) SALOMEDSImpl_AttributeLocalID(); 
     L.AddAttribute(A);
   }
   
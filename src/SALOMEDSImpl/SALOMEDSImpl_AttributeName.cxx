@@ -25,6 +25,7 @@
 //  Module : SALOME
 //
 #include "SALOMEDSImpl_AttributeName.hxx"
+#include "SALOMEDSImpl_Study.hxx"
 
 //=======================================================================
 //function : GetID
@@ -40,8 +41,8 @@ SALOMEDSImpl_AttributeName* SALOMEDSImpl_AttributeName::Set (const DF_Label& L,
                                                              const std::string& Val) 
 {
   SALOMEDSImpl_AttributeName* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeName*)L.FindAttribute(SALOMEDSImpl_AttributeName::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeName(); 
+  if (!(A=(SALOMEDSImpl_AttributeName*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeName>()))) {
+    A = new(L) SALOMEDSImpl_AttributeName(); 
     L.AddAttribute(A);
   }
 
@@ -61,7 +62,9 @@ void SALOMEDSImpl_AttributeName::SetValue (const std::string& S)
 
   Backup();
 
+  std::string anOldValue = myString;
   myString = S;
+  ValueChanged(anOldValue);
 
   SetModifyFlag(); //SRN: Mark the study as being modified, so it could be saved 
 }
@@ -88,7 +91,54 @@ DF_Attribute* SALOMEDSImpl_AttributeName::NewEmpty () const
 //=======================================================================
 void SALOMEDSImpl_AttributeName::Restore(DF_Attribute* with) 
 {
+  std::string anOldValue = myString;
   myString = dynamic_cast<SALOMEDSImpl_AttributeName*>(with)->Value ();
+  ValueChanged(anOldValue);
+}
+
+//=======================================================================
+//function : Load
+//purpose  : 
+//=======================================================================
+void SALOMEDSImpl_AttributeName::Load(const std::string& theValue)
+{
+  std::string anOldValue = myString;
+  myString = theValue;
+  ValueChanged(anOldValue);
+}
+
+//=======================================================================
+//function : AfterAddition
+//purpose  : Registers the label in the map of names of the study
+//=======================================================================
+void SALOMEDSImpl_AttributeName::AfterAddition()
+{
+  SALOMEDSImpl_Study* study = SALOMEDSImpl_Study::GetStudyImpl(Label());
+  if (study) study->AddNameLabelMapItem(myString, Label());
+}
+
+//=======================================================================
+//function : BeforeForget
+//purpose  : Removes the label from the map of names of the study
+//=======================================================================
+void SALOMEDSImpl_AttributeName::BeforeForget()
+{
+  SALOMEDSImpl_Study* study = SALOMEDSImpl_Study::GetStudyImpl(Label());
+  if (study) study->DeleteNameLabelMapItem(myString, Label());
+}
+
+//=======================================================================
+//function : ValueChanged
+//purpose  : Updates the map of names of the study
+//=======================================================================
+void SALOMEDSImpl_AttributeName::ValueChanged(const std::string& theOldValue)
+{
+  if (!_node || theOldValue == myString) return;
+  SALOMEDSImpl_Study* study = SALOMEDSImpl_Study::GetStudyImpl(Label());
+  if (study) {
+    study->DeleteNameLabelMapItem(theOldValue, Label());
+    study->AddNameLabelMapItem(myString, Label());
+  }
 }
 
 //=======================================================================
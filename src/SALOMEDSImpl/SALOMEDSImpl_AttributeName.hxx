@@ -41,6 +41,8 @@ private:
 
   std::string myString;
 
+  void ValueChanged(const std::string& theOldValue);
+
 public:
   static const std::string& GetID() ;
 
@@ -50,13 +52,16 @@ public:
   std::string Value() const { return myString; }  
 
   virtual std::string Save() { return myString; }
-  virtual void Load(const std::string& theValue) { myString = theValue; } 
+  virtual void Load(const std::string& theValue);
 
   const std::string& ID() const;
   void Restore(DF_Attribute* with) ;
   DF_Attribute* NewEmpty() const;
   void Paste(DF_Attribute* into);
 
+  virtual void AfterAddition();
+  virtual void BeforeForget();
+
   ~SALOMEDSImpl_AttributeName() {}
 
 };
@@ -48,8 +48,8 @@ SALOMEDSImpl_AttributeOpened* SALOMEDSImpl_AttributeOpened::Set (const DF_Label&
                                                                  const int value) 
 {
   SALOMEDSImpl_AttributeOpened* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeOpened*)L.FindAttribute(SALOMEDSImpl_AttributeOpened::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeOpened(); 
+  if (!(A=(SALOMEDSImpl_AttributeOpened*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeOpened>()))) {
+    A = new(L) SALOMEDSImpl_AttributeOpened(); 
     L.AddAttribute(A);
   }
   
@@ -96,8 +96,8 @@ const std::string& SALOMEDSImpl_AttributeParameter::GetID ()
 SALOMEDSImpl_AttributeParameter* SALOMEDSImpl_AttributeParameter::Set (const DF_Label& L) 
 {
   SALOMEDSImpl_AttributeParameter* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeParameter*)L.FindAttribute(SALOMEDSImpl_AttributeParameter::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeParameter(); 
+  if (!(A=(SALOMEDSImpl_AttributeParameter*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeParameter>()))) {
+    A = new(L) SALOMEDSImpl_AttributeParameter(); 
     L.AddAttribute(A);
   }
 
@@ -430,7 +430,7 @@ SALOMEDSImpl_AttributeParameter* SALOMEDSImpl_AttributeParameter::GetFather()
 
   while(!L.IsRoot()) {
     L = L.Father();
-    if((aFather=(SALOMEDSImpl_AttributeParameter*)L.FindAttribute(SALOMEDSImpl_AttributeParameter::GetID()))) break; 
+    if((aFather=(SALOMEDSImpl_AttributeParameter*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeParameter>()))) break; 
   }
 
   return aFather;
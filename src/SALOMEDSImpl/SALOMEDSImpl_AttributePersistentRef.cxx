@@ -48,8 +48,8 @@ SALOMEDSImpl_AttributePersistentRef* SALOMEDSImpl_AttributePersistentRef::Set (c
                                                                                const std::string& S)
 {
   SALOMEDSImpl_AttributePersistentRef* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributePersistentRef*)L.FindAttribute(SALOMEDSImpl_AttributePersistentRef::GetID()))) {
-    A = new  SALOMEDSImpl_AttributePersistentRef(); 
+  if (!(A=(SALOMEDSImpl_AttributePersistentRef*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributePersistentRef>()))) {
+    A = new(L) SALOMEDSImpl_AttributePersistentRef(); 
     L.AddAttribute(A);
   }
   
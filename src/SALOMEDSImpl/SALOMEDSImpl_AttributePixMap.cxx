@@ -48,8 +48,8 @@ SALOMEDSImpl_AttributePixMap* SALOMEDSImpl_AttributePixMap::Set (const DF_Label&
                                                                  const std::string& S) 
 {
   SALOMEDSImpl_AttributePixMap* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributePixMap*)L.FindAttribute(SALOMEDSImpl_AttributePixMap::GetID()))) {
-    A = new  SALOMEDSImpl_AttributePixMap(); 
+  if (!(A=(SALOMEDSImpl_AttributePixMap*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributePixMap>()))) {
+    A = new(L) SALOMEDSImpl_AttributePixMap(); 
     L.AddAttribute(A);
   }
   
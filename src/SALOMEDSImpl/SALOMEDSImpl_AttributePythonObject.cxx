@@ -35,8 +35,8 @@ const std::string& SALOMEDSImpl_AttributePythonObject::GetID()
 SALOMEDSImpl_AttributePythonObject* SALOMEDSImpl_AttributePythonObject::Set(const DF_Label& label) 
 {
   SALOMEDSImpl_AttributePythonObject* A = NULL;
-  if (!(A = (SALOMEDSImpl_AttributePythonObject*)label.FindAttribute(SALOMEDSImpl_AttributePythonObject::GetID()))) {
-    A = new SALOMEDSImpl_AttributePythonObject();
+  if (!(A = (SALOMEDSImpl_AttributePythonObject*)label.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributePythonObject>()))) {
+    A = new(label) SALOMEDSImpl_AttributePythonObject();
     label.AddAttribute(A);
   }
   return A;
@@ -42,8 +42,8 @@ const std::string& SALOMEDSImpl_AttributeReal::GetID ()
 SALOMEDSImpl_AttributeReal* SALOMEDSImpl_AttributeReal::Set (const DF_Label& L, const double& Val) 
 {
   SALOMEDSImpl_AttributeReal* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeReal*)L.FindAttribute(SALOMEDSImpl_AttributeReal::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeReal(); 
+  if (!(A=(SALOMEDSImpl_AttributeReal*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReal>()))) {
+    A = new(L) SALOMEDSImpl_AttributeReal(); 
     L.AddAttribute(A);
   }
 
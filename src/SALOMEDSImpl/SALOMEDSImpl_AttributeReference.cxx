@@ -40,8 +40,8 @@ SALOMEDSImpl_AttributeReference* SALOMEDSImpl_AttributeReference::Set(const DF_L
                                                                       const DF_Label& theRefLabel)
 {
   SALOMEDSImpl_AttributeReference* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeReference*)theLabel.FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeReference(); 
+  if (!(A=(SALOMEDSImpl_AttributeReference*)theLabel.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) {
+    A = new(theLabel) SALOMEDSImpl_AttributeReference(); 
     theLabel.AddAttribute(A);
   }
 
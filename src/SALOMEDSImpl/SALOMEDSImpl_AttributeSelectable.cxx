@@ -48,8 +48,8 @@ SALOMEDSImpl_AttributeSelectable* SALOMEDSImpl_AttributeSelectable::Set (const D
                                                                          const int value) 
 {
   SALOMEDSImpl_AttributeSelectable* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeSelectable*)L.FindAttribute(SALOMEDSImpl_AttributeSelectable::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeSelectable(); 
+  if (!(A=(SALOMEDSImpl_AttributeSelectable*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeSelectable>()))) {
+    A = new(L) SALOMEDSImpl_AttributeSelectable(); 
     L.AddAttribute(A);
   }
   
@@ -25,9 +25,12 @@
 //  Module : SALOME
 //
 #include "SALOMEDSImpl_AttributeSequenceOfInteger.hxx"
+#include "SALOMEDSImpl_BinaryStream.hxx"
 #include <string.h>
 #include <stdlib.h>
 
+#define BINARY_VERSION 1
+
 //=======================================================================
 //function : GetID
 //purpose  : 
@@ -49,8 +52,8 @@ const std::string& SALOMEDSImpl_AttributeSequenceOfInteger::GetID ()
 SALOMEDSImpl_AttributeSequenceOfInteger* SALOMEDSImpl_AttributeSequenceOfInteger::Set (const DF_Label& L) 
 {
   SALOMEDSImpl_AttributeSequenceOfInteger* A = NULL;
-  if (!(A = (SALOMEDSImpl_AttributeSequenceOfInteger*)L.FindAttribute(SALOMEDSImpl_AttributeSequenceOfInteger::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeSequenceOfInteger(); 
+  if (!(A = (SALOMEDSImpl_AttributeSequenceOfInteger*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeSequenceOfInteger>()))) {
+    A = new(L) SALOMEDSImpl_AttributeSequenceOfInteger(); 
     L.AddAttribute(A);
   }
   return A;
@@ -195,3 +198,27 @@ void SALOMEDSImpl_AttributeSequenceOfInteger::Load(const std::string& value)
     adr = strtok(NULL, " ");
   }
 }
+
+std::string SALOMEDSImpl_AttributeSequenceOfInteger::SaveBinary()
+{
+  std::string aString;
+  SALOMEDSImpl_BinaryWriter aWriter(aString);
+  aWriter.Integer(BINARY_VERSION);
+  aWriter.Integer((int)myValue.size());
+  aWriter.Integers(myValue.empty() ? NULL : &myValue[0], myValue.size());
+  return aString;
+}
+
+bool SALOMEDSImpl_AttributeSequenceOfInteger::LoadBinary(const std::string& value)
+{
+  SALOMEDSImpl_BinaryReader aReader(value);
+  int aVersion = 0, aLength = 0;
+  std::vector<int> aValues;
+  if (!aReader.Integer(aVersion) || aVersion != BINARY_VERSION ||
+      !aReader.Integer(aLength) || !aReader.Integers(aValues, aLength))
+    return false;
+
+  Backup();
+  myValue.swap(aValues);
+  return true;
+}
@@ -25,9 +25,12 @@
 //  Module : SALOME
 //
 #include "SALOMEDSImpl_AttributeSequenceOfReal.hxx"
+#include "SALOMEDSImpl_BinaryStream.hxx"
 #include <string.h>
 #include <stdlib.h>
 
+#define BINARY_VERSION 1
+
 //=======================================================================
 //function : GetID
 //purpose  : 
@@ -49,8 +52,8 @@ const std::string& SALOMEDSImpl_AttributeSequenceOfReal::GetID ()
 SALOMEDSImpl_AttributeSequenceOfReal* SALOMEDSImpl_AttributeSequenceOfReal::Set (const DF_Label& L) 
 {
   SALOMEDSImpl_AttributeSequenceOfReal* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeSequenceOfReal*)L.FindAttribute(SALOMEDSImpl_AttributeSequenceOfReal::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeSequenceOfReal(); 
+  if (!(A=(SALOMEDSImpl_AttributeSequenceOfReal*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeSequenceOfReal>()))) {
+    A = new(L) SALOMEDSImpl_AttributeSequenceOfReal(); 
     L.AddAttribute(A);
   }
   return A;
@@ -198,3 +201,27 @@ void SALOMEDSImpl_AttributeSequenceOfReal::Load(const std::string& value)
     adr = strtok(NULL, " ");
   }
 }    
+
+std::string SALOMEDSImpl_AttributeSequenceOfReal::SaveBinary()
+{
+  std::string aString;
+  SALOMEDSImpl_BinaryWriter aWriter(aString);
+  aWriter.Integer(BINARY_VERSION);
+  aWriter.Integer((int)myValue.size());
+  aWriter.Reals(myValue.empty() ? NULL : &myValue[0], myValue.size());
+  return aString;
+}
+
+bool SALOMEDSImpl_AttributeSequenceOfReal::LoadBinary(const std::string& value)
+{
+  SALOMEDSImpl_BinaryReader aReader(value);
+  int aVersion = 0, aLength = 0;
+  std::vector<double> aValues;
+  if (!aReader.Integer(aVersion) || aVersion != BINARY_VERSION ||
+      !aReader.Integer(aLength) || !aReader.Reals(aValues, aLength))
+    return false;
+
+  Backup();
+  myValue.swap(aValues);
+  return true;
+}
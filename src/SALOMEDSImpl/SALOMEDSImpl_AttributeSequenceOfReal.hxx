@@ -43,6 +43,8 @@ public:
 
   virtual std::string Save();
   virtual void Load(const std::string&);
+  virtual std::string SaveBinary();
+  virtual bool LoadBinary(const std::string&);
 
   static const std::string& GetID() ;
   static SALOMEDSImpl_AttributeSequenceOfReal* Set(const DF_Label& label) ;
@@ -40,8 +40,8 @@ SALOMEDSImpl_AttributeString* SALOMEDSImpl_AttributeString::Set (const DF_Label&
                                                                  const std::string& Val) 
 {
   SALOMEDSImpl_AttributeString* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeString*)L.FindAttribute(SALOMEDSImpl_AttributeString::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeString(); 
+  if (!(A=(SALOMEDSImpl_AttributeString*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeString>()))) {
+    A = new(L) SALOMEDSImpl_AttributeString(); 
     L.AddAttribute(A);
   }
 
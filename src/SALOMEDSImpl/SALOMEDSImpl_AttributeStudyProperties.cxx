@@ -37,8 +37,8 @@ const std::string& SALOMEDSImpl_AttributeStudyProperties::GetID()
 SALOMEDSImpl_AttributeStudyProperties* SALOMEDSImpl_AttributeStudyProperties::Set(const DF_Label& label)
 {
   SALOMEDSImpl_AttributeStudyProperties* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeStudyProperties*)label.FindAttribute(SALOMEDSImpl_AttributeStudyProperties::GetID()))) {
-    A = new SALOMEDSImpl_AttributeStudyProperties();
+  if (!(A=(SALOMEDSImpl_AttributeStudyProperties*)label.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeStudyProperties>()))) {
+    A = new(label) SALOMEDSImpl_AttributeStudyProperties();
     label.AddAttribute(A);
   }
   return A;
@@ -25,6 +25,10 @@
 
 #include "SALOMEDSImpl_Defines.hxx"
 
+#include <vector>
+#include <map>
+#include <algorithm>
+
 class SALOMEDSIMPL_EXPORT SALOMEDSImpl_AttributeTable
 {
 public:
@@ -103,4 +107,333 @@ public:
   }
 };
 
+//! Storage of the cells of a table of numbers.
+//! Filled tables are stored column by column in a contiguous array, with a bitmap
+//! of the set cells; sparse tables fall back to a map of the set cells.
+//! Rows and columns are numbered from 1; unset cells read as T().
+template <class T> class TableStorage
+{
+  typedef std::pair<int, int>                    Key;      // (row, column)
+  typedef std::map<Key, T>                       SparseMap;
+  typedef typename SparseMap::const_iterator     SparseIterator;
+
+  // dense while at least a 1/DENSE_RATIO of the cells is set,
+  // back to sparse below 1/SPARSE_RATIO
+  enum { DENSE_RATIO = 4, SPARSE_RATIO = 8, MIN_ROWS = 16 };
+
+  bool              myIsDense;
+  int               myNbRows;        // rows of the stored extent
+  int               myNbColumns;     // columns of the stored extent
+  int               myRowsCapacity;  // stride between two columns of the dense array
+  int               myCount;         // number of set cells
+  std::vector<T>    myValues;        // dense, column-major, T() in the unset cells
+  std::vector<bool> myIsSet;         // dense, set cells
+  SparseMap         mySparse;        // sparse, set cells
+
+public:
+  TableStorage()
+    : myIsDense( true ), myNbRows( 0 ), myNbColumns( 0 ), myRowsCapacity( 0 ), myCount( 0 ) {}
+
+  int  Count() const   { return myCount; }
+  bool IsDense() const { return myIsDense; }
+
+  void Clear()
+  {
+    *this = TableStorage();
+  }
+
+  bool Has( int theRow, int theColumn ) const
+  {
+    if ( !contains( theRow, theColumn ) ) return false;
+    if ( myIsDense ) return myIsSet[ index( theRow, theColumn ) ];
+    return mySparse.find( Key( theRow, theColumn ) ) != mySparse.end();
+  }
+
+  T Get( int theRow, int theColumn ) const
+  {
+    if ( !contains( theRow, theColumn ) ) return T();
+    if ( myIsDense ) return myValues[ index( theRow, theColumn ) ];
+    SparseIterator it = mySparse.find( Key( theRow, theColumn ) );
+    return it == mySparse.end() ? T() : it->second;
+  }
+
+  void Put( const T& theValue, int theRow, int theColumn )
+  {
+    if ( theRow > myNbRows || theColumn > myNbColumns )
+      resize( std::max( theRow, myNbRows ), std::max( theColumn, myNbColumns ), myCount+1 );
+    if ( myIsDense ) {
+      size_t i = index( theRow, theColumn );
+      if ( !myIsSet[i] ) {
+        myIsSet[i] = true;
+        myCount++;
+      }
+      myValues[i] = theValue;
+    }
+    else {
+      std::pair<typename SparseMap::iterator, bool> anInserted = mySparse.insert( std::make_pair( Key( theRow, theColumn ), theValue ) );
+      if ( !anInserted.second )
+        anInserted.first->second = theValue;
+      else if ( ++myCount * (size_t)DENSE_RATIO >= cells( myNbRows, myNbColumns ) )
+        toDense();
+    }
+  }
+
+  //! Returns false if the cell was not set
+  bool Remove( int theRow, int theColumn )
+  {
+    if ( !contains( theRow, theColumn ) ) return false;
+    if ( myIsDense ) {
+      size_t i = index( theRow, theColumn );
+      if ( !myIsSet[i] ) return false;
+      myIsSet[i] = false;
+      myValues[i] = T();
+      if ( --myCount * (size_t)SPARSE_RATIO < cells( myNbRows, myNbColumns ) )
+        toSparse();
+    }
+    else {
+      if ( !mySparse.erase( Key( theRow, theColumn ) ) ) return false;
+      myCount--;
+    }
+    return true;
+  }
+
+  //! Returns false if the cells are left unchanged
+  bool Swap( int theRow1, int theColumn1, int theRow2, int theColumn2 )
+  {
+    bool hasValue1 = Has( theRow1, theColumn1 ), hasValue2 = Has( theRow2, theColumn2 );
+    if ( !hasValue1 && !hasValue2 ) return false;
+    T aValue1 = Get( theRow1, theColumn1 ), aValue2 = Get( theRow2, theColumn2 );
+    if ( hasValue1 && hasValue2 && aValue1 == aValue2 ) return false;
+    if ( !contains( theRow1, theColumn1 ) || !contains( theRow2, theColumn2 ) ) {
+      // one of the cells is beyond the stored extent
+      if ( hasValue1 ) Put( aValue1, theRow2, theColumn2 );
+      else             Remove( theRow2, theColumn2 );
+      if ( hasValue2 ) Put( aValue2, theRow1, theColumn1 );
+      else             Remove( theRow1, theColumn1 );
+    }
+    else if ( myIsDense ) {
+      size_t i1 = index( theRow1, theColumn1 ), i2 = index( theRow2, theColumn2 );
+      myValues[i2] = hasValue1 ? aValue1 : T();
+      myValues[i1] = hasValue2 ? aValue2 : T();
+      myIsSet[i2] = hasValue1;
+      myIsSet[i1] = hasValue2;
+    }
+    else {
+      if ( hasValue1 ) mySparse[ Key( theRow2, theColumn2 ) ] = aValue1;
+      else             mySparse.erase( Key( theRow2, theColumn2 ) );
+      if ( hasValue2 ) mySparse[ Key( theRow1, theColumn1 ) ] = aValue2;
+      else             mySparse.erase( Key( theRow1, theColumn1 ) );
+    }
+    return true;
+  }
+
+  //! Returns false if the rows are left unchanged
+  bool SwapRows( int theRow1, int theRow2 )
+  {
+    if ( theRow1 == theRow2 || theRow1 < 1 || theRow2 < 1 ) return false;
+    bool isChanged = false;
+    if ( myIsDense ) {
+      for ( int aColumn = 1; aColumn <= myNbColumns; aColumn++ )
+        isChanged = Swap( theRow1, aColumn, theRow2, aColumn ) || isChanged;
+    }
+    else {
+      // only the columns set in one of the rows
+      std::vector<int> aColumns;
+      columnsOfRow( theRow1, aColumns );
+      columnsOfRow( theRow2, aColumns );
+      std::sort( aColumns.begin(), aColumns.end() );
+      aColumns.erase( std::unique( aColumns.begin(), aColumns.end() ), aColumns.end() );
+      for ( size_t i = 0; i < aColumns.size(); i++ )
+        isChanged = Swap( theRow1, aColumns[i], theRow2, aColumns[i] ) || isChanged;
+    }
+    return isChanged;
+  }
+
+  //! Returns false if the columns are left unchanged
+  bool SwapColumns( int theColumn1, int theColumn2 )
+  {
+    bool isChanged = false;
+    for ( int aRow = 1; aRow <= myNbRows && theColumn1 != theColumn2; aRow++ )
+      isChanged = Swap( aRow, theColumn1, aRow, theColumn2 ) || isChanged;
+    return isChanged;
+  }
+
+  //! Drops the cells beyond the new number of columns
+  void SetNbColumns( int theNbColumns )
+  {
+    if ( theNbColumns < myNbColumns ) {
+      if ( myIsDense ) {
+        size_t aSize = (size_t)myRowsCapacity * theNbColumns;
+        for ( size_t i = aSize; i < myIsSet.size(); i++ )
+          if ( myIsSet[i] ) myCount--;
+        myValues.resize( aSize );
+        myIsSet.resize( aSize );
+        myNbColumns = theNbColumns;
+      }
+      else {
+        for ( typename SparseMap::iterator it = mySparse.begin(); it != mySparse.end(); ) {
+          if ( it->first.second > theNbColumns ) {
+            mySparse.erase( it++ );
+            myCount--;
+          }
+          else ++it;
+        }
+        myNbColumns = theNbColumns;
+        if ( myCount * (size_t)DENSE_RATIO >= cells( myNbRows, myNbColumns ) )
+          toDense();
+      }
+    }
+    else if ( theNbColumns > myNbColumns )
+      resize( myNbRows, theNbColumns, myCount );
+  }
+
+  //! Values of a row, theNbColumns cells
+  void GetRow( int theRow, int theNbColumns, std::vector<T>& theValues ) const
+  {
+    theValues.assign( theNbColumns, T() );
+    if ( theRow < 1 || theRow > myNbRows ) return;
+    int aNbColumns = std::min( theNbColumns, myNbColumns );
+    if ( myIsDense ) {
+      const T* aValue = myValues.empty() ? 0 : &myValues[ theRow-1 ];
+      for ( int i = 0; i < aNbColumns; i++, aValue += myRowsCapacity )
+        theValues[i] = *aValue;
+    }
+    else {
+      SparseIterator it = mySparse.lower_bound( Key( theRow, 1 ) );
+      for ( ; it != mySparse.end() && it->first.first == theRow && it->first.second <= aNbColumns; ++it )
+        theValues[ it->first.second-1 ] = it->second;
+    }
+  }
+
+  //! Values of a column, theNbRows cells
+  void GetColumn( int theColumn, int theNbRows, std::vector<T>& theValues ) const
+  {
+    theValues.assign( theNbRows, T() );
+    if ( theColumn < 1 || theColumn > myNbColumns ) return;
+    int aNbRows = std::min( theNbRows, myNbRows );
+    if ( myIsDense ) {
+      if ( aNbRows > 0 ) {
+        typename std::vector<T>::const_iterator aFirst = myValues.begin() + index( 1, theColumn );
+        std::copy( aFirst, aFirst + aNbRows, theValues.begin() );
+      }
+    }
+    else if ( myCount < aNbRows ) {
+      for ( SparseIterator it = mySparse.begin(); it != mySparse.end(); ++it )
+        if ( it->first.second == theColumn && it->first.first <= aNbRows )
+          theValues[ it->first.first-1 ] = it->second;
+    }
+    else {
+      for ( int aRow = 1; aRow <= aNbRows; aRow++ ) {
+        SparseIterator it = mySparse.find( Key( aRow, theColumn ) );
+        if ( it != mySparse.end() ) theValues[ aRow-1 ] = it->second;
+      }
+    }
+  }
+
+  //! Calls theVisitor( row, column, value ) for the set cells, row by row
+  template <class TVisitor> void Visit( TVisitor& theVisitor ) const
+  {
+    if ( myIsDense ) {
+      for ( int aRow = 1; aRow <= myNbRows; aRow++ )
+        for ( int aColumn = 1; aColumn <= myNbColumns; aColumn++ ) {
+          size_t i = index( aRow, aColumn );
+          if ( myIsSet[i] ) theVisitor( aRow, aColumn, myValues[i] );
+        }
+    }
+    else {
+      for ( SparseIterator it = mySparse.begin(); it != mySparse.end(); ++it )
+        theVisitor( it->first.first, it->first.second, it->second );
+    }
+  }
+
+private:
+  static size_t cells( int theNbRows, int theNbColumns )
+  {
+    return (size_t)theNbRows * theNbColumns;
+  }
+
+  bool contains( int theRow, int theColumn ) const
+  {
+    return theRow >= 1 && theRow <= myNbRows && theColumn >= 1 && theColumn <= myNbColumns;
+  }
+
+  size_t index( int theRow, int theColumn ) const
+  {
+    return (size_t)(theColumn-1) * myRowsCapacity + (theRow-1);
+  }
+
+  // appends the set columns of a row of the sparse map
+  void columnsOfRow( int theRow, std::vector<int>& theColumns ) const
+  {
+    SparseIterator it = mySparse.lower_bound( Key( theRow, 1 ) );
+    for ( ; it != mySparse.end() && it->first.first == theRow; ++it )
+      theColumns.push_back( it->first.second );
+  }
+
+  // grows the extent, theCount being the number of cells set once it is grown
+  void resize( int theNbRows, int theNbColumns, int theCount )
+  {
+    if ( !myIsDense ) {
+      myNbRows = theNbRows;
+      myNbColumns = theNbColumns;
+      return;
+    }
+    if ( theCount * (size_t)SPARSE_RATIO < cells( theNbRows, theNbColumns ) ) {
+      toSparse();
+      myNbRows = theNbRows;
+      myNbColumns = theNbColumns;
+      return;
+    }
+    if ( theNbRows > myRowsCapacity ) {
+      // the rows are appended one by one in most of the cases
+      int aCapacity = std::max( theNbRows, std::max( 2 * myRowsCapacity, (int)MIN_ROWS ) );
+      std::vector<T> aValues( (size_t)aCapacity * theNbColumns, T() );
+      std::vector<bool> anIsSet( aValues.size(), false );
+      for ( int aColumn = 1; aColumn <= myNbColumns; aColumn++ )
+        for ( int aRow = 1; aRow <= myNbRows; aRow++ ) {
+          size_t i = index( aRow, aColumn ), j = (size_t)(aColumn-1) * aCapacity + (aRow-1);
+          aValues[j] = myValues[i];
+          anIsSet[j] = myIsSet[i];
+        }
+      myValues.swap( aValues );
+      myIsSet.swap( anIsSet );
+      myRowsCapacity = aCapacity;
+    }
+    else if ( theNbColumns > myNbColumns ) {
+      myValues.resize( (size_t)myRowsCapacity * theNbColumns, T() );
+      myIsSet.resize( myValues.size(), false );
+    }
+    myNbRows = theNbRows;
+    myNbColumns = theNbColumns;
+  }
+
+  void toDense()
+  {
+    SparseMap aSparse;
+    aSparse.swap( mySparse );
+    myIsDense = true;
+    myRowsCapacity = myNbRows;
+    myValues.assign( cells( myNbRows, myNbColumns ), T() );
+    myIsSet.assign( myValues.size(), false );
+    for ( SparseIterator it = aSparse.begin(); it != aSparse.end(); ++it ) {
+      size_t i = index( it->first.first, it->first.second );
+      myValues[i] = it->second;
+      myIsSet[i] = true;
+    }
+  }
+
+  void toSparse()
+  {
+    for ( int aRow = 1; aRow <= myNbRows; aRow++ )
+      for ( int aColumn = 1; aColumn <= myNbColumns; aColumn++ ) {
+        size_t i = index( aRow, aColumn );
+        if ( myIsSet[i] ) mySparse.insert( mySparse.end(), std::make_pair( Key( aRow, aColumn ), myValues[i] ) );
+      }
+    myIsDense = false;
+    myRowsCapacity = 0;
+    std::vector<T>().swap( myValues );
+    std::vector<bool>().swap( myIsSet );
+  }
+};
+
 #endif // _SALOMEDSImpl_AttributeTable_HeaderFile
@@ -25,12 +25,50 @@
 //  Module : SALOME
 //
 #include "SALOMEDSImpl_AttributeTableOfInteger.hxx"
+#include "SALOMEDSImpl_BinaryStream.hxx"
 
 #include <sstream>
 #include <algorithm>
 
 #define SEPARATOR '\1'
-typedef std::map<int, int>::const_iterator MI;
+#define BINARY_VERSION 1
+
+namespace
+{
+  // writes the set cells in the persistent string, with their former key
+  struct ValueWriter
+  {
+    std::string& myString;
+    int          myNbColumns;
+    char*        myBuffer;
+
+    ValueWriter(std::string& theString, int theNbColumns, char* theBuffer)
+      : myString(theString), myNbColumns(theNbColumns), myBuffer(theBuffer) {}
+
+    void operator()(int theRow, int theColumn, const int& theValue)
+    {
+      sprintf(myBuffer, "%d\n%d\n", (theRow-1)*myNbColumns+theColumn, theValue);
+      myString += myBuffer;
+    }
+  };
+
+  // collects the set cells and their former key, for the binary form
+  struct ValueCollector
+  {
+    std::vector<int>&  myKeys;
+    std::vector<int>&  myValues;
+    int                myNbColumns;
+
+    ValueCollector(std::vector<int>& theKeys, std::vector<int>& theValues, int theNbColumns)
+      : myKeys(theKeys), myValues(theValues), myNbColumns(theNbColumns) {}
+
+    void operator()(int theRow, int theColumn, const int& theValue)
+    {
+      myKeys.push_back((theRow-1)*myNbColumns+theColumn);
+      myValues.push_back(theValue);
+    }
+  };
+}
 
 static std::string getUnit(std::string theString)
 {
@@ -55,8 +93,8 @@ const std::string& SALOMEDSImpl_AttributeTableOfInteger::GetID()
 SALOMEDSImpl_AttributeTableOfInteger* SALOMEDSImpl_AttributeTableOfInteger::Set(const DF_Label& label) 
 {
   SALOMEDSImpl_AttributeTableOfInteger* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeTableOfInteger*)label.FindAttribute(SALOMEDSImpl_AttributeTableOfInteger::GetID()))) {
-    A = new SALOMEDSImpl_AttributeTableOfInteger();
+  if (!(A=(SALOMEDSImpl_AttributeTableOfInteger*)label.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeTableOfInteger>()))) {
+    A = new(label) SALOMEDSImpl_AttributeTableOfInteger();
     label.AddAttribute(A);
   }
   return A;
@@ -74,18 +112,7 @@ void SALOMEDSImpl_AttributeTableOfInteger::SetNbColumns(const int theNbColumns)
   CheckLocked();  
   Backup();
   
-  std::map<int, int> aMap;
-  aMap = myTable;
-  myTable.clear();
-
-  for(MI p = aMap.begin(); p != aMap.end(); p++) {
-    int aRow = (int)(p->first/myNbColumns) + 1;
-    int aCol = (int)(p->first - myNbColumns*(aRow-1));
-    if(aCol == 0) { aCol = myNbColumns; aRow--; }
-    if(aCol > theNbColumns) continue;
-    int aKey = (aRow-1)*theNbColumns+aCol;
-    myTable[aKey] = p->second;
-  }
+  myTable.SetNbColumns(theNbColumns);
 
   myNbColumns = theNbColumns;
 
@@ -122,9 +149,9 @@ void SALOMEDSImpl_AttributeTableOfInteger::SetRowData(const int theRow,
     myRows.push_back(std::string(""));
   }
 
-  size_t i, aShift = (theRow-1)*myNbColumns, aLength = theData.size();
+  size_t i, aLength = theData.size();
   for(i = 1; i <= aLength; i++) {
-    myTable[(int)(aShift + i)] = theData[i-1]; //!< TODO: conversion from size_t to int
+    myTable.Put(theData[i-1], theRow, (int)i); //!< TODO: conversion from size_t to int
   }
 
   if(theRow > myNbRows) myNbRows = theRow;
@@ -135,14 +162,7 @@ void SALOMEDSImpl_AttributeTableOfInteger::SetRowData(const int theRow,
 std::vector<int> SALOMEDSImpl_AttributeTableOfInteger::GetRowData(const int theRow)
 {
   std::vector<int> aSeq;
-  int i, aShift = (theRow-1)*myNbColumns;
-  for(i = 1; i <= myNbColumns; i++) {
-     if(myTable.find(aShift+i) != myTable.end()) 
-       aSeq.push_back(myTable[aShift+i]);
-     else
-       aSeq.push_back(0);
-  }
-  
+  myTable.GetRow(theRow, myNbColumns, aSeq);
   return aSeq;
 }
 
@@ -229,7 +249,7 @@ void SALOMEDSImpl_AttributeTableOfInteger::SetColumnData(const int theColumn,
 
   size_t i, aLength = theData.size();
   for(i = 1; i <= aLength; i++) {
-    myTable[myNbColumns*((int)i-1)+theColumn] = theData[i-1]; //!< TODO: conversion from size_t to int
+    myTable.Put(theData[i-1], (int)i, theColumn); //!< TODO: conversion from size_t to int
   }
 
   if((int)aLength > myNbRows) {
@@ -246,15 +266,7 @@ void SALOMEDSImpl_AttributeTableOfInteger::SetColumnData(const int theColumn,
 std::vector<int> SALOMEDSImpl_AttributeTableOfInteger::GetColumnData(const int theColumn)
 {
   std::vector<int> aSeq;
-  int i, anIndex;
-  for(i = 1; i <= myNbRows; i++) {
-    anIndex = myNbColumns*(i-1) + theColumn;
-    if(myTable.find(anIndex) != myTable.end()) 
-      aSeq.push_back(myTable[anIndex]);
-    else
-      aSeq.push_back(0);
-  }
-  
+  myTable.GetColumn(theColumn, myNbRows, aSeq);
   return aSeq;
 }
 
@@ -311,8 +323,7 @@ void SALOMEDSImpl_AttributeTableOfInteger::PutValue(const int theValue,
   //Backup();
   if(theColumn > myNbColumns) SetNbColumns(theColumn);
 
-  int anIndex = (theRow-1)*myNbColumns + theColumn;
-  myTable[anIndex] = theValue;
+  myTable.Put(theValue, theRow, theColumn);
 
   if(theRow > myNbRows) {
     while ((int)myRows.size() < theRow) { // append empty row titles
@@ -329,8 +340,7 @@ bool SALOMEDSImpl_AttributeTableOfInteger::HasValue(const int theRow,
 {
   if(theRow > myNbRows || theRow < 1) return false;
   if(theColumn > myNbColumns || theColumn < 1) return false;
-  int anIndex = (theRow-1)*myNbColumns + theColumn;
-  return (myTable.find(anIndex) != myTable.end()); 
+  return myTable.Has(theRow, theColumn);
 }
 
 int SALOMEDSImpl_AttributeTableOfInteger::GetValue(const int theRow,
@@ -339,8 +349,7 @@ int SALOMEDSImpl_AttributeTableOfInteger::GetValue(const int theRow,
   if(theRow > myNbRows || theRow < 1) throw DFexception("Invalid cell index");
   if(theColumn > myNbColumns || theColumn < 1) throw DFexception("Invalid cell index");
 
-  int anIndex = (theRow-1)*myNbColumns + theColumn;
-  if(myTable.find(anIndex) != myTable.end()) return myTable[anIndex];
+  if(myTable.Has(theRow, theColumn)) return myTable.Get(theRow, theColumn);
   
   throw DFexception("Invalid cell index");
   return 0;
@@ -352,10 +361,8 @@ void SALOMEDSImpl_AttributeTableOfInteger::RemoveValue(const int theRow, const i
   if(theRow > myNbRows || theRow < 1) throw DFexception("Invalid cell index");
   if(theColumn > myNbColumns || theColumn < 1) throw DFexception("Invalid cell index");
 
-  int anIndex = (theRow-1)*myNbColumns + theColumn;
-  if (myTable.find(anIndex) != myTable.end()) {
+  if (myTable.Remove(theRow, theColumn)) {
     //Backup();
-    myTable.erase(anIndex);
     SetModifyFlag(); // table is modified
   }
 }
@@ -371,7 +378,7 @@ void SALOMEDSImpl_AttributeTableOfInteger::Restore(DF_Attribute* with)
   SALOMEDSImpl_AttributeTableOfInteger* aTable = dynamic_cast<SALOMEDSImpl_AttributeTableOfInteger*>(with);
   if(!aTable) throw DFexception("Can't Restore from a null attribute");    
 
-  myTable.clear();
+  myTable.Clear();
   myCols.clear();
   myRows.clear();
 
@@ -398,7 +405,7 @@ void SALOMEDSImpl_AttributeTableOfInteger::Paste(DF_Attribute* into)
   SALOMEDSImpl_AttributeTableOfInteger* aTable = dynamic_cast<SALOMEDSImpl_AttributeTableOfInteger*>(into);
   if(!aTable) throw DFexception("Can't Paste into a null attribute");    
 
-  aTable->myTable.clear();
+  aTable->myTable.Clear();
   aTable->myCols.clear();
   aTable->myRows.clear();
 
@@ -417,9 +424,9 @@ std::vector<int> SALOMEDSImpl_AttributeTableOfInteger::GetSetRowIndices(const in
 {
   std::vector<int> aSeq;
 
-  int i, aShift = myNbColumns*(theRow-1);
+  int i;
   for(i = 1; i <= myNbColumns; i++) {
-    if(myTable.find(aShift + i) != myTable.end()) aSeq.push_back(i);
+    if(myTable.Has(theRow, i)) aSeq.push_back(i);
   }
   
   return aSeq;
@@ -429,10 +436,9 @@ std::vector<int> SALOMEDSImpl_AttributeTableOfInteger::GetSetColumnIndices(const
 {
   std::vector<int> aSeq;
 
-  int i, anIndex;
+  int i;
   for(i = 1; i <= myNbRows; i++) {
-    anIndex = myNbColumns*(i-1)+theColumn;
-    if(myTable.find(anIndex) != myTable.end()) aSeq.push_back(i);
+    if(myTable.Has(i, theColumn)) aSeq.push_back(i);
   }
   
   return aSeq;
@@ -484,13 +490,11 @@ std::string SALOMEDSImpl_AttributeTableOfInteger::Save()
   }
 
   //Store the table values
-  l = (int)myTable.size();
+  l = myTable.Count();
   sprintf(buffer, "%d\n", l);
   aString+=buffer;
-  for(MI p = myTable.begin(); p != myTable.end(); p++) {
-    sprintf(buffer, "%d\n%d\n", p->first, p->second);
-    aString += buffer;
-  }
+  ValueWriter aWriter(aString, myNbColumns, buffer);
+  myTable.Visit(aWriter);
 
   delete []buffer;
   return aString;
@@ -550,14 +554,79 @@ void SALOMEDSImpl_AttributeTableOfInteger::Load(const std::string& value)
 
   //Restore the table values
   l = strtol(v[pos++].c_str(), NULL, 10);
-  myTable.clear();
-  for(i=1; i<=l; i++) {
+  myTable.Clear();
+  myTable.SetNbColumns(myNbColumns);
+  for(i=1; i<=l && myNbColumns > 0; i++) {
     int aKey = strtol(v[pos++].c_str(), NULL, 10);
     int aValue = strtol(v[pos++].c_str(), NULL, 10);
-    myTable[aKey] = aValue;
+    int aRow = aKey/myNbColumns + 1;
+    int aCol = aKey - myNbColumns*(aRow-1);
+    if(aCol == 0) { aCol = myNbColumns; aRow--; }
+    if(aRow > 0) myTable.Put(aValue, aRow, aCol); // keys of a corrupted string
   }
 }
 
+std::string SALOMEDSImpl_AttributeTableOfInteger::SaveBinary()
+{
+  std::string aString;
+  SALOMEDSImpl_BinaryWriter aWriter(aString);
+
+  aWriter.Integer(BINARY_VERSION);
+  aWriter.String(myTitle);
+  aWriter.Integer(myNbRows);
+  aWriter.Strings(myRows, myNbRows);
+  aWriter.Integer(myNbColumns);
+  aWriter.Strings(myCols, myNbColumns);
+
+  std::vector<int> aKeys;
+  std::vector<int> aValues;
+  aKeys.reserve(myTable.Count());
+  aValues.reserve(myTable.Count());
+  ValueCollector aCollector(aKeys, aValues, myNbColumns);
+  myTable.Visit(aCollector);
+  aWriter.Integer((int)aKeys.size());
+  aWriter.Integers(aKeys.empty() ? NULL : &aKeys[0], aKeys.size());
+  aWriter.Integers(aValues.empty() ? NULL : &aValues[0], aValues.size());
+
+  return aString;
+}
+
+bool SALOMEDSImpl_AttributeTableOfInteger::LoadBinary(const std::string& value)
+{
+  SALOMEDSImpl_BinaryReader aReader(value);
+  int aVersion = 0, aNbRows = 0, aNbColumns = 0, aNbValues = 0;
+  std::string aTitle;
+  std::vector<std::string> aRows, aCols;
+  std::vector<int> aKeys;
+  std::vector<int> aValues;
+  if (!aReader.Integer(aVersion) || aVersion != BINARY_VERSION ||
+      !aReader.String(aTitle) ||
+      !aReader.Integer(aNbRows) || !aReader.Strings(aRows, aNbRows) ||
+      !aReader.Integer(aNbColumns) || !aReader.Strings(aCols, aNbColumns) ||
+      !aReader.Integer(aNbValues) ||
+      !aReader.Integers(aKeys, aNbValues) || !aReader.Integers(aValues, aNbValues))
+    return false;
+
+  Backup();
+
+  myTitle = aTitle;
+  myNbRows = aNbRows;
+  myRows.swap(aRows);
+  myNbColumns = aNbColumns;
+  myCols.swap(aCols);
+
+  myTable.Clear();
+  myTable.SetNbColumns(myNbColumns);
+  for(int i = 0; i < aNbValues && myNbColumns > 0; i++) {
+    int aRow = aKeys[i]/myNbColumns + 1;
+    int aCol = aKeys[i] - myNbColumns*(aRow-1);
+    if(aCol == 0) { aCol = myNbColumns; aRow--; }
+    if(aRow > 0) myTable.Put(aValues[i], aRow, aCol);
+  }
+
+  return true;
+}
+
 std::vector<int> SALOMEDSImpl_AttributeTableOfInteger::SortRow(const int theRow, SortOrder sortOrder, SortPolicy sortPolicy )
 {
   CheckLocked();
@@ -727,48 +796,37 @@ void SALOMEDSImpl_AttributeTableOfInteger::SwapCells(const int theRow1, const in
   if (theColumn1 > myNbColumns || theColumn1 < 1) throw DFexception("Invalid cell index");
   if (theColumn2 > myNbColumns || theColumn2 < 1) throw DFexception("Invalid cell index");
 
-  int anIndex1 = (theRow1-1)*myNbColumns + theColumn1;
-  int anIndex2 = (theRow2-1)*myNbColumns + theColumn2;
-
-  bool hasValue1 = myTable.find(anIndex1) != myTable.end();
-  bool hasValue2 = myTable.find(anIndex2) != myTable.end();
-
-  if (!hasValue1 && !hasValue2) return;                   // nothing changed
-
-  int  value1    = hasValue1 ? myTable[anIndex1] : 0;
-  int  value2    = hasValue2 ? myTable[anIndex2] : 0;
-
-  if (hasValue1 && hasValue2 && value1 == value2) return; // nothing changed
-
-  if (hasValue1) myTable[anIndex2] = value1;
-  else           myTable.erase(anIndex2);
-  if (hasValue2) myTable[anIndex1] = value2;
-  else           myTable.erase(anIndex1);
-
-  SetModifyFlag(); // table is modified
+  if (myTable.Swap(theRow1, theColumn1, theRow2, theColumn2))
+    SetModifyFlag(); // table is modified
 }
 
 void SALOMEDSImpl_AttributeTableOfInteger::SwapRows(const int theRow1, const int theRow2)
 {
   CheckLocked();  
-  for (int i = 1; i <= myNbColumns; i++)
-    SwapCells(theRow1, i, theRow2, i);
+  if (myNbColumns > 0) {
+    if (theRow1 > myNbRows || theRow1 < 1) throw DFexception("Invalid cell index");
+    if (theRow2 > myNbRows || theRow2 < 1) throw DFexception("Invalid cell index");
+    if (myTable.SwapRows(theRow1, theRow2))
+      SetModifyFlag(); // table is modified
+  }
   // swap row titles
   std::string tmp = myRows[theRow1-1];
   myRows[theRow1-1] = myRows[theRow2-1];
   myRows[theRow2-1] = tmp;
-  // no need for SetModifyFlag(), since it is done by SwapCells()
 }
 
 void SALOMEDSImpl_AttributeTableOfInteger::SwapColumns(const int theColumn1, const int theColumn2)
 {
   CheckLocked();  
-  for (int i = 1; i <= myNbRows; i++)
-    SwapCells(i, theColumn1, i, theColumn2);
+  if (myNbRows > 0) {
+    if (theColumn1 > myNbColumns || theColumn1 < 1) throw DFexception("Invalid cell index");
+    if (theColumn2 > myNbColumns || theColumn2 < 1) throw DFexception("Invalid cell index");
+    if (myTable.SwapColumns(theColumn1, theColumn2))
+      SetModifyFlag(); // table is modified
+  }
   // swap column titles
   std::string tmp = myCols[theColumn1-1];
   myCols[theColumn1-1] = myCols[theColumn2-1];
   myCols[theColumn2-1] = tmp;
-  // no need for SetModifyFlag(), since it is done by SwapCells()
 }
 
@@ -46,6 +46,8 @@ class SALOMEDSIMPL_EXPORT SALOMEDSImpl_AttributeTableOfInteger :
 public:
   virtual std::string       Save();
   virtual void              Load(const std::string&); 
+  virtual std::string       SaveBinary();
+  virtual bool              LoadBinary(const std::string&);
   
   static const std::string& GetID();
   static SALOMEDSImpl_AttributeTableOfInteger* Set(const DF_Label& label);
@@ -98,7 +100,7 @@ public:
   ~SALOMEDSImpl_AttributeTableOfInteger() {}
 
 private: 
-  std::map<int, int>       myTable;
+  TableStorage<int>        myTable;
   std::string              myTitle;
   std::vector<std::string> myRows;
   std::vector<std::string> myCols;
@@ -45,6 +45,8 @@ class SALOMEDSIMPL_EXPORT SALOMEDSImpl_AttributeTableOfReal :
 public:
   virtual std::string       Save();
   virtual void              Load(const std::string&); 
+  virtual std::string       SaveBinary();
+  virtual bool              LoadBinary(const std::string&);
 
   static const std::string& GetID();
   static SALOMEDSImpl_AttributeTableOfReal* Set(const DF_Label& label);
@@ -97,7 +99,7 @@ public:
   ~SALOMEDSImpl_AttributeTableOfReal() {}
 
 private: 
-  std::map<int, double>    myTable;
+  TableStorage<double>     myTable;
   std::string              myTitle;
   std::vector<std::string> myRows;
   std::vector<std::string> myCols;
@@ -25,11 +25,13 @@
 //  Module : SALOME
 //
 #include "SALOMEDSImpl_AttributeTableOfString.hxx"
+#include "SALOMEDSImpl_BinaryStream.hxx"
 
 #include <sstream>
 #include <algorithm>
 
 #define SEPARATOR '\1'
+#define BINARY_VERSION 1
 typedef std::map<int, std::string>::const_iterator MI;
 
 static std::string getUnit(std::string theString)
@@ -55,8 +57,8 @@ const std::string& SALOMEDSImpl_AttributeTableOfString::GetID()
 SALOMEDSImpl_AttributeTableOfString* SALOMEDSImpl_AttributeTableOfString::Set(const DF_Label& label) 
 {
   SALOMEDSImpl_AttributeTableOfString* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeTableOfString*)label.FindAttribute(SALOMEDSImpl_AttributeTableOfString::GetID()))) {
-    A = new SALOMEDSImpl_AttributeTableOfString();
+  if (!(A=(SALOMEDSImpl_AttributeTableOfString*)label.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeTableOfString>()))) {
+    A = new(label) SALOMEDSImpl_AttributeTableOfString();
     label.AddAttribute(A);
   }
   return A;
@@ -572,6 +574,60 @@ void SALOMEDSImpl_AttributeTableOfString::Load(const std::string& value)
   }
 }
 
+std::string SALOMEDSImpl_AttributeTableOfString::SaveBinary()
+{
+  std::string aString;
+  SALOMEDSImpl_BinaryWriter aWriter(aString);
+
+  aWriter.Integer(BINARY_VERSION);
+  aWriter.String(myTitle);
+  aWriter.Integer(myNbRows);
+  aWriter.Strings(myRows, myNbRows);
+  aWriter.Integer(myNbColumns);
+  aWriter.Strings(myCols, myNbColumns);
+
+  std::vector<int> aKeys;
+  aKeys.reserve(myTable.size());
+  for(MI p = myTable.begin(); p!=myTable.end(); p++)
+    aKeys.push_back(p->first);
+  aWriter.Integer((int)aKeys.size());
+  aWriter.Integers(aKeys.empty() ? NULL : &aKeys[0], aKeys.size());
+  for(MI p = myTable.begin(); p!=myTable.end(); p++)
+    aWriter.String(p->second);
+
+  return aString;
+}
+
+bool SALOMEDSImpl_AttributeTableOfString::LoadBinary(const std::string& value)
+{
+  SALOMEDSImpl_BinaryReader aReader(value);
+  int aVersion = 0, aNbRows = 0, aNbColumns = 0, aNbValues = 0;
+  std::string aTitle;
+  std::vector<std::string> aRows, aCols, aValues;
+  std::vector<int> aKeys;
+  if (!aReader.Integer(aVersion) || aVersion != BINARY_VERSION ||
+      !aReader.String(aTitle) ||
+      !aReader.Integer(aNbRows) || !aReader.Strings(aRows, aNbRows) ||
+      !aReader.Integer(aNbColumns) || !aReader.Strings(aCols, aNbColumns) ||
+      !aReader.Integer(aNbValues) ||
+      !aReader.Integers(aKeys, aNbValues) || !aReader.Strings(aValues, aNbValues))
+    return false;
+
+  Backup();
+
+  myTitle = aTitle;
+  myNbRows = aNbRows;
+  myRows.swap(aRows);
+  myNbColumns = aNbColumns;
+  myCols.swap(aCols);
+
+  myTable.clear();
+  for(int i = 0; i < aNbValues; i++)
+    myTable[aKeys[i]].swap(aValues[i]);
+
+  return true;
+}
+
 std::vector<int> SALOMEDSImpl_AttributeTableOfString::SortRow(const int theRow, SortOrder sortOrder, SortPolicy sortPolicy )
 {
   CheckLocked();  
@@ -45,6 +45,8 @@ class SALOMEDSIMPL_EXPORT SALOMEDSImpl_AttributeTableOfString :
 public:
   virtual std::string       Save();
   virtual void              Load(const std::string&); 
+  virtual std::string       SaveBinary();
+  virtual bool              LoadBinary(const std::string&);
 
   static const std::string& GetID();
   static SALOMEDSImpl_AttributeTableOfString* Set(const DF_Label& label);
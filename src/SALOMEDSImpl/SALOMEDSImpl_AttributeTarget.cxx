@@ -48,8 +48,8 @@ const std::string& SALOMEDSImpl_AttributeTarget::GetID ()
 SALOMEDSImpl_AttributeTarget* SALOMEDSImpl_AttributeTarget::Set (const DF_Label& L) 
 {
   SALOMEDSImpl_AttributeTarget* A = NULL;
-  if (!(A=(SALOMEDSImpl_AttributeTarget*)L.FindAttribute(SALOMEDSImpl_AttributeTarget::GetID()))) {
-    A = new  SALOMEDSImpl_AttributeTarget(); 
+  if (!(A=(SALOMEDSImpl_AttributeTarget*)L.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeTarget>()))) {
+    A = new(L) SALOMEDSImpl_AttributeTarget(); 
     L.AddAttribute(A);
   }
   return A;
@@ -85,7 +85,7 @@ void SALOMEDSImpl_AttributeTarget::Add(const SALOMEDSImpl_SObject& theSO)
   Backup();
   DF_Label aRefLabel = theSO.GetLabel();
   SALOMEDSImpl_AttributeReference* aReference;
-  if ((aReference=(SALOMEDSImpl_AttributeReference*)aRefLabel.FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) {
+  if ((aReference=(SALOMEDSImpl_AttributeReference*)aRefLabel.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) {
     myVariables[aRefLabel.Entry()]=aReference;
   } 
   
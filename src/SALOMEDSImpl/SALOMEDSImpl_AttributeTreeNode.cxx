@@ -44,7 +44,7 @@ SALOMEDSImpl_AttributeTreeNode* SALOMEDSImpl_AttributeTreeNode::Set (const DF_La
   SALOMEDSImpl_AttributeTreeNode* TN = NULL;
 
   if (!(TN=(SALOMEDSImpl_AttributeTreeNode*)L.FindAttribute(ID))) {
-    TN = new SALOMEDSImpl_AttributeTreeNode ();
+    TN = new(L) SALOMEDSImpl_AttributeTreeNode ();
     TN->SetTreeID(ID);
     L.AddAttribute(TN);
   }
@@ -36,7 +36,7 @@ SALOMEDSImpl_AttributeUserID* SALOMEDSImpl_AttributeUserID::Set (const DF_Label&
 {
   SALOMEDSImpl_AttributeUserID* A = NULL;
   if (!(A=(SALOMEDSImpl_AttributeUserID*)L.FindAttribute(ID))) {
-    A = new  SALOMEDSImpl_AttributeUserID(); 
+    A = new(L) SALOMEDSImpl_AttributeUserID(); 
     A->SetValue(ID);
     L.AddAttribute(A);
   }
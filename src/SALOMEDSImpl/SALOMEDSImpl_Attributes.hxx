@@ -107,9 +107,9 @@ public :
 
 #define __FindOrCreateAttributeLocked(ClassName) if (strcmp(aTypeOfAttribute.c_str(), #ClassName) == 0) { \
     SALOMEDSImpl_##ClassName* anAttr; \
-    if (!(anAttr=(SALOMEDSImpl_##ClassName*)Lab.FindAttribute(SALOMEDSImpl_##ClassName::GetID()))) { \
+    if (!(anAttr=(SALOMEDSImpl_##ClassName*)Lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_##ClassName>()))) { \
       CheckLocked(); \
-      anAttr = new SALOMEDSImpl_##ClassName; \
+      anAttr = new(Lab) SALOMEDSImpl_##ClassName; \
       Lab.AddAttribute(anAttr); \
     } \
     return anAttr; \
@@ -117,8 +117,8 @@ public :
 
 #define __FindOrCreateAttribute(ClassName) if (strcmp(aTypeOfAttribute.c_str(), #ClassName) == 0) { \
     SALOMEDSImpl_##ClassName* anAttr; \
-    if (!(anAttr=(SALOMEDSImpl_##ClassName*)Lab.FindAttribute(SALOMEDSImpl_##ClassName::GetID()))) { \
-      anAttr = new SALOMEDSImpl_##ClassName; \
+    if (!(anAttr=(SALOMEDSImpl_##ClassName*)Lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_##ClassName>()))) { \
+      anAttr = new(Lab) SALOMEDSImpl_##ClassName; \
       Lab.AddAttribute(anAttr); \
     } \
     return anAttr; \
@@ -0,0 +1,154 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  File   : SALOMEDSImpl_BinaryStream.cxx
+//  Module : SALOME
+//
+#include "SALOMEDSImpl_BinaryStream.hxx"
+
+#include <string.h>
+
+namespace
+{
+  bool IsLittleEndian()
+  {
+    const int anOne = 1;
+    return *(const char*)&anOne == 1;
+  }
+
+  // copies theNb items of theSize bytes, reversing their bytes on big endian hosts
+  void CopyLittleEndian(char* theTarget, const char* theSource, size_t theNb, size_t theSize)
+  {
+    if (IsLittleEndian()) {
+      memcpy(theTarget, theSource, theNb*theSize);
+      return;
+    }
+    for (size_t i = 0; i < theNb; i++, theTarget += theSize, theSource += theSize)
+      for (size_t j = 0; j < theSize; j++)
+        theTarget[j] = theSource[theSize-1-j];
+  }
+
+  void Append(std::string& theBuffer, const void* theValues, size_t theNb, size_t theSize)
+  {
+    if (theNb == 0) return;
+    size_t aPosition = theBuffer.size();
+    theBuffer.resize(aPosition + theNb*theSize);
+    CopyLittleEndian(&theBuffer[aPosition], (const char*)theValues, theNb, theSize);
+  }
+}
+
+void SALOMEDSImpl_BinaryWriter::Integer(int theValue)
+{
+  Append(myBuffer, &theValue, 1, sizeof(int));
+}
+
+void SALOMEDSImpl_BinaryWriter::Real(double theValue)
+{
+  Append(myBuffer, &theValue, 1, sizeof(double));
+}
+
+void SALOMEDSImpl_BinaryWriter::String(const std::string& theValue)
+{
+  Integer((int)theValue.size());
+  myBuffer += theValue;
+}
+
+// writes theNb strings, empty beyond the end of theValues
+void SALOMEDSImpl_BinaryWriter::Strings(const std::vector<std::string>& theValues, int theNb)
+{
+  for (int i = 0; i < theNb; i++)
+    String(i < (int)theValues.size() ? theValues[i] : std::string());
+}
+
+void SALOMEDSImpl_BinaryWriter::Integers(const int* theValues, size_t theNb)
+{
+  Append(myBuffer, theValues, theNb, sizeof(int));
+}
+
+void SALOMEDSImpl_BinaryWriter::Reals(const double* theValues, size_t theNb)
+{
+  Append(myBuffer, theValues, theNb, sizeof(double));
+}
+
+const char* SALOMEDSImpl_BinaryReader::take(size_t theSize)
+{
+  if (theSize > myBuffer.size() - myPosition) {
+    myPosition = myBuffer.size();
+    return NULL;
+  }
+  const char* aData = myBuffer.data() + myPosition;
+  myPosition += theSize;
+  return aData;
+}
+
+bool SALOMEDSImpl_BinaryReader::Integer(int& theValue)
+{
+  const char* aData = take(sizeof(int));
+  if (!aData) return false;
+  CopyLittleEndian((char*)&theValue, aData, 1, sizeof(int));
+  return true;
+}
+
+bool SALOMEDSImpl_BinaryReader::Real(double& theValue)
+{
+  const char* aData = take(sizeof(double));
+  if (!aData) return false;
+  CopyLittleEndian((char*)&theValue, aData, 1, sizeof(double));
+  return true;
+}
+
+bool SALOMEDSImpl_BinaryReader::String(std::string& theValue)
+{
+  int aLength = 0;
+  if (!Integer(aLength) || aLength < 0) return false;
+  const char* aData = take(aLength);
+  if (!aData) return false;
+  theValue.assign(aData, aLength);
+  return true;
+}
+
+bool SALOMEDSImpl_BinaryReader::Strings(std::vector<std::string>& theValues, int theNb)
+{
+  // at least the length of each string must remain
+  if (theNb < 0 || (size_t)theNb > (myBuffer.size() - myPosition) / sizeof(int)) return false;
+  theValues.resize(theNb);
+  for (int i = 0; i < theNb; i++)
+    if (!String(theValues[i])) return false;
+  return true;
+}
+
+bool SALOMEDSImpl_BinaryReader::Integers(std::vector<int>& theValues, int theNb)
+{
+  const char* aData = theNb < 0 ? NULL : take((size_t)theNb*sizeof(int));
+  if (!aData) return false;
+  theValues.resize(theNb);
+  if (theNb > 0)
+    CopyLittleEndian((char*)&theValues[0], aData, theNb, sizeof(int));
+  return true;
+}
+
+bool SALOMEDSImpl_BinaryReader::Reals(std::vector<double>& theValues, int theNb)
+{
+  const char* aData = theNb < 0 ? NULL : take((size_t)theNb*sizeof(double));
+  if (!aData) return false;
+  theValues.resize(theNb);
+  if (theNb > 0)
+    CopyLittleEndian((char*)&theValues[0], aData, theNb, sizeof(double));
+  return true;
+}
@@ -0,0 +1,75 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  File   : SALOMEDSImpl_BinaryStream.hxx
+//  Module : SALOME
+//
+#ifndef _SALOMEDSImpl_BinaryStream_HeaderFile
+#define _SALOMEDSImpl_BinaryStream_HeaderFile
+
+#include "SALOMEDSImpl_Defines.hxx"
+
+#include <string>
+#include <vector>
+
+//! Encoder of the binary persistent form of the attributes (see SALOMEDSImpl_GenericAttribute::SaveBinary).
+//! Numbers are stored as little endian 32 bits integers and 64 bits IEEE reals,
+//! strings are prefixed by their length; the number of items of
+//! Strings(), Integers() and Reals() is not stored.
+class SALOMEDSIMPL_EXPORT SALOMEDSImpl_BinaryWriter
+{
+public:
+  SALOMEDSImpl_BinaryWriter(std::string& theBuffer) : myBuffer(theBuffer) {}
+
+  void Integer(int theValue);
+  void Real(double theValue);
+  void String(const std::string& theValue);
+  void Strings(const std::vector<std::string>& theValues, int theNb);
+  void Integers(const int* theValues, size_t theNb);
+  void Reals(const double* theValues, size_t theNb);
+
+private:
+  std::string& myBuffer;
+};
+
+//! Decoder of the binary persistent form of the attributes.
+//! Every method returns false, and the reader stays at the end of the buffer,
+//! if the buffer is too short for the requested data.
+class SALOMEDSIMPL_EXPORT SALOMEDSImpl_BinaryReader
+{
+public:
+  SALOMEDSImpl_BinaryReader(const std::string& theBuffer) : myBuffer(theBuffer), myPosition(0) {}
+
+  bool Integer(int& theValue);
+  bool Real(double& theValue);
+  bool String(std::string& theValue);
+  bool Strings(std::vector<std::string>& theValues, int theNb);
+  bool Integers(std::vector<int>& theValues, int theNb);
+  bool Reals(std::vector<double>& theValues, int theNb);
+
+  bool AtEnd() const { return myPosition == myBuffer.size(); }
+
+private:
+  const char* take(size_t theSize);
+
+  const std::string& myBuffer;
+  size_t             myPosition;
+};
+
+#endif
@@ -30,6 +30,23 @@
 #include "SALOMEDSImpl_TMPFile.hxx"
 
 
+//! Destination of the persistent data of a component saved by chunks (see SALOMEDSImpl_Driver::SaveByChunks).
+//! It is called by the driver as the driver itself is called, i.e. with the study locked.
+class SALOMEDSIMPL_EXPORT SALOMEDSImpl_ChunkWriter
+{
+public:
+
+  virtual ~SALOMEDSImpl_ChunkWriter() {};
+
+  //! theLength is the total length of the data if it is known, -1 otherwise
+  virtual void Open(long theLength) = 0;
+
+  //! theData has only to be valid during the call
+  virtual void WriteChunk(const unsigned char* theData, long theLength) = 0;
+
+  virtual void Close() = 0;
+};
+
 class SALOMEDSIMPL_EXPORT SALOMEDSImpl_Driver
 {
 public:
@@ -48,6 +65,33 @@ public:
     long& theStreamLength,
     bool isMultiFile) = 0;
 
+  //! Saves the data of theComponent chunk after chunk into theWriter so that the whole persistent image
+  //! has not to be kept in memory. The default implementation is an adapter for the drivers which only
+  //! build the whole stream with Save/SaveASCII : the stream is written as a single chunk, so it is
+  //! entirely in memory until it has been written (this is the case of the CORBA engines which do not
+  //! implement SALOMEDS::ChunkedDriver, whose SALOMEDS::Driver interface returns the whole stream).
+  virtual void SaveByChunks(const SALOMEDSImpl_SComponent& theComponent,
+    const std::string& theURL,
+    bool isMultiFile,
+    bool isASCII,
+    SALOMEDSImpl_ChunkWriter& theWriter)
+  {
+    long aLength = 0;
+    SALOMEDSImpl_TMPFile* aStream = isASCII ? SaveASCII(theComponent, theURL, aLength, isMultiFile)
+                                            : Save(theComponent, theURL, aLength, isMultiFile);
+    try {
+      theWriter.Open(aLength);
+      if (aStream && aLength > 0)
+        theWriter.WriteChunk(aStream->Data(), aLength);
+      theWriter.Close();
+    }
+    catch (...) {
+      delete aStream;
+      throw;
+    }
+    delete aStream;
+  }
+
   virtual bool Load(const SALOMEDSImpl_SComponent& theComponent,
     const unsigned char* theStream,
     const long theStreamLength,
@@ -102,6 +146,22 @@ public:
   virtual SALOMEDSImpl_Driver* GetDriverByType(const std::string& theComponentType) = 0;
 
   virtual SALOMEDSImpl_Driver* GetDriverByIOR(const std::string& theIOR) = 0;
+
+  //! returns true if Save/SaveASCII of different drivers can be invoked at the same time from several threads
+  virtual bool CanSaveConcurrently() { return false; }
+
+  //! maximum number of drivers saving at the same time: the data of a driver which does not really save by
+  //! chunks is kept in memory until it has been written, this bounds the memory used by a concurrent save
+  virtual int MaxConcurrentSaves() { return 4; }
+
+  //! takes back/releases the lock that protects the study while drivers are invoked from several threads,
+  //! Unlock() releases one level of the lock held by the calling thread and Lock() takes it back
+  virtual void Lock() {}
+  virtual void Unlock() {}
+
+  //! acquires/releases the same lock for a worker thread which does not hold it yet
+  virtual void LockWorker() {}
+  virtual void UnlockWorker() {}
 };
 
 #endif 
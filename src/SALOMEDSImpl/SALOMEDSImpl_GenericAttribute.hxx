@@ -48,6 +48,12 @@ public:
   {}
 
   virtual std::string Type();
+
+  //! Binary persistent form of the attribute, saved instead of Save() when it is not empty
+  virtual std::string SaveBinary() { return std::string(); }
+  //! Restores the form written by SaveBinary(), returns false if it cannot be decoded
+  virtual bool LoadBinary(const std::string&) { return false; }
+
   virtual void CheckLocked();
   std::string GetClassType() { return _type; }
   SALOMEDSImpl_SObject GetSObject();
@@ -80,7 +80,7 @@ std::string SALOMEDSImpl_SComponent::ComponentDataType()
 {
   std::string res = "";
   SALOMEDSImpl_AttributeComment* type;
-  if ( (type = (SALOMEDSImpl_AttributeComment*)_lab.FindAttribute(SALOMEDSImpl_AttributeComment::GetID())) ) {
+  if ( (type = (SALOMEDSImpl_AttributeComment*)_lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeComment>())) ) {
     res = type->Value();
   }
 
@@ -96,7 +96,7 @@ std::string SALOMEDSImpl_SComponent::ComponentDataType()
 bool SALOMEDSImpl_SComponent::ComponentIOR(std::string& IOR)
 {
   SALOMEDSImpl_AttributeIOR* ior;
-  if (!(ior = (SALOMEDSImpl_AttributeIOR*)_lab.FindAttribute(SALOMEDSImpl_AttributeIOR::GetID())) )
+  if (!(ior = (SALOMEDSImpl_AttributeIOR*)_lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeIOR>())) )
       return false;
   IOR = ior->Value();
   return true;
@@ -111,7 +111,7 @@ bool SALOMEDSImpl_SComponent::ComponentIOR(std::string& IOR)
 bool SALOMEDSImpl_SComponent::IsA(const DF_Label& theLabel)
 {
   // scomponent must contain comment and belong to the 2th depth label
-  return theLabel.Depth() == 2 && theLabel.IsAttribute(SALOMEDSImpl_AttributeComment::GetID());
+  return theLabel.Depth() == 2 && theLabel.IsAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeComment>());
 }
 
 //============================================================================
@@ -169,7 +169,7 @@ std::vector<DF_Attribute*> SALOMEDSImpl_SObject::GetAllAttributes() const
 bool SALOMEDSImpl_SObject::ReferencedObject(SALOMEDSImpl_SObject& theObject) const
 {
   SALOMEDSImpl_AttributeReference* Ref;
-  if (!(Ref=(SALOMEDSImpl_AttributeReference*)_lab.FindAttribute(SALOMEDSImpl_AttributeReference::GetID())))
+  if (!(Ref=(SALOMEDSImpl_AttributeReference*)_lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>())))
     return false;
   
   theObject =  SALOMEDSImpl_Study::SObject(Ref->Get());
@@ -201,7 +201,7 @@ std::string SALOMEDSImpl_SObject::GetName() const
 {
   std::string aStr = "";
   SALOMEDSImpl_AttributeName* aName;
-  if ((aName=(SALOMEDSImpl_AttributeName*)_lab.FindAttribute(SALOMEDSImpl_AttributeName::GetID()))) {
+  if ((aName=(SALOMEDSImpl_AttributeName*)_lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeName>()))) {
     aStr =aName->Value();
   }
   return aStr;
@@ -216,7 +216,7 @@ std::string SALOMEDSImpl_SObject::GetComment() const
 {
   std::string aStr = "";
   SALOMEDSImpl_AttributeComment* aComment;
-  if ((aComment=(SALOMEDSImpl_AttributeComment*)_lab.FindAttribute(SALOMEDSImpl_AttributeComment::GetID()))) {
+  if ((aComment=(SALOMEDSImpl_AttributeComment*)_lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeComment>()))) {
     aStr = aComment->Value();
   }
   return aStr;
@@ -231,7 +231,7 @@ std::string SALOMEDSImpl_SObject::GetIOR() const
 {
   std::string aStr = "";
   SALOMEDSImpl_AttributeIOR* anIOR;
-  if ((anIOR=(SALOMEDSImpl_AttributeIOR*)_lab.FindAttribute(SALOMEDSImpl_AttributeIOR::GetID()))) {
+  if ((anIOR=(SALOMEDSImpl_AttributeIOR*)_lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeIOR>()))) {
     aStr = dynamic_cast<SALOMEDSImpl_AttributeIOR*>(anIOR)->Value();
   }
   return aStr;
@@ -50,6 +50,11 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <chrono>
+#include <future>
+#include <list>
+#include <mutex>
+#include <condition_variable>
 
 // comment out the following define to enable \t symbols in in the python dump files
 #define WITHOUT_TABS
@@ -102,6 +107,349 @@ namespace {
     bool myLocked;
     bool myPrevLocked;
   };
+
+  // Writes the persistent data of a component into the FILE_STREAM dataset of its group. The dataset is created
+  // at the first chunk : with its exact size if the total length is announced (as for a stream saved in one
+  // piece), otherwise stored by chunks and extended at each one.
+  class StreamDatasetWriter : public SALOMEDSImpl_ChunkWriter
+  {
+  public:
+    StreamDatasetWriter( HDFgroup* group ) : myGroup( group ), myDataset( 0 ), myLength( -1 ), myOffset( 0 )
+    {
+    }
+    virtual void Open( long theLength )
+    {
+      myLength = theLength;
+      myOffset = 0;
+    }
+    virtual void WriteChunk( const unsigned char* theData, long theLength )
+    {
+      if ( theLength <= 0 )
+        return;
+      void* aData = const_cast<unsigned char*>( theData );
+      if ( myLength > 0 ) {
+        if ( myOffset + theLength > myLength )
+          throw HDFexception( "Component stream longer than announced" );
+        if ( !myDataset ) {
+          hdf_size aHDFSize[1] = { (hdf_size)myLength };
+          myDataset = new HDFdataset( "FILE_STREAM", myGroup, HDF_STRING, aHDFSize, 1 );
+          myDataset->CreateOnDisk();
+        }
+        myDataset->WriteOnDisk( aData, myOffset, theLength );
+      }
+      else {
+        if ( !myDataset ) {
+          hdf_size aHDFSize[1] = { 0 };
+          myDataset = new HDFdataset( "FILE_STREAM", myGroup, HDF_STRING, aHDFSize, 1 );
+          myDataset->CreateChunkedOnDisk( CHUNK_SIZE );
+        }
+        myDataset->AppendOnDisk( aData, theLength );
+      }
+      myOffset += theLength;
+    }
+    virtual void Close()
+    {
+      if ( myDataset ) {
+        myDataset->CloseOnDisk();
+        myDataset = 0; // will be deleted by myGroup destructor
+        if ( myLength > 0 && myOffset != myLength )
+          throw HDFexception( "Component stream shorter than announced" );
+      }
+    }
+  private:
+    static const hdf_size CHUNK_SIZE = 1048576;
+    HDFgroup*   myGroup;
+    HDFdataset* myDataset;
+    long        myLength;
+    long        myOffset;
+  };
+
+  // Hands the chunks written by an engine running in a worker thread over to the writer thread. Each call waits
+  // until the writer has consumed it, so that at most one chunk per engine is kept in memory; the study lock is
+  // released meanwhile. When the engine runs in the writer thread, the chunks are written directly.
+  class ChunkChannel : public SALOMEDSImpl_ChunkWriter
+  {
+  public:
+    ChunkChannel( SALOMEDSImpl_DriverFactory* factory, bool direct )
+      : myFactory( factory ), myDirect( direct ), mySink( 0 ), myKind( NONE ), myData( 0 ), myLength( 0 ),
+        myFinished( false ), myAborted( false ), myWaitingTime( 0. )
+    {
+    }
+    virtual void Open( long theLength )                                    { Post( OPEN, 0, theLength ); }
+    virtual void WriteChunk( const unsigned char* theData, long theLength ) { Post( CHUNK, theData, theLength ); }
+    virtual void Close()                                                    { Post( CLOSE, 0, 0 ); }
+
+    void SetSink( SALOMEDSImpl_ChunkWriter* sink ) { mySink = sink; }
+    // Writer side : gives the chunks to the sink until the engine has returned
+    void Drain()
+    {
+      std::unique_lock<std::mutex> lock( myMutex );
+      for (;;) {
+        myCond.wait( lock, [this] { return myKind != NONE || myFinished; } );
+        if ( myKind == NONE )
+          break;
+        try {
+          Apply( myKind, myData, myLength );
+        }
+        catch (...) {
+          myAborted = true;
+          myKind = NONE;
+          myCond.notify_all();
+          throw;
+        }
+        myKind = NONE;
+        myCond.notify_all();
+      }
+    }
+    // Engine side : called when the engine has returned
+    void Finish()
+    {
+      std::lock_guard<std::mutex> lock( myMutex );
+      myFinished = true;
+      myCond.notify_all();
+    }
+    // Makes the engine fail at its next chunk
+    void Abort()
+    {
+      std::lock_guard<std::mutex> lock( myMutex );
+      myAborted = true;
+      myCond.notify_all();
+    }
+    double WaitingTime() const { return myWaitingTime; }
+  private:
+    enum Kind { NONE, OPEN, CHUNK, CLOSE };
+    void Post( Kind kind, const unsigned char* data, long length )
+    {
+      if ( myDirect ) {
+        Apply( kind, data, length );
+        return;
+      }
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      bool aborted;
+      myFactory->Unlock();
+      {
+        std::unique_lock<std::mutex> lock( myMutex );
+        if ( !myAborted ) {
+          myKind = kind;
+          myData = data;
+          myLength = length;
+          myCond.notify_all();
+          myCond.wait( lock, [this] { return myKind == NONE || myAborted; } );
+        }
+        aborted = myAborted;
+      }
+      myFactory->Lock();
+      myWaitingTime += std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+      if ( aborted )
+        throw HDFexception( "Save of the study aborted" );
+    }
+    void Apply( Kind kind, const unsigned char* data, long length )
+    {
+      switch ( kind ) {
+      case OPEN:  mySink->Open( length );              break;
+      case CHUNK: mySink->WriteChunk( data, length );  break;
+      case CLOSE: mySink->Close();                     break;
+      default:                                         break;
+      }
+    }
+  private:
+    SALOMEDSImpl_DriverFactory* myFactory;
+    bool                        myDirect;
+    SALOMEDSImpl_ChunkWriter*   mySink;
+    std::mutex                  myMutex;
+    std::condition_variable     myCond;
+    Kind                        myKind;
+    const unsigned char*        myData;
+    long                        myLength;
+    bool                        myFinished;
+    bool                        myAborted;
+    double                      myWaitingTime;
+  };
+
+  // Holds the lock of the factory in a worker thread running an engine
+  class WorkerLock
+  {
+  public:
+    WorkerLock( SALOMEDSImpl_DriverFactory* factory, bool take ) : myFactory( take ? factory : 0 )
+    {
+      if ( myFactory )
+        myFactory->LockWorker();
+    }
+    ~WorkerLock()
+    {
+      if ( myFactory )
+        myFactory->UnlockWorker();
+    }
+  private:
+    SALOMEDSImpl_DriverFactory* myFactory;
+  };
+
+  struct ComponentSave
+  {
+    ComponentSave( const SALOMEDSImpl_SComponent& sco, SALOMEDSImpl_Driver* engine,
+                   SALOMEDSImpl_DriverFactory* factory, bool direct, int rank )
+      : sco( sco ), engine( engine ), rank( rank ), seconds( 0. ), channel( factory, direct )
+    {
+    }
+    SALOMEDSImpl_SComponent sco;
+    SALOMEDSImpl_Driver*    engine;
+    int                     rank;    // order of the launch, which is the order of Write()
+    double                  seconds;
+    ChunkChannel            channel;
+    std::future<void>       done;
+  };
+
+  // Runs the save of the component engines. If the driver factory allows it, the engines are run concurrently,
+  // each in its own thread, and their chunks are written by the calling thread in the order of Write();
+  // otherwise each engine is run by Write(). The caller holds the lock of the factory : it is released while
+  // waiting for the engines so that they can access the study.
+  // At most MaxConcurrentSaves() engines are run or wait for their data to be written at the same time:
+  // an engine that does not save by chunks keeps its whole stream in memory until then. The engines start
+  // in the order of Write(), so the one written next is always running.
+  class ComponentSaver
+  {
+  public:
+    ComponentSaver( SALOMEDSImpl_DriverFactory* factory, const std::string& dir, bool multiFile, bool ascii )
+      : myFactory( factory ), myDir( dir ), myMultiFile( multiFile ), myASCII( ascii ),
+        myConcurrent( factory->CanSaveConcurrently() ), myMaxInFlight( factory->MaxConcurrentSaves() ),
+        myNbWritten( 0 ), myAborted( false )
+    {
+      if ( myMaxInFlight < 1 )
+        myMaxInFlight = 1;
+    }
+    ~ComponentSaver()
+    {
+      // save aborted : stop the engines still running or waiting for their turn
+      if ( myConcurrent ) {
+        {
+          std::lock_guard<std::mutex> lock( myTurnMutex );
+          myAborted = true;
+          myTurnCond.notify_all();
+        }
+        for ( ComponentSave& s : mySaves )
+          s.channel.Abort();
+        myFactory->Unlock();
+        for ( ComponentSave& s : mySaves )
+          if ( s.done.valid() )
+            s.done.wait();
+        myFactory->Lock();
+      }
+    }
+    void Launch( const SALOMEDSImpl_SComponent& sco, SALOMEDSImpl_Driver* engine )
+    {
+      mySaves.emplace_back( sco, engine, myFactory, !myConcurrent, (int)mySaves.size() );
+      ComponentSave& s = mySaves.back();
+      s.done = std::async( myConcurrent ? std::launch::async : std::launch::deferred,
+                           &ComponentSaver::Save, this, &s );
+    }
+    // Returns the save of sco if it has been launched, 0 otherwise
+    ComponentSave* Find( const SALOMEDSImpl_SComponent& sco )
+    {
+      for ( ComponentSave& s : mySaves )
+        if ( s.sco.GetID() == sco.GetID() )
+          return &s;
+      return 0;
+    }
+    // Writes the data of the engine into group
+    void Write( ComponentSave& s, HDFgroup* group )
+    {
+      StreamDatasetWriter aWriter( group );
+      s.channel.SetSink( &aWriter );
+      if ( myConcurrent ) {
+        myFactory->Unlock();
+        try {
+          s.channel.Drain();
+        }
+        catch (...) {
+          myFactory->Lock();
+          throw;
+        }
+        s.done.wait();
+        myFactory->Lock();
+        // the data of the engine is written, let the next one start
+        std::lock_guard<std::mutex> lock( myTurnMutex );
+        myNbWritten++;
+        myTurnCond.notify_all();
+      }
+      s.done.get(); // throws the exception of the engine, if any
+      aWriter.Close();
+    }
+  private:
+    // Runs the engine. A worker thread takes the lock of the factory for the engine; when the engine is run
+    // by Write(), the writer thread already holds it and the lock must not be nested : the driver releases
+    // one level of it around the call of the engine, which could then not call back into the study.
+    void Save( ComponentSave* s )
+    {
+      if ( myConcurrent ) {
+        std::unique_lock<std::mutex> lock( myTurnMutex );
+        myTurnCond.wait( lock, [this, s] { return s->rank < myNbWritten + myMaxInFlight || myAborted; } );
+        if ( myAborted ) {
+          lock.unlock();
+          s->channel.Finish();
+          throw HDFexception( "Save of the study aborted" );
+        }
+      }
+      try {
+        WorkerLock aLock( myFactory, myConcurrent );
+        // the time spent waiting for the lock, or for the writer, is not the engine's
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        s->engine->SaveByChunks( s->sco, myDir, myMultiFile, myASCII, s->channel );
+        s->seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count()
+                   - s->channel.WaitingTime();
+      }
+      catch (...) {
+        s->channel.Finish();
+        throw;
+      }
+      s->channel.Finish();
+    }
+  private:
+    SALOMEDSImpl_DriverFactory* myFactory;
+    std::string                 myDir;
+    bool                        myMultiFile;
+    bool                        myASCII;
+    bool                        myConcurrent;
+    int                         myMaxInFlight;
+    int                         myNbWritten;   // number of engines whose data has been written
+    bool                        myAborted;
+    std::mutex                  myTurnMutex;
+    std::condition_variable     myTurnCond;
+    std::list<ComponentSave>    mySaves;
+  };
+}
+
+typedef std::multimap<std::pair<int, std::string>, DF_Label> NameLabels;
+
+// Returns the ancestor of theLabel located at theDepth
+static DF_Label LabelAtDepth(const DF_Label& theLabel, int theDepth)
+{
+  DF_Label aLabel = theLabel;
+  while (aLabel.Depth() > theDepth) aLabel = aLabel.Father();
+  return aLabel;
+}
+
+// Returns the key of theLabel in the map of names: the tag of the component
+// holding it (the child of theMain it descends from), -1 out of theMain
+static NameLabels::key_type NameLabelKey(const std::string& theName, const DF_Label& theLabel, const DF_Label& theMain)
+{
+  DF_Label aLabel = theLabel;
+  int aTag = aLabel.IsDescendant(theMain) ? LabelAtDepth(aLabel, theMain.Depth()+1).Tag() : -1;
+  return std::make_pair(aTag, theName);
+}
+
+// Returns true if theLabel is met before theOther in a depth-first walk of the tree
+static bool IsBeforeInTree(const DF_Label& theLabel, const DF_Label& theOther)
+{
+  DF_Label aLabel = LabelAtDepth(theLabel, theOther.Depth());
+  DF_Label anOther = LabelAtDepth(theOther, theLabel.Depth());
+  // an ancestor is met before its descendants
+  if (aLabel == anOther) return theLabel.Depth() < theOther.Depth();
+  // otherwise the children of their closest common ancestor are met in the order of their tags
+  while (!(aLabel.Father() == anOther.Father())) {
+    aLabel = aLabel.Father();
+    anOther = anOther.Father();
+  }
+  return aLabel.Tag() < anOther.Tag();
 }
 
 //============================================================================
@@ -109,7 +457,7 @@ namespace {
  *  Purpose  : SALOMEDSImpl_Study constructor
  */
 //============================================================================
-SALOMEDSImpl_Study::SALOMEDSImpl_Study() : _doc(NULL)
+SALOMEDSImpl_Study::SALOMEDSImpl_Study() : _doc(NULL), myNameLabelsBuilt(false)
 {
   _appli = new DF_Application();
   _clipboard = _appli->NewDocument("SALOME_STUDY");
@@ -184,8 +532,11 @@ void SALOMEDSImpl_Study::Clear()
   URL("");
   _appli->Close(_doc);
   _doc = NULL;
+  std::lock_guard<std::mutex> aCacheLock(myCacheMutex);
   _mapOfSO.clear();
   _mapOfSCO.clear();
+  myNameLabels.clear();
+  myNameLabelsBuilt = false;
 }
 
 //============================================================================
@@ -205,36 +556,26 @@ bool SALOMEDSImpl_Study::Open(const std::string& aUrl)
   HDFgroup *hdf_group_study_structure =0;
   HDFgroup *hdf_notebook_vars = 0;
 
-  char* aC_HDFUrl;
-  std::string aHDFUrl;
-  bool isASCII = false;
   if (HDFascii::isASCII(aUrl.c_str())) {
-    isASCII = true;
-    char* aResultPath = HDFascii::ConvertFromASCIIToHDF(aUrl.c_str());
-    if ( !aResultPath )
+    // the ASCII study is loaded in memory, without an intermediate HDF file
+    hdf_file = HDFascii::LoadFromASCII(aUrl.c_str());
+    if ( !hdf_file )
       return NULL;
-    aC_HDFUrl = new char[strlen(aResultPath) + 19];
-    sprintf(aC_HDFUrl, "%shdf_from_ascii.hdf", aResultPath);
-    delete [] (aResultPath);
-    aHDFUrl = aC_HDFUrl;
-    delete [] aC_HDFUrl;
   }
   else {
-    aHDFUrl = aUrl;
-  }
-
-  hdf_file = new HDFfile((char*)aHDFUrl.c_str());
-  try {
-    hdf_file->OpenOnDisk(HDF_RDONLY);// mpv: was RDWR, but opened file can be write-protected too
-  }
-  catch (HDFexception)
-  {
-    char *eStr;
-    eStr = new char[strlen(aUrl.c_str())+17];
-    sprintf(eStr,"Can't open file %s",aUrl.c_str());
-    delete [] eStr;
-    _errorCode = std::string(eStr);
-    return NULL;
+    hdf_file = new HDFfile((char*)aUrl.c_str());
+    try {
+      hdf_file->OpenOnDisk(HDF_RDONLY);// mpv: was RDWR, but opened file can be write-protected too
+    }
+    catch (HDFexception)
+    {
+      char *eStr;
+      eStr = new char[strlen(aUrl.c_str())+17];
+      sprintf(eStr,"Can't open file %s",aUrl.c_str());
+      delete [] eStr;
+      _errorCode = std::string(eStr);
+      return NULL;
+    }
   }
 
   // Assign the value of the URL in the study object
@@ -271,12 +612,6 @@ bool SALOMEDSImpl_Study::Open(const std::string& aUrl)
   hdf_file->CloseOnDisk();
   hdf_group_study_structure = new HDFgroup("STUDY_STRUCTURE",hdf_file);
 
-  if (isASCII) {
-    std::vector<std::string> aFilesToRemove;
-    aFilesToRemove.push_back("hdf_from_ascii.hdf");
-    SALOMEDSImpl_Tool::RemoveTemporaryFiles(SALOMEDSImpl_Tool::GetDirFromPath(aHDFUrl), aFilesToRemove, true);
-  }
-
   delete hdf_file; // all related hdf objects will be deleted
 
   // unlock study if it is locked, to set components versions
@@ -303,7 +638,8 @@ bool SALOMEDSImpl_Study::Open(const std::string& aUrl)
 //============================================================================
 bool SALOMEDSImpl_Study::Save(SALOMEDSImpl_DriverFactory* aFactory,
                               bool theMultiFile,
-                              bool theASCII)
+                              bool theASCII,
+                              bool theCompressed)
 {
   _errorCode = "";
 
@@ -313,7 +649,7 @@ bool SALOMEDSImpl_Study::Save(SALOMEDSImpl_DriverFactory* aFactory,
     return false;
   }
   else {
-    return Impl_SaveAs(url, aFactory, theMultiFile, theASCII);
+    return Impl_SaveAs(url, aFactory, theMultiFile, theASCII, theCompressed);
   }
 
   return false;
@@ -327,10 +663,11 @@ bool SALOMEDSImpl_Study::Save(SALOMEDSImpl_DriverFactory* aFactory,
 bool SALOMEDSImpl_Study::SaveAs(const std::string& aUrl,
                                 SALOMEDSImpl_DriverFactory* aFactory,
                                 bool theMultiFile,
-                                bool theASCII)
+                                bool theASCII,
+                                bool theCompressed)
 {
   _errorCode = "";
-  return Impl_SaveAs(aUrl, aFactory, theMultiFile, theASCII);
+  return Impl_SaveAs(aUrl, aFactory, theMultiFile, theASCII, theCompressed);
 }
 
 //=============================================================================
@@ -478,7 +815,8 @@ bool SALOMEDSImpl_Study::Impl_SaveProperties(HDFgroup *hdf_group)
 bool SALOMEDSImpl_Study::Impl_SaveAs(const std::string& aStudyUrl,
                                      SALOMEDSImpl_DriverFactory* aFactory,
                                      bool theMultiFile,
-                                     bool theASCII)
+                                     bool theASCII,
+                                     bool theCompressed)
 {
   // Set "C" locale temporarily to avoid possible localization problems
   Kernel_Utils::Localizer loc;
@@ -560,68 +898,75 @@ bool SALOMEDSImpl_Study::Impl_SaveAs(const std::string& aStudyUrl,
     hdf_file = new HDFfile((char*)aUrl.c_str());
     hdf_file->CreateOnDisk();
 
+    // all the groups and datasets created below inherit the storage policy of the file;
+    // deflate is used as every HDF5 library can read it back, the small datasets
+    // (most of the attributes) stay contiguous as compressing them would not pay
+    if (theCompressed && !theASCII) {
+      hdf_storage aStorage;
+      memset(&aStorage, 0, sizeof(aStorage));
+      aStorage.filter = HDF_DEFLATE;
+      aStorage.level = 1;
+      aStorage.min_bytes = 4096;
+      hdf_file->SetStorage(aStorage);
+    }
+
     //-----------------------------------------------------------------------
     // 1 - Create a groupe for each SComponent and Update the PersistanceRef
     //-----------------------------------------------------------------------
     hdf_group_datacomponent = new HDFgroup("DATACOMPONENT",hdf_file);
     hdf_group_datacomponent->CreateOnDisk();
 
+    // the engines build their persistent data concurrently (if the driver factory allows it),
+    // their streams are written below in the order of the components
+    ComponentSaver aSaver(aFactory, SALOMEDSImpl_Tool::GetDirFromPath(aUrl), theMultiFile, theASCII);
     for (itcomponent.Init(); itcomponent.More(); itcomponent.Next()) {
       SALOMEDSImpl_SComponent sco = itcomponent.Value();
-
-      std::string scoid = sco.GetID();
-      hdf_sco_group = new HDFgroup((char*)scoid.c_str(), hdf_group_datacomponent);
-      hdf_sco_group->CreateOnDisk();
-
-      std::string componentDataType = sco.ComponentDataType();
       std::string IOREngine;
       if (sco.ComponentIOR(IOREngine)) {
         // Engine should be already in the map as it was to added before
+        std::string componentDataType = sco.ComponentDataType();
         SALOMEDSImpl_Driver* Engine = aMapTypeDriver[componentDataType];
         if (Engine != NULL) {
-          SALOMEDSImpl_TMPFile* aStream = NULL;
-          long length = 0;
-
           componentVersions[ componentDataType ] = Engine->Version();
+          aSaver.Launch(sco, Engine);
+        }
+      }
+    }
+    mySaveTimings.clear();
 
-          if (theASCII) aStream = Engine->SaveASCII(sco,
-                                                    SALOMEDSImpl_Tool::GetDirFromPath(aUrl),
-                                                    length,
-                                                    theMultiFile);
-          else aStream = Engine->Save(sco,
-                                      SALOMEDSImpl_Tool::GetDirFromPath(aUrl),
-                                      length,
-                                      theMultiFile);
-          HDFdataset *hdf_dataset;
-          hdf_size aHDFSize[1];
-          if (length > 0) {  //The component saved some auxiliary files, then put them into HDF file
-            aHDFSize[0] = length;
-
-            HDFdataset *hdf_dataset = new HDFdataset("FILE_STREAM", hdf_sco_group, HDF_STRING, aHDFSize, 1);
-            hdf_dataset->CreateOnDisk();
-            hdf_dataset->WriteOnDisk(aStream->Data());  //Save the stream in the HDF file
-            hdf_dataset->CloseOnDisk();
-          }
+    for (itcomponent.Init(); itcomponent.More(); itcomponent.Next()) {
+      SALOMEDSImpl_SComponent sco = itcomponent.Value();
 
-          if (aStream) delete aStream;
-
-          // store multifile state
-          aHDFSize[0] = 2;
-          hdf_dataset = new HDFdataset("MULTIFILE_STATE", hdf_sco_group, HDF_STRING, aHDFSize, 1);
-          hdf_dataset->CreateOnDisk();
-          hdf_dataset->WriteOnDisk((void*)(theMultiFile?"M":"S")); // save: multi or single
-          hdf_dataset->CloseOnDisk();
-          hdf_dataset=0; //will be deleted by hdf_sco_AuxFiles destructor
-          // store ASCII state
-          aHDFSize[0] = 2;
-          hdf_dataset = new HDFdataset("ASCII_STATE", hdf_sco_group, HDF_STRING, aHDFSize, 1);
-          hdf_dataset->CreateOnDisk();
-          hdf_dataset->WriteOnDisk((void*)(theASCII?"A":"B")); // save: ASCII or BINARY
-          hdf_dataset->CloseOnDisk();
-          hdf_dataset=0; //will be deleted by hdf_sco_AuxFiles destructor
-          // Creation of the persistence reference  attribute
-          Translate_IOR_to_persistentID (sco, Engine, theMultiFile, theASCII);
-        }
+      std::string scoid = sco.GetID();
+      hdf_sco_group = new HDFgroup((char*)scoid.c_str(), hdf_group_datacomponent);
+      hdf_sco_group->CreateOnDisk();
+
+      std::string componentDataType = sco.ComponentDataType();
+      ComponentSave* aSave = aSaver.Find(sco);
+      if (aSave) {
+        SALOMEDSImpl_Driver* Engine = aSave->engine;
+        // the component data are streamed into FILE_STREAM dataset
+        aSaver.Write(*aSave, hdf_sco_group);
+        mySaveTimings.push_back(std::make_pair(componentDataType, aSave->seconds));
+
+        HDFdataset *hdf_dataset;
+        hdf_size aHDFSize[1];
+        // store multifile state
+        aHDFSize[0] = 2;
+        hdf_dataset = new HDFdataset("MULTIFILE_STATE", hdf_sco_group, HDF_STRING, aHDFSize, 1);
+        hdf_dataset->CreateOnDisk();
+        hdf_dataset->WriteOnDisk((void*)(theMultiFile?"M":"S")); // save: multi or single
+        hdf_dataset->CloseOnDisk();
+        hdf_dataset=0; //will be deleted by hdf_sco_AuxFiles destructor
+        // store ASCII state
+        aHDFSize[0] = 2;
+        hdf_dataset = new HDFdataset("ASCII_STATE", hdf_sco_group, HDF_STRING, aHDFSize, 1);
+        hdf_dataset->CreateOnDisk();
+        hdf_dataset->WriteOnDisk((void*)(theASCII?"A":"B")); // save: ASCII or BINARY
+        hdf_dataset->CloseOnDisk();
+        hdf_dataset=0; //will be deleted by hdf_sco_AuxFiles destructor
+        // Creation of the persistence reference  attribute
+        Translate_IOR_to_persistentID (sco, Engine, theMultiFile, theASCII);
       }
       hdf_sco_group->CloseOnDisk();
       hdf_sco_group=0; // will be deleted by hdf_group_datacomponent destructor
@@ -765,93 +1110,24 @@ bool SALOMEDSImpl_Study::Impl_SaveAs(const std::string& aStudyUrl,
     HDFascii::ConvertFromHDFToASCII(aUrl.c_str(), true);
   }
 
-  // Now it's necessary to copy files from the temporary directory to the user defined directory.
-  // The easiest way to get a list of file in the temporary directory
-
-  std::string aCmd, aTmpFileDir = SALOMEDSImpl_Tool::GetTmpDir();
-  std::string aTmpFile = aTmpFileDir +"files";
+  // Now it's necessary to move files from the temporary directory to the user defined directory.
   std::string aStudyTmpDir = SALOMEDSImpl_Tool::GetDirFromPath(aUrl);
-
-#ifdef WIN32
-  aCmd = "dir /B \"" + aStudyTmpDir +"\" > \"" + aTmpFile + "\"";
-#else
-  aCmd ="ls -1 \"" + aStudyTmpDir +"\" > " + aTmpFile;
-#endif
-#if defined(WIN32) && defined(UNICODE)
-  std::wstring awCmd = Kernel_Utils::utf8_decode_s(aCmd);
-  _wsystem( awCmd.c_str() );
-#else  
-  system(aCmd.c_str());
-#endif
-
-  // Iterate and move files in the temporary directory
-#if defined(WIN32) && defined(UNICODE)
-  std::wstring awTmpFile = Kernel_Utils::utf8_decode_s(aTmpFile);
-  FILE* fp = _wfopen(awTmpFile.c_str(), L"rb");
-#else
-  FILE* fp = fopen(aTmpFile.c_str(), "rb");
-#endif
-  if (!fp) {
-    URL( anOldName ); // VSR: restore previous url if operation is failed
-    return false;
+  std::string aMoveError;
+  bool errors = !SALOMEDSImpl_Tool::MoveFiles(aStudyTmpDir, SALOMEDSImpl_Tool::GetDirFromPath(aStudyUrl), aMoveError);
+  if ( errors ) {
+    _errorCode = aMoveError;
+    URL( anOldName ); // the files of the study have not been moved to aStudyUrl
   }
-  char* buffer = new char[2047];
-  int errors = 0;
-  while (!feof(fp) && !errors) {
-    if ((fgets(buffer, 2046, fp)) == NULL) break;
-    size_t aLen = strlen(buffer);
-    if (buffer[aLen-1] == '\n') buffer[aLen-1] = char(0);
-
-#ifdef WIN32    
-    // Force removing readonly attribute from a file under Windows, because of a but in the HDF
-    std::string aReadOlnyRmCmd = "attrib -r \"" + aStudyTmpDir + std::string(buffer)+ "\" > nul 2>&1";
-#ifdef UNICODE
-    std::wstring awReadOlnyRmCmd = Kernel_Utils::utf8_decode_s(aReadOlnyRmCmd);
-    _wsystem(awReadOlnyRmCmd.c_str());
-#else  
-    system(aReadOlnyRmCmd.c_str());
-#endif
-
-    aCmd = "move /Y \"" + aStudyTmpDir + std::string(buffer) + "\" \"" + SALOMEDSImpl_Tool::GetDirFromPath(aStudyUrl) +"\" > nul 2>&1";
-#else
-    aCmd = "mv -f \"" + aStudyTmpDir + std::string(buffer) + "\" \"" + SALOMEDSImpl_Tool::GetDirFromPath(aStudyUrl)+"\"";
-#endif
-#if defined(WIN32) && defined(UNICODE)
-    std::wstring awCmd = Kernel_Utils::utf8_decode_s(aCmd);
-    errors = _wsystem(awCmd.c_str());
-#else  
-    errors = system(aCmd.c_str());
-#endif
-  }
-
-  delete []buffer;
-  fclose(fp);
 
   // Perform cleanup
 #ifdef WIN32
 #ifdef UNICODE
-  std::wstring aTmpFileToDelete = Kernel_Utils::utf8_decode_s(aTmpFile);
- 
-#else
-  std::string aTmpFileToDelete = aTmpFile;
-#endif
-  DeleteFile(aTmpFileToDelete.c_str());
-#else
-  unlink(aTmpFile.c_str());
-#endif
-
-#ifdef WIN32
-#ifdef UNICODE
-  std::wstring aTmpFileDirToDelete = Kernel_Utils::utf8_decode_s( aTmpFileDir );
   std::wstring aStudyTmpDirToDelete = Kernel_Utils::utf8_decode_s( aStudyTmpDir );
 #else
-  std::string aTmpFileDirToDelete = aTmpFileDir;
   std::string aStudyTmpDirToDelete = aStudyTmpDir;
 #endif  
-  RemoveDirectory( aTmpFileDirToDelete.c_str() );
   RemoveDirectory( aStudyTmpDirToDelete.c_str() );
 #else
-  rmdir(aTmpFileDir.c_str());
   rmdir(aStudyTmpDir.c_str());
 #endif
 
@@ -968,7 +1244,7 @@ bool SALOMEDSImpl_Study::CopyLabel(SALOMEDSImpl_Driver* theEngine,
       std::string anEntry = aReferenced.Entry();
       // store the value of name attribute of referenced label
       SALOMEDSImpl_AttributeName* aNameAttribute;
-      if ((aNameAttribute=(SALOMEDSImpl_AttributeName*)aReferenced.FindAttribute(SALOMEDSImpl_AttributeName::GetID()))) {
+      if ((aNameAttribute=(SALOMEDSImpl_AttributeName*)aReferenced.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeName>()))) {
         anEntry += " ";
         anEntry += aNameAttribute->Value();
       }
@@ -1062,12 +1338,12 @@ bool SALOMEDSImpl_Study::CanPaste(const SALOMEDSImpl_SObject& theObject,
   }
 
   SALOMEDSImpl_AttributeComment* aCompName = NULL;
-  if (!(aCompName=(SALOMEDSImpl_AttributeComment*)_clipboard->Main().Root().FindAttribute(SALOMEDSImpl_AttributeComment::GetID()))) {
+  if (!(aCompName=(SALOMEDSImpl_AttributeComment*)_clipboard->Main().Root().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeComment>()))) {
     _errorCode = "Clipboard has no component type";
     return false;
   }
   SALOMEDSImpl_AttributeInteger* anObjID;
-  if (!(anObjID=(SALOMEDSImpl_AttributeInteger*)_clipboard->Main().Father().FindChild(2).FindAttribute(SALOMEDSImpl_AttributeInteger::GetID()))) {
+  if (!(anObjID=(SALOMEDSImpl_AttributeInteger*)_clipboard->Main().Father().FindChild(2).FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeInteger>()))) {
     _errorCode = "Clipboard has no object id";
     return false;
   }
@@ -1115,9 +1391,9 @@ DF_Label SALOMEDSImpl_Study::PasteLabel(SALOMEDSImpl_Driver* theEngine,
 
   // check auxiliary label for TMPFile => IOR
   SALOMEDSImpl_AttributeName* aNameAttribute = NULL;
-  if ((aNameAttribute=(SALOMEDSImpl_AttributeName*)aAuxSourceLabel.FindAttribute(SALOMEDSImpl_AttributeName::GetID()))) {
-    SALOMEDSImpl_AttributeInteger* anObjID = (SALOMEDSImpl_AttributeInteger*)aAuxSourceLabel.FindAttribute(SALOMEDSImpl_AttributeInteger::GetID());
-    SALOMEDSImpl_AttributeComment* aComponentName = (SALOMEDSImpl_AttributeComment*)theSource.Root().FindAttribute(SALOMEDSImpl_AttributeComment::GetID());
+  if ((aNameAttribute=(SALOMEDSImpl_AttributeName*)aAuxSourceLabel.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeName>()))) {
+    SALOMEDSImpl_AttributeInteger* anObjID = (SALOMEDSImpl_AttributeInteger*)aAuxSourceLabel.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeInteger>());
+    SALOMEDSImpl_AttributeComment* aComponentName = (SALOMEDSImpl_AttributeComment*)theSource.Root().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeComment>());
     std::string aCompName = aComponentName->Value();
 
     if (theEngine->CanPaste(aCompName, anObjID->Value())) {
@@ -1161,7 +1437,7 @@ DF_Label SALOMEDSImpl_Study::PasteLabel(SALOMEDSImpl_Driver* theEngine,
 
   // check auxiliary label for Comment => reference or name attribute of the referenced object
   SALOMEDSImpl_AttributeComment* aCommentAttribute = NULL;
-  if ((aCommentAttribute=(SALOMEDSImpl_AttributeComment*)aAuxSourceLabel.FindAttribute(SALOMEDSImpl_AttributeComment::GetID()))) {
+  if ((aCommentAttribute=(SALOMEDSImpl_AttributeComment*)aAuxSourceLabel.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeComment>()))) {
     char * anEntry = new char[aCommentAttribute->Value().size() + 1];
     strcpy(anEntry, std::string(aCommentAttribute->Value()).c_str());
     char* aNameStart = strchr(anEntry, ' ');
@@ -1201,7 +1477,7 @@ SALOMEDSImpl_SObject SALOMEDSImpl_Study::Paste(const SALOMEDSImpl_SObject& theOb
 
   // if there is no component name, then paste only SObjects and attributes: without component help
   SALOMEDSImpl_AttributeComment* aComponentName = NULL;
-  bool aStructureOnly = !(aComponentName=(SALOMEDSImpl_AttributeComment*)_clipboard->Main().Root().FindAttribute(SALOMEDSImpl_AttributeComment::GetID()));
+  bool aStructureOnly = !(aComponentName=(SALOMEDSImpl_AttributeComment*)_clipboard->Main().Root().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeComment>()));
 
   // CAF document of current study usage
   if (!_doc) {
@@ -1327,26 +1603,25 @@ SALOMEDSImpl_SObject SALOMEDSImpl_Study::FindObject(const std::string& anObjectN
 {
   _errorCode = "";
 
-  // Iterate to all components defined in the study
-  // After testing the component name, iterate in all objects defined under
-  // components (function _FindObject)
-  bool _find = false;
-  SALOMEDSImpl_SObject RefSO;
-
-  SALOMEDSImpl_SComponentIterator it = NewComponentIterator();
-  for (; it.More();it.Next()){
-    if(!_find)
-      {
-        SALOMEDSImpl_SComponent SC = it.Value();
-        if (SC.GetName() == anObjectName)
-        {
-            _find = true;
-            RefSO = SC;
-
-        }
-        if (!_find) RefSO =  _FindObject(SC, anObjectName, _find);
-      }
+  // The result is the first object met when iterating the components
+  // and walking depth-first through their objects, it is searched
+  // among the labels of each component having anObjectName in the map of names
+  BuildNameLabelMap();
+
+  DF_Label aFound;
+  DF_ChildIterator itc(_doc->Main());
+  for (; itc.More() && aFound.IsNull(); itc.Next()) {
+    // only the components met by the component iterator are considered
+    if (!SALOMEDSImpl_SComponent::IsA(itc.Value())) break;
+    std::pair<NameLabels::iterator, NameLabels::iterator> aRange =
+      myNameLabels.equal_range(std::make_pair(itc.Value().Tag(), anObjectName));
+    for (NameLabels::iterator it = aRange.first; it != aRange.second; it++) {
+      if (aFound.IsNull() || IsBeforeInTree(it->second, aFound)) aFound = it->second;
+    }
   }
+
+  SALOMEDSImpl_SObject RefSO;
+  if (!aFound.IsNull()) RefSO = GetSObject(aFound);
   if(!RefSO) _errorCode = "No object was found";
   return RefSO;
 }
@@ -1412,26 +1687,30 @@ std::vector<SALOMEDSImpl_SObject> SALOMEDSImpl_Study::FindObjectByName(const std
     return listSO;
   }
 
-  // Iterate on each object and subobject of the component
-  // If objectName is found add it to the list of SObjects
-  std::string childName ;
+  // For each child of the component, the child itself is added
+  // if it is named anObjectName, then the first of its descendants
+  // with this name in depth-first order
+  BuildNameLabelMap();
 
-  std::string compoId = compo.GetID();
-  SALOMEDSImpl_ChildIterator it = NewChildIterator(compo);
-  for ( ; it.More(); it.Next() ) {
-
-    SALOMEDSImpl_SObject CSO = it.Value();
-    if ( CSO.GetName() == anObjectName ) {
-        /* add to list */
-        listSO.push_back(CSO) ;
-    }
+  DF_Label aCompoLabel = compo.GetLabel();
+  std::map< int, std::pair<DF_Label, DF_Label> > aFoundByChild;
+  std::pair<NameLabels::iterator, NameLabels::iterator> aRange =
+    myNameLabels.equal_range(std::make_pair(aCompoLabel.Tag(), anObjectName));
+  for (NameLabels::iterator it = aRange.first; it != aRange.second; it++) {
+    DF_Label aLabel = it->second;
+    if (aLabel.Depth() == aCompoLabel.Depth()) continue; // the component itself
+    DF_Label aChild = LabelAtDepth(aLabel, aCompoLabel.Depth()+1);
+    std::pair<DF_Label, DF_Label>& aFound = aFoundByChild[aChild.Tag()];
+    if (aLabel.Depth() == aChild.Depth())
+      aFound.first = aLabel;
+    else if (aFound.second.IsNull() || IsBeforeInTree(aLabel, aFound.second))
+      aFound.second = aLabel;
+  }
 
-    /* looks also for eventual children */
-    bool found = false ;
-    CSO = _FindObject( CSO, anObjectName, found ) ;
-    if( found) {
-      listSO.push_back(CSO) ;
-    }
+  std::map< int, std::pair<DF_Label, DF_Label> >::iterator itf = aFoundByChild.begin();
+  for ( ; itf != aFoundByChild.end(); itf++ ) {
+    if (!itf->second.first.IsNull()) listSO.push_back(GetSObject(itf->second.first));
+    if (!itf->second.second.IsNull()) listSO.push_back(GetSObject(itf->second.second));
   }
 
   return listSO;
@@ -1451,6 +1730,7 @@ SALOMEDSImpl_SObject SALOMEDSImpl_Study::FindObjectIOR(const std::string& anObje
   SALOMEDSImpl_SObject aResult ;
 
   // searching in the datamap for optimization
+  std::lock_guard<std::mutex> aCacheLock(myCacheMutex);
   std::map<std::string, DF_Label>::iterator it=myIORLabels.find(anObjectIOR);
   if (it != myIORLabels.end()) {
     aResult = GetSObject(it->second);
@@ -1508,7 +1788,7 @@ SALOMEDSImpl_SObject SALOMEDSImpl_Study::FindObjectByPath(const std::string& the
 
     for ( ; anIterator.More(); anIterator.Next() ) {
       aLabel = anIterator.Value();
-      if((anAttr=(SALOMEDSImpl_AttributeName*)aLabel.FindAttribute(SALOMEDSImpl_AttributeName::GetID()))) {
+      if((anAttr=(SALOMEDSImpl_AttributeName*)aLabel.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeName>()))) {
         if(anAttr->Value() == aToken) {
           if(i == (len-1)) {  //The searched label is found (no part of the path is left)
               return GetSObject(aLabel);
@@ -1580,6 +1860,60 @@ std::string SALOMEDSImpl_Study::GetObjectPathByIOR(const std::string& theIOR)
   return GetObjectPath(so);
 }
 
+//============================================================================
+/*! Function : GetObjectsAttributes
+ *  Purpose  : Collects the attributes of several objects in one call
+ */
+//============================================================================
+void SALOMEDSImpl_Study::GetObjectsAttributes(const std::vector<std::string>& theEntries,
+                                              bool theWithChildren,
+                                              const std::vector<std::string>& theTypes,
+                                              std::vector<std::string>& theObjectEntries,
+                                              std::vector<std::string>& theNames,
+                                              std::vector<std::string>& theIORs,
+                                              std::vector< std::vector<std::string> >& theObjectTypes,
+                                              std::vector<std::string>& theValues)
+{
+  _errorCode = "";
+
+  std::vector<SALOMEDSImpl_SObject> anObjects;
+  for (size_t i = 0; i < theEntries.size(); i++) {
+    DF_Label aLabel = DF_Label::Label(_doc->Main(), theEntries[i], false);
+    if (aLabel.IsNull()) continue;
+    anObjects.push_back(GetSObject(aLabel));
+    if (theWithChildren) {
+      for (DF_ChildIterator itchild(aLabel, true); itchild.More(); itchild.Next())
+        anObjects.push_back(GetSObject(itchild.Value()));
+    }
+  }
+
+  size_t aNbObjects = anObjects.size();
+  theObjectEntries.resize(aNbObjects);
+  theNames.resize(aNbObjects);
+  theIORs.resize(aNbObjects);
+  theObjectTypes.resize(aNbObjects);
+  theValues.assign(aNbObjects*theTypes.size(), std::string());
+  for (size_t i = 0; i < aNbObjects; i++) {
+    const SALOMEDSImpl_SObject& aSO = anObjects[i];
+    theObjectEntries[i] = aSO.GetID();
+    theNames[i] = aSO.GetName();
+    theIORs[i] = aSO.GetIOR();
+
+    std::vector<DF_Attribute*> anAttributes = aSO.GetAllAttributes();
+    theObjectTypes[i].resize(anAttributes.size());
+    for (size_t j = 0; j < anAttributes.size(); j++)
+      theObjectTypes[i][j] = SALOMEDSImpl_GenericAttribute::Impl_GetType(anAttributes[j]);
+
+    DF_Attribute* anAttr;
+    for (size_t j = 0; j < theTypes.size(); j++) {
+      if (theTypes[j] == "AttributeIOR") // the IOR is not persistent
+        theValues[i*theTypes.size()+j] = theIORs[i];
+      else if (aSO.FindAttribute(anAttr, theTypes[j]))
+        theValues[i*theTypes.size()+j] = anAttr->Save();
+    }
+  }
+}
+
 //============================================================================
 /*! Function : NewChildIterator
  *  Purpose  : Create a ChildIterator from an SObject
@@ -1716,42 +2050,6 @@ void SALOMEDSImpl_Study::URL(const std::string& url)
 }
 
 
-//============================================================================
-/*! Function : _FindObject
- *  Purpose  : Find an Object with SALOMEDSImpl_Name = anObjectName
- */
-//============================================================================
-SALOMEDSImpl_SObject SALOMEDSImpl_Study::_FindObject(const SALOMEDSImpl_SObject& SO,
-                                                     const std::string& theObjectName,
-                                                     bool& _find)
-{
-  SALOMEDSImpl_SObject RefSO;
-  if(!SO) return RefSO;
-
-  // Iterate on each objects and subobjects of the component
-  // If objectName find, stop the loop and get the object reference
-  SALOMEDSImpl_AttributeName* anAttr;
-
-  std::string soid = SO.GetID();
-  DF_ChildIterator it(SO.GetLabel());
-  for (; it.More(); it.Next()){
-    if(!_find)
-      {
-        if ((anAttr=(SALOMEDSImpl_AttributeName*)it.Value().FindAttribute(SALOMEDSImpl_AttributeName::GetID())))
-        {
-          std::string Val(anAttr->Value());
-          if (Val == theObjectName)
-            {
-              RefSO = GetSObject(it.Value());
-              _find = true;
-            }
-        }
-        if (!_find) RefSO = _FindObject(GetSObject(it.Value()), theObjectName, _find);
-      }
-  }
-  return RefSO;
-}
-
 //============================================================================
 /*! Function : _FindObjectIOR
  *  Purpose  : Find an Object with SALOMEDSImpl_IOR = anObjectIOR
@@ -1773,7 +2071,7 @@ SALOMEDSImpl_Study::_FindObjectIOR(const SALOMEDSImpl_SObject& SO,
   for (; it.More();it.Next()){
     if(!_find)
       {
-        if ((anAttr=(SALOMEDSImpl_AttributeIOR*)it.Value().FindAttribute(SALOMEDSImpl_AttributeIOR::GetID())))
+        if ((anAttr=(SALOMEDSImpl_AttributeIOR*)it.Value().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeIOR>())))
         {
           std::string Val(anAttr->Value());
           if (Val == theObjectIOR)
@@ -1854,6 +2152,7 @@ void SALOMEDSImpl_Study::UpdateIORLabelMap(const std::string& anIOR,const std::s
 {
   _errorCode = "";
   DF_Label aLabel = DF_Label::Label(_doc->Main(), anEntry, true);
+  std::lock_guard<std::mutex> aCacheLock(myCacheMutex);
   std::map<std::string, DF_Label>::iterator it=myIORLabels.find(anIOR);
   if (it != myIORLabels.end()) myIORLabels.erase(it);
   myIORLabels[anIOR] = aLabel;
@@ -1861,6 +2160,7 @@ void SALOMEDSImpl_Study::UpdateIORLabelMap(const std::string& anIOR,const std::s
 
 void SALOMEDSImpl_Study::DeleteIORLabelMapItem(const std::string& anIOR)
 {
+  std::lock_guard<std::mutex> aCacheLock(myCacheMutex);
   std::map<std::string, DF_Label>::iterator it=myIORLabels.find(anIOR);
   if (it != myIORLabels.end())
     {
@@ -1869,10 +2169,51 @@ void SALOMEDSImpl_Study::DeleteIORLabelMapItem(const std::string& anIOR)
     }
 }
 
+void SALOMEDSImpl_Study::AddNameLabelMapItem(const std::string& aName, const DF_Label& aLabel)
+{
+  std::lock_guard<std::mutex> aCacheLock(myCacheMutex);
+  if (myNameLabelsBuilt) myNameLabels.insert(std::make_pair(NameLabelKey(aName, aLabel, _doc->Main()), aLabel));
+}
+
+void SALOMEDSImpl_Study::DeleteNameLabelMapItem(const std::string& aName, const DF_Label& aLabel)
+{
+  std::lock_guard<std::mutex> aCacheLock(myCacheMutex);
+  if (!myNameLabelsBuilt) return;
+  std::pair<NameLabels::iterator, NameLabels::iterator> aRange =
+    myNameLabels.equal_range(NameLabelKey(aName, aLabel, _doc->Main()));
+  for (NameLabels::iterator it = aRange.first; it != aRange.second; it++) {
+    if (it->second == aLabel) {
+      myNameLabels.erase(it);
+      break;
+    }
+  }
+}
+
+//============================================================================
+/*! Function : BuildNameLabelMap
+ *  Purpose  : Fills the map of names on the first search by name, afterwards
+ *             it is kept up to date by SALOMEDSImpl_AttributeName
+ */
+//============================================================================
+void SALOMEDSImpl_Study::BuildNameLabelMap()
+{
+  std::lock_guard<std::mutex> aCacheLock(myCacheMutex);
+  if (myNameLabelsBuilt) return;
+
+  SALOMEDSImpl_AttributeName* anAttr;
+  DF_Label aMain = _doc->Main();
+  DF_ChildIterator it(_doc->Root(), true);
+  for (; it.More(); it.Next()) {
+    if ((anAttr=(SALOMEDSImpl_AttributeName*)it.Value().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeName>())))
+      myNameLabels.insert(std::make_pair(NameLabelKey(anAttr->Value(), it.Value(), aMain), it.Value()));
+  }
+  myNameLabelsBuilt = true;
+}
+
 SALOMEDSImpl_Study* SALOMEDSImpl_Study::GetStudyImpl(const DF_Label& theLabel)
 {
   SALOMEDSImpl_StudyHandle* Att;
-  if ((Att=(SALOMEDSImpl_StudyHandle*)theLabel.Root().FindAttribute(SALOMEDSImpl_StudyHandle::GetID()))) {
+  if ((Att=(SALOMEDSImpl_StudyHandle*)theLabel.Root().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_StudyHandle>()))) {
     return Att->Get();
   }
   return NULL;
@@ -1901,7 +2242,7 @@ std::vector<SALOMEDSImpl_SObject> SALOMEDSImpl_Study::FindDependances(const SALO
   std::vector<SALOMEDSImpl_SObject> aSeq;
 
   SALOMEDSImpl_AttributeTarget* aTarget;
-  if ((aTarget=(SALOMEDSImpl_AttributeTarget*)anObject.GetLabel().FindAttribute(SALOMEDSImpl_AttributeTarget::GetID()))) {
+  if ((aTarget=(SALOMEDSImpl_AttributeTarget*)anObject.GetLabel().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeTarget>()))) {
     return aTarget->Get();
   }
 
@@ -1976,6 +2317,7 @@ SALOMEDSImpl_UseCaseBuilder* SALOMEDSImpl_Study::GetUseCaseBuilder()
 SALOMEDSImpl_SComponent SALOMEDSImpl_Study::GetSComponent(const std::string& theEntry)
 {
   SALOMEDSImpl_SComponent aSCO;
+  std::lock_guard<std::mutex> aCacheLock(myCacheMutex);
   if(_mapOfSCO.find(theEntry) != _mapOfSCO.end())
     aSCO = _mapOfSCO[theEntry];
   else {
@@ -2005,6 +2347,7 @@ SALOMEDSImpl_SComponent SALOMEDSImpl_Study::GetSComponent(const DF_Label& theLab
 SALOMEDSImpl_SObject SALOMEDSImpl_Study::GetSObject(const std::string& theEntry)
 {
   SALOMEDSImpl_SObject aSO;
+  std::lock_guard<std::mutex> aCacheLock(myCacheMutex);
   std::map<std::string, SALOMEDSImpl_SObject>::iterator it=_mapOfSO.find(theEntry);
   if(it != _mapOfSO.end())
     aSO = it->second;
@@ -2361,7 +2704,7 @@ void SALOMEDSImpl_Study::dump(const std::string& theFileName)
 
   if(!isOpened) {
     _errorCode = std::string("Can't create a file ")+theFileName;
-    std::cout << "### SALOMEDSImpl_Study::dump Error: " << _errorCode << std::endl;
+    std::cout << "### SALOMEDSImpl_Study::dump Error: " << GetErrorCode() << std::endl;
     return;
   }
 
@@ -2491,7 +2834,7 @@ SALOMEDSImpl_AttributeParameter* SALOMEDSImpl_Study::GetModuleParameters(const c
   std::string moduleName(theModuleName);
   for(; it.More(); it.Next()) {
     SALOMEDSImpl_SObject so(it.Value());
-    if((par=(SALOMEDSImpl_AttributeParameter*)so.GetLabel().FindAttribute(SALOMEDSImpl_AttributeParameter::GetID()))) {
+    if((par=(SALOMEDSImpl_AttributeParameter*)so.GetLabel().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeParameter>()))) {
       if(!par->IsSet("AP_MODULE_NAME", (Parameter_Types)3)) continue; //3 -> PT_STRING
       if(par->GetString("AP_MODULE_NAME") == moduleName) return par;
     }
@@ -2953,6 +3296,7 @@ void SALOMEDSImpl_Study::EnableUseCaseAutoFilling(bool isEnabled)
 std::vector<std::string> SALOMEDSImpl_Study::GetIORs()
 {
   std::vector<std::string> anIORs;
+  std::lock_guard<std::mutex> aCacheLock(myCacheMutex);
   std::map<std::string, DF_Label>::const_iterator MI;
   for(MI = myIORLabels.begin(); MI!=myIORLabels.end(); MI++)
     anIORs.push_back(MI->first);
@@ -3072,6 +3416,18 @@ static void SaveAttributes(const SALOMEDSImpl_SObject& aSO, HDFgroup *hdf_group_
     //The following attributes are not supposed to be written to the file
     std::string type = SALOMEDSImpl_GenericAttribute::Impl_GetType(anAttr);
     if(type == std::string("AttributeIOR")) continue; //IOR attribute is not saved
+    //Tables and sequences are stored as bytes in their binary form
+    SALOMEDSImpl_GenericAttribute* aGA = dynamic_cast<SALOMEDSImpl_GenericAttribute*>(anAttr);
+    std::string aBinary = aGA ? aGA->SaveBinary() : std::string();
+    if(!aBinary.empty()) {
+      size[0] = (hdf_size) aBinary.size();
+      HDFdataset *hdf_dataset = new HDFdataset((char*)type.c_str(), hdf_group_sobject, HDF_CHAR, size, 1);
+      hdf_dataset->CreateOnDisk();
+      hdf_dataset->WriteOnDisk((char*)aBinary.data());
+      hdf_dataset->CloseOnDisk();
+      hdf_dataset=0; //will be deleted by hdf_sco_group destructor
+      continue;
+    }
     std::string aSaveStr =anAttr->Save();
     //cout << "Saving: " << aSO.GetID() << " type: "<< type<<"|" << endl;
     size[0] = (hdf_int32) strlen(aSaveStr.c_str()) + 1;
@@ -3093,6 +3449,18 @@ static void ReadAttributes(SALOMEDSImpl_Study* theStudy,
   hdf_dataset->OpenOnDisk();
 
   DF_Attribute* anAttr = NULL;
+  if (hdf_dataset->GetType() == HDF_CHAR) { // binary form of SALOMEDSImpl_GenericAttribute::SaveBinary
+    std::string aBinary(hdf_dataset->GetSize(), 0);
+    if (!aBinary.empty())
+      hdf_dataset->ReadFromDisk(&aBinary[0]);
+    SALOMEDSImpl_GenericAttribute* aGA = dynamic_cast<SALOMEDSImpl_GenericAttribute*>
+      (theStudy->NewBuilder()->FindOrCreateAttribute(aSO, hdf_dataset->GetName()));
+    if (aGA)
+      aGA->LoadBinary(aBinary); // an unknown version leaves the attribute empty
+    hdf_dataset->CloseOnDisk();
+    return;
+  }
+
   char* current_string = new char[hdf_dataset->GetSize()+1];
   hdf_dataset->ReadFromDisk(current_string);
   //cout << "Reading attr type = " << hdf_dataset->GetName() << "  SO = " << aSO.GetID() << endl;
@@ -3133,10 +3501,11 @@ static void BuildTree (SALOMEDSImpl_Study* theStudy, HDFgroup* hdf_current_group
     aSO = theStudy->CreateObjectID(Entry);
   }
 
-  char name[HDF_NAME_MAX_LEN+1];
   int nbsons = hdf_current_group->nInternalObjects();
+  std::vector<char> names(nbsons*(HDF_NAME_MAX_LEN+1)+1);
+  hdf_current_group->InternalObjectsIndentify(nbsons, &names[0]);
   for (int i=0; i<nbsons; i++) {
-    hdf_current_group->InternalObjectIndentify(i,name);
+    char* name = &names[i*(HDF_NAME_MAX_LEN+1)];
     if (strncmp(name, "INTERNAL_COMPLEX",16) == 0) continue;
     hdf_object_type type = hdf_current_group->InternalObjectType(name);
 
@@ -3169,7 +3538,7 @@ static void Translate_IOR_to_persistentID (const SALOMEDSImpl_SObject& so,
   for (; itchild.More(); itchild.Next()) {
     SALOMEDSImpl_SObject current = SALOMEDSImpl_Study::SObject(itchild.Value());
     SALOMEDSImpl_AttributeIOR* IOR = NULL;
-    if ((IOR=(SALOMEDSImpl_AttributeIOR*)current.GetLabel().FindAttribute(SALOMEDSImpl_AttributeIOR::GetID()))) {
+    if ((IOR=(SALOMEDSImpl_AttributeIOR*)current.GetLabel().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeIOR>()))) {
       ior_string = IOR->Value();
 
       persistent_string = engine->IORToLocalPersistentID (current, ior_string, isMultiFile, isASCII);
@@ -32,6 +32,8 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <mutex>
+#include <atomic>
 
 #include "DF_Document.hxx"
 #include "DF_Label.hxx"
@@ -58,6 +60,33 @@ class SALOMEDSImpl_GenericAttribute;
 class SALOMEDSIMPL_EXPORT SALOMEDSImpl_Study
 {
 private:
+  //! error of the last call, it is set by the readers of the study as well,
+  //! which may run in parallel (see SALOMEDS::ReadLocker)
+  class ErrorCode
+  {
+  public:
+    ErrorCode() : myIsError(false) {}
+    ErrorCode& operator=(const std::string& theError)
+    {
+      // most of the calls reset the error, this does not need the lock
+      if (theError.empty() && !myIsError) return *this;
+      std::lock_guard<std::mutex> aLock(myMutex);
+      myError = theError;
+      myIsError = !theError.empty();
+      return *this;
+    }
+    operator std::string() const
+    {
+      if (!myIsError) return std::string();
+      std::lock_guard<std::mutex> aLock(myMutex);
+      return myError;
+    }
+  private:
+    mutable std::mutex myMutex;
+    std::string        myError;
+    std::atomic<bool>  myIsError;
+  };
+
   std::string              _name;  
   DF_Application*          _appli;
   DF_Document*             _doc;  // Document
@@ -65,7 +94,7 @@ private:
   bool                     _Saved; // True if the Study is saved
   std::string              _URL; //URL of the persistent reference of the study
   bool                     _autoFill; 
-  std::string              _errorCode;
+  ErrorCode                _errorCode;
   std::vector<std::string> _lockers;
   SALOMEDSImpl_Callback*   _cb;
   SALOMEDSImpl_StudyBuilder*   _builder;
@@ -77,16 +106,18 @@ private:
   std::map<std::string, SALOMEDSImpl_SObject> _mapOfSO;
   std::map<std::string, SALOMEDSImpl_SComponent> _mapOfSCO;
   std::map<std::string, DF_Label> myIORLabels;
+  std::mutex               myCacheMutex; // guards the maps above and below, filled by the readers too
+  std::multimap<std::pair<int, std::string>, DF_Label> myNameLabels; // by component tag and name, built on the first search by name
+  bool                     myNameLabelsBuilt;
   std::vector<SALOMEDSImpl_GenericVariable*> myNoteBookVars;
-
-  SALOMEDSImpl_SObject   _FindObject(const SALOMEDSImpl_SObject& SO,
-    const std::string& anObjectName,
-    bool& _find);
+  std::vector< std::pair<std::string, double> > mySaveTimings; // seconds spent by each engine during the last save
 
   SALOMEDSImpl_SObject   _FindObjectIOR(const SALOMEDSImpl_SObject& SO,
     const std::string& anObjectIOR,
     bool& _find);
 
+  void BuildNameLabelMap();
+
   std::string _GetStudyVariablesScript();
   std::string _GetNoteBookAccessor();
   std::string _GetNoteBookAccess();
@@ -111,15 +142,18 @@ public:
   virtual bool Open(const std::string& aStudyUrl);
 
   //! method to save a Study
+  //! if theCompressed is true, the big datasets of the HDF file are chunked and compressed
   virtual bool Save(SALOMEDSImpl_DriverFactory* aFactory,
                     bool theMultiFile,
-                    bool theASCII);
+                    bool theASCII,
+                    bool theCompressed = false);
 
   //! method to save a Study to the persistent reference aUrl
   virtual bool SaveAs(const std::string& aUrl,
                       SALOMEDSImpl_DriverFactory* aFactory,
                       bool theMultiFile,
-                      bool theASCII);
+                      bool theASCII,
+                      bool theCompressed = false);
 
   bool CopyLabel(SALOMEDSImpl_Driver* theEngine,
                  const int theSourceStartDepth,
@@ -140,7 +174,8 @@ public:
   virtual bool Impl_SaveAs(const std::string& aUrl,
                            SALOMEDSImpl_DriverFactory* aFactory,
                            bool theMultiFile,
-                           bool theASCII);
+                           bool theASCII,
+                           bool theCompressed = false);
 
   // _SaveObject private function called by _SaveAs
   virtual bool Impl_SaveObject(const SALOMEDSImpl_SObject& SC, HDFgroup *hdf_group_datatype);
@@ -185,6 +220,20 @@ public:
 
   std::string GetObjectPathByIOR(const std::string& theIOR);
 
+  //! method to get in one pass the attributes of the objects theEntries (and of all their
+  //! descendants if theWithChildren is true): the entry, name, IOR and types of the
+  //! attributes of each object found, and the persistent value of the attributes theTypes
+  //! (the IOR for AttributeIOR),
+  //! theValues[i*theTypes.size()+j] being empty if object i has no attribute theTypes[j]
+  virtual void GetObjectsAttributes(const std::vector<std::string>& theEntries,
+                                    bool theWithChildren,
+                                    const std::vector<std::string>& theTypes,
+                                    std::vector<std::string>& theObjectEntries,
+                                    std::vector<std::string>& theNames,
+                                    std::vector<std::string>& theIORs,
+                                    std::vector< std::vector<std::string> >& theObjectTypes,
+                                    std::vector<std::string>& theValues);
+
   //! method to Create a ChildIterator from an SObject 
   virtual SALOMEDSImpl_ChildIterator NewChildIterator(const SALOMEDSImpl_SObject& aSO);
 
@@ -219,6 +268,9 @@ public:
   
   virtual void DeleteIORLabelMapItem(const std::string& anIOR);
   virtual void UpdateIORLabelMap(const std::string& anIOR, const std::string& aLabel);
+
+  virtual void AddNameLabelMapItem(const std::string& aName, const DF_Label& aLabel);
+  virtual void DeleteNameLabelMapItem(const std::string& aName, const DF_Label& aLabel);
   
   virtual std::vector<SALOMEDSImpl_SObject> FindDependances(const SALOMEDSImpl_SObject& anObject);
   
@@ -227,13 +279,16 @@ public:
   virtual std::string GetLastModificationDate();
   
   virtual std::vector<std::string> GetModificationsDate();
+
+  //! returns the time in seconds spent by each component engine during the last save, in the order of storage
+  virtual std::vector< std::pair<std::string, double> > GetLastSaveTimings() { return mySaveTimings; }
   
   virtual SALOMEDSImpl_UseCaseBuilder* GetUseCaseBuilder();
   
   void EnableUseCaseAutoFilling(bool isEnabled);
   
   virtual std::string GetErrorCode() { return _errorCode; }
-  virtual bool IsError() { return _errorCode != ""; }
+  virtual bool IsError() { return !GetErrorCode().empty(); }
   
   virtual SALOMEDSImpl_SComponent GetSComponent(const std::string& theEntry);
   virtual SALOMEDSImpl_SComponent GetSComponent(const DF_Label& theLabel);
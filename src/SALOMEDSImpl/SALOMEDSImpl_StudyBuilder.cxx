@@ -199,14 +199,14 @@ bool SALOMEDSImpl_StudyBuilder::RemoveObject(const SALOMEDSImpl_SObject& anObjec
   DF_Label Lab = anObject.GetLabel();
 
   SALOMEDSImpl_AttributeReference* aReference = NULL;
-  if ((aReference=(SALOMEDSImpl_AttributeReference*)Lab.FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) {
+  if ((aReference=(SALOMEDSImpl_AttributeReference*)Lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) {
     SALOMEDSImpl_AttributeTarget* aTarget = NULL;
-    if ((aTarget=(SALOMEDSImpl_AttributeTarget*)aReference->Get().FindAttribute(SALOMEDSImpl_AttributeTarget::GetID())))
+    if ((aTarget=(SALOMEDSImpl_AttributeTarget*)aReference->Get().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeTarget>())))
       aTarget->Remove(SALOMEDSImpl_Study::SObject(Lab));
   }
 
   SALOMEDSImpl_AttributeIOR* anAttr = NULL; //Remove from IORLabel map
-  if ((anAttr=(SALOMEDSImpl_AttributeIOR*)Lab.FindAttribute(SALOMEDSImpl_AttributeIOR::GetID()))) {
+  if ((anAttr=(SALOMEDSImpl_AttributeIOR*)Lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeIOR>()))) {
     _study->DeleteIORLabelMapItem(anAttr->Value());
   }
 
@@ -237,26 +237,26 @@ bool SALOMEDSImpl_StudyBuilder::RemoveObjectWithChildren(const SALOMEDSImpl_SObj
   DF_Label Lab = anObject.GetLabel();
 
   SALOMEDSImpl_AttributeReference* aReference = NULL;
-  if ((aReference=(SALOMEDSImpl_AttributeReference*)Lab.FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) {
+  if ((aReference=(SALOMEDSImpl_AttributeReference*)Lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) {
     SALOMEDSImpl_AttributeTarget* aTarget = NULL;
-    if ((aTarget=(SALOMEDSImpl_AttributeTarget*)aReference->Get().FindAttribute(SALOMEDSImpl_AttributeTarget::GetID())))
+    if ((aTarget=(SALOMEDSImpl_AttributeTarget*)aReference->Get().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeTarget>())))
       aTarget->Remove(SALOMEDSImpl_Study::SObject(Lab));
   }
   SALOMEDSImpl_AttributeIOR* anAttr = NULL; //Remove from IORLabel map
-  if ((anAttr=(SALOMEDSImpl_AttributeIOR*)Lab.FindAttribute(SALOMEDSImpl_AttributeIOR::GetID()))) {
+  if ((anAttr=(SALOMEDSImpl_AttributeIOR*)Lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeIOR>()))) {
     _study->DeleteIORLabelMapItem(anAttr->Value());
   }
 
   DF_ChildIterator it(Lab, true);
   for(;it.More();it.Next()) {
     DF_Label aLabel = it.Value();
-    if ((aReference=(SALOMEDSImpl_AttributeReference*)aLabel.FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) {
+    if ((aReference=(SALOMEDSImpl_AttributeReference*)aLabel.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) {
       SALOMEDSImpl_AttributeTarget* aTarget = NULL;
-      if ((aTarget=(SALOMEDSImpl_AttributeTarget*)aReference->Get().FindAttribute(SALOMEDSImpl_AttributeTarget::GetID())))
+      if ((aTarget=(SALOMEDSImpl_AttributeTarget*)aReference->Get().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeTarget>())))
         aTarget->Remove(SALOMEDSImpl_Study::SObject(aLabel));
     }
     SALOMEDSImpl_AttributeIOR* anAttr = NULL; //Remove from IORLabel map
-    if ((anAttr=(SALOMEDSImpl_AttributeIOR*)aLabel.FindAttribute(SALOMEDSImpl_AttributeIOR::GetID()))) {
+    if ((anAttr=(SALOMEDSImpl_AttributeIOR*)aLabel.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeIOR>()))) {
       _study->DeleteIORLabelMapItem(anAttr->Value());
     }
   }
@@ -283,7 +283,7 @@ bool SALOMEDSImpl_StudyBuilder::LoadWith(const SALOMEDSImpl_SComponent& anSCO,
   SALOMEDSImpl_AttributePersistentRef* Att = NULL;
 
   //Find the current Url of the study  
-  if ((Att=(SALOMEDSImpl_AttributePersistentRef*)_doc->Main().FindAttribute(SALOMEDSImpl_AttributePersistentRef::GetID()))) {
+  if ((Att=(SALOMEDSImpl_AttributePersistentRef*)_doc->Main().FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributePersistentRef>()))) {
     int aLocked = _study->GetProperties()->IsLocked();
     if (aLocked) _study->GetProperties()->SetLocked(false);
 
@@ -292,7 +292,7 @@ bool SALOMEDSImpl_StudyBuilder::LoadWith(const SALOMEDSImpl_SComponent& anSCO,
 
     SALOMEDSImpl_AttributeComment* type = NULL;
     std::string DataType;
-    if ((type=(SALOMEDSImpl_AttributeComment*)Lab.FindAttribute(SALOMEDSImpl_AttributeComment::GetID())))
+    if ((type=(SALOMEDSImpl_AttributeComment*)Lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeComment>())))
       DataType = type->Value();
 
     // associate the driver to the SComponent
@@ -303,32 +303,28 @@ bool SALOMEDSImpl_StudyBuilder::LoadWith(const SALOMEDSImpl_SComponent& anSCO,
 
     // mpv 06.03.2003: SAL1927 - if component data if already loaded, it is not necessary to do it again
     SALOMEDSImpl_AttributeIOR* attrIOR = NULL;
-    if ((attrIOR=(SALOMEDSImpl_AttributeIOR*)Lab.FindAttribute(SALOMEDSImpl_AttributeIOR::GetID()))) {
+    if ((attrIOR=(SALOMEDSImpl_AttributeIOR*)Lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeIOR>()))) {
       if (aLocked) _study->GetProperties()->SetLocked(true);
       return true;
     }
 
     DefineComponentInstance (anSCO, aDriver->GetIOR());
 
-    std::string aHDFUrl;
-    bool isASCII = false;
-    if (HDFascii::isASCII(aHDFPath.c_str())) {
-      isASCII = true;
-      aHDFUrl = HDFascii::ConvertFromASCIIToHDF(aHDFPath.c_str());
-      aHDFUrl += "hdf_from_ascii.hdf";
-    } else {
-      aHDFUrl = aHDFPath;
-    }
-
-    //Open the Study HDF file 
-    HDFfile *hdf_file = new HDFfile((char*)aHDFUrl.c_str()); 
+    HDFfile *hdf_file = 0;
 
     char aMultifileState[2] = { '0','0' };
     char ASCIIfileState[2] = { '0','0' };
     bool hasModuleData = false;
     try {
       std::string scoid = anSCO.GetID();
-      hdf_file->OpenOnDisk(HDF_RDONLY);
+      //Open the Study HDF file, an ASCII study is loaded in memory
+      if (HDFascii::isASCII(aHDFPath.c_str())) {
+        hdf_file = HDFascii::LoadFromASCII(aHDFPath.c_str());
+        if (!hdf_file) throw HDFexception("Unable to load ASCII file");
+      } else {
+        hdf_file = new HDFfile((char*)aHDFPath.c_str());
+        hdf_file->OpenOnDisk(HDF_RDONLY);
+      }
       HDFgroup *hdf_group = new HDFgroup("DATACOMPONENT",hdf_file);
       hdf_group->OpenOnDisk();
       HDFgroup *hdf_sco_group = new HDFgroup((char*)scoid.c_str(), hdf_group);
@@ -392,23 +388,10 @@ bool SALOMEDSImpl_StudyBuilder::LoadWith(const SALOMEDSImpl_SComponent& anSCO,
       hdf_group = 0;
       hdf_file->CloseOnDisk();
       delete hdf_file;
-
-      if (isASCII) {
-        std::vector<std::string> aFilesToRemove;
-        aFilesToRemove.push_back("hdf_from_ascii.hdf");
-        SALOMEDSImpl_Tool::RemoveTemporaryFiles(SALOMEDSImpl_Tool::GetDirFromPath(aHDFUrl),
-                                                aFilesToRemove, true);
-      }      
     }
     catch (HDFexception) {
       delete hdf_file;
 
-      if (isASCII) {
-        std::vector<std::string> aFilesToRemove;
-        aFilesToRemove.push_back(aHDFUrl);
-        SALOMEDSImpl_Tool::RemoveTemporaryFiles(SALOMEDSImpl_Tool::GetDirFromPath(aHDFUrl), aFilesToRemove, true);
-      }
-
       if (aLocked) _study->GetProperties()->SetLocked(true);
 
       if (!hasModuleData)
@@ -551,7 +534,7 @@ bool SALOMEDSImpl_StudyBuilder::RemoveAttribute(const SALOMEDSImpl_SObject& anOb
   
   if (aTypeOfAttribute == std::string("AttributeIOR")) { // Remove from IORLabel map
     SALOMEDSImpl_AttributeIOR* anAttr = NULL;
-    if ((anAttr=(SALOMEDSImpl_AttributeIOR*)Lab.FindAttribute(SALOMEDSImpl_AttributeIOR::GetID()))) {
+    if ((anAttr=(SALOMEDSImpl_AttributeIOR*)Lab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeIOR>()))) {
       _study->DeleteIORLabelMapItem(anAttr->Value());
     }
   }
@@ -609,7 +592,7 @@ bool SALOMEDSImpl_StudyBuilder::RemoveReference(const SALOMEDSImpl_SObject& me)
   DF_Label RefLab = theReferencedObject.GetLabel();
        
   SALOMEDSImpl_AttributeTarget* aTarget = NULL;
-  if((aTarget=(SALOMEDSImpl_AttributeTarget*)RefLab.FindAttribute(SALOMEDSImpl_AttributeTarget::GetID()))) {
+  if((aTarget=(SALOMEDSImpl_AttributeTarget*)RefLab.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeTarget>()))) {
     aTarget->Remove(SALOMEDSImpl_Study::SObject(Lab));
   }
   
@@ -916,6 +899,69 @@ bool SALOMEDSImpl_StudyBuilder::SetIOR(const SALOMEDSImpl_SObject& theSO,
   return true;
 }
 
+//============================================================================
+/*! Function : IsBuilderAttributeType
+ *  Purpose  : Returns true if FindOrCreateAttribute creates the attributes of this type
+ */
+//============================================================================
+static bool IsBuilderAttributeType(const std::string& theType)
+{
+  if(theType == "AttributeReference") // set by Addreference only
+    return false;
+  if(strncmp(theType.c_str(), "AttributeTreeNode", 17) == 0 || strncmp(theType.c_str(), "AttributeUserID", 15) == 0)
+    return true;
+  return !SALOMEDSImpl_SObject::GetGUID(theType).empty();
+}
+
+//============================================================================
+/*! Function : SetObjectsAttributes
+ *  Purpose  : Sets the attributes of several objects in one call; nothing is modified
+ *             if one of the objects or of the types is invalid
+ */
+//============================================================================
+bool SALOMEDSImpl_StudyBuilder::SetObjectsAttributes(const std::vector<std::string>& theEntries,
+                                                     const std::vector<std::string>& theTypes,
+                                                     const std::vector<std::string>& theValues)
+{
+  _errorCode = "";
+  CheckLocked();
+  if(theTypes.size() != theEntries.size() || theValues.size() != theEntries.size()) {
+    _errorCode = "Invalid arguments";
+    return false;
+  }
+
+  // check all the objects and types before modifying any of them
+  std::vector<SALOMEDSImpl_SObject> anObjects;
+  anObjects.reserve(theEntries.size());
+  for(size_t i = 0; i < theEntries.size(); i++) {
+    if(!IsBuilderAttributeType(theTypes[i])) {
+      _errorCode = "Invalid attribute type";
+      return false;
+    }
+    anObjects.push_back(_study->FindObjectID(theEntries[i]));
+    if(!anObjects.back()) {
+      _errorCode = "Invalid arguments";
+      return false;
+    }
+  }
+
+  for(size_t i = 0; i < theEntries.size(); i++) {
+    const DF_Label& aLabel = anObjects[i].GetLabel();
+    if(theTypes[i] == "AttributeName")
+      SALOMEDSImpl_AttributeName::Set(aLabel, theValues[i]);
+    else if(theTypes[i] == "AttributeComment")
+      SALOMEDSImpl_AttributeComment::Set(aLabel, theValues[i]);
+    else if(theTypes[i] == "AttributeIOR")
+      SALOMEDSImpl_AttributeIOR::Set(aLabel, theValues[i]);
+    else
+      FindOrCreateAttribute(anObjects[i], theTypes[i])->Load(theValues[i]);
+  }
+
+  _doc->SetModified(true);
+
+  return true;
+}
+
 
 //============================================================================
 /*! Function : Translate_persistentID_to_IOR
@@ -930,10 +976,10 @@ static void Translate_persistentID_to_IOR(DF_Label& Lab, SALOMEDSImpl_Driver* dr
   for (; itchild.More(); itchild.Next()) {
     DF_Label current = itchild.Value();
     SALOMEDSImpl_AttributePersistentRef* Att = NULL;
-    if ((Att=(SALOMEDSImpl_AttributePersistentRef*)current.FindAttribute(SALOMEDSImpl_AttributePersistentRef::GetID()))) {  
+    if ((Att=(SALOMEDSImpl_AttributePersistentRef*)current.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributePersistentRef>()))) {  
 
       SALOMEDSImpl_AttributeLocalID* anID = NULL;
-      if ((anID=(SALOMEDSImpl_AttributeLocalID*)current.FindAttribute(SALOMEDSImpl_AttributeLocalID::GetID()))) 
+      if ((anID=(SALOMEDSImpl_AttributeLocalID*)current.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeLocalID>()))) 
         if (anID->Value() == FILELOCALID) continue;   //SRN: This attribute store a file name, skip it 
 
       std::string persist_ref = Att->Value();
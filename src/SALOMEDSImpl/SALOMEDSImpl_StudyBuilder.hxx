@@ -110,6 +110,14 @@ public:
 
   virtual bool SetIOR(const SALOMEDSImpl_SObject& theSO, const std::string& theValue);
 
+  //! sets theValues[i] to the attribute theTypes[i] of the object theEntries[i];
+  //! names, comments and IORs are set as by SetName(), SetComment() and SetIOR(),
+  //! the other attributes are restored from their persistent value. Returns false without modifying
+  //! anything if an entry or a type is invalid.
+  virtual bool SetObjectsAttributes(const std::vector<std::string>& theEntries,
+                                    const std::vector<std::string>& theTypes,
+                                    const std::vector<std::string>& theValues);
+
   virtual std::string GetErrorCode() { return _errorCode; }
   virtual bool IsError() { return _errorCode != ""; }
 
@@ -61,7 +61,7 @@ SALOMEDSImpl_StudyHandle* SALOMEDSImpl_StudyHandle::Set(const DF_Label& theLabel
 {
   SALOMEDSImpl_StudyHandle* A = NULL;
   if (!(A=(SALOMEDSImpl_StudyHandle*)theLabel.FindAttribute(GetID()))) {
-    A = new SALOMEDSImpl_StudyHandle; 
+    A = new(theLabel) SALOMEDSImpl_StudyHandle; 
     theLabel.AddAttribute(A);
   }
 
@@ -33,6 +33,7 @@
 #include <string.h>
 #include <iterator>
 #include <sstream>
+#include <algorithm>
 
 #include "Basics_DirUtils.hxx"
 #include "Basics_Utils.hxx"
@@ -45,6 +46,12 @@
 #include <sys/types.h>
 #include <pwd.h> 
 #include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <errno.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
 #else
 #include <time.h>
 #include <lmcons.h>
@@ -58,6 +65,191 @@ bool SALOMEDS_Exists(const std::string thePath)
 	return Kernel_Utils::IsExists( thePath );
 }
 
+namespace
+{
+#ifdef WIN32
+  // the paths given to the Windows API
+#ifdef UNICODE
+  typedef std::wstring NativePath;
+  NativePath toNative(const std::string& thePath) { return Kernel_Utils::utf8_decode_s(thePath); }
+  std::string fromNative(const NativePath& thePath) { return Kernel_Utils::utf8_encode_s(thePath); }
+#else
+  typedef std::string NativePath;
+  NativePath toNative(const std::string& thePath) { return thePath; }
+  std::string fromNative(const NativePath& thePath) { return thePath; }
+#endif
+#endif
+
+  std::string lastError()
+  {
+#ifdef WIN32
+    std::ostringstream aStream;
+    aStream << "error " << ::GetLastError();
+    return aStream.str();
+#else
+    return strerror(errno);
+#endif
+  }
+
+  // Lists the names of the entries of <theDirectory>, "." and ".." excluded
+  bool listDirectory(const std::string& theDirectory, std::vector<std::string>& theNames)
+  {
+#ifdef WIN32
+    WIN32_FIND_DATA aData;
+    HANDLE aHandle = FindFirstFile(toNative(theDirectory + "*").c_str(), &aData);
+    if (aHandle == INVALID_HANDLE_VALUE)
+      return ::GetLastError() == ERROR_FILE_NOT_FOUND;
+    do {
+      std::string aName = fromNative(aData.cFileName);
+      if (aName != "." && aName != "..")
+        theNames.push_back(aName);
+    } while (FindNextFile(aHandle, &aData));
+    FindClose(aHandle);
+#else
+    DIR* aDir = opendir(theDirectory.c_str());
+    if (!aDir) return false;
+    while (struct dirent* anEntry = readdir(aDir)) {
+      std::string aName = anEntry->d_name;
+      if (aName != "." && aName != "..")
+        theNames.push_back(aName);
+    }
+    closedir(aDir);
+#endif
+    return true;
+  }
+
+  // Removes a single file; a file which does not exist is not an error
+  bool removeFile(const std::string& theFile)
+  {
+#ifdef WIN32
+    NativePath aFile = toNative(theFile);
+    return DeleteFile(aFile.c_str()) || ::GetLastError() == ERROR_FILE_NOT_FOUND;
+#else
+    return unlink(theFile.c_str()) == 0 || errno == ENOENT;
+#endif
+  }
+
+#ifndef WIN32
+  // Copies the whole content of <theIn> to <theOut>, in the kernel when it can
+  bool copyContent(int theIn, int theOut, off_t theSize)
+  {
+    bool useCopyRange = true, useSendFile = true;
+    off_t aDone = 0;
+    while (aDone < theSize) {
+      size_t aCount = (size_t)(theSize - aDone);
+      ssize_t aRes = -1;
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+      if (useCopyRange) {
+        aRes = copy_file_range(theIn, NULL, theOut, NULL, aCount, 0);
+        if (aRes < 0 && errno != EINTR) { useCopyRange = false; continue; }
+      }
+      else
+#else
+      useCopyRange = false;
+#endif
+#ifdef __linux__
+      if (useSendFile) {
+        aRes = sendfile(theOut, theIn, NULL, aCount);
+        if (aRes < 0 && errno != EINTR) { useSendFile = false; continue; }
+      }
+      else
+#endif
+      {
+        char aBuffer[65536];
+        aRes = read(theIn, aBuffer, std::min(aCount, sizeof(aBuffer)));
+        for (ssize_t aWritten = 0; aRes > 0 && aWritten < aRes; ) {
+          ssize_t n = write(theOut, aBuffer + aWritten, aRes - aWritten);
+          if (n < 0 && errno != EINTR) return false;
+          if (n > 0) aWritten += n;
+        }
+        if (aRes < 0 && errno != EINTR) return false;
+      }
+      if (aRes == 0) return false; // file shrunk under our feet
+      if (aRes > 0) aDone += aRes;
+    }
+    return true;
+  }
+#endif
+
+  // Renames <theFrom> to <theTo> on the same file system, replacing <theTo> if it exists
+  bool renameFile(const std::string& theFrom, const std::string& theTo)
+  {
+#ifdef WIN32
+    return MoveFileEx(toNative(theFrom).c_str(), toNative(theTo).c_str(),
+                      MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return rename(theFrom.c_str(), theTo.c_str()) == 0;
+#endif
+  }
+
+  // Moves <theFrom> to <theTo>, replacing <theTo> if it exists; falls back to
+  // a copy followed by a removal when the two paths are on different file systems
+  bool moveFile(const std::string& theFrom, const std::string& theTo, std::string& theError)
+  {
+#ifdef WIN32
+    NativePath aFrom = toNative(theFrom), aTo = toNative(theTo);
+    // HDF may leave the file read-only, which would forbid the removal of the source
+    SetFileAttributes(aFrom.c_str(), FILE_ATTRIBUTE_NORMAL);
+    if (MoveFileEx(aFrom.c_str(), aTo.c_str(),
+                   MOVEFILE_REPLACE_EXISTING | MOVEFILE_COPY_ALLOWED | MOVEFILE_WRITE_THROUGH))
+      return true;
+    theError = "Can't move " + theFrom + " to " + theTo + ": " + lastError();
+    return false;
+#else
+    if (rename(theFrom.c_str(), theTo.c_str()) == 0)
+      return true;
+    if (errno != EXDEV) {
+      theError = "Can't move " + theFrom + " to " + theTo + ": " + lastError();
+      return false;
+    }
+
+    // the copy is made in a temporary file next to <theTo> and renamed over it once it is
+    // on disk : <theTo> is never left truncated, and the source is removed only then
+    std::string aTmp = theTo + ".XXXXXX";
+    std::vector<char> aTmpName(aTmp.begin(), aTmp.end());
+    aTmpName.push_back('\0');
+    bool isOk = false;
+    struct stat aStat;
+    int anIn = open(theFrom.c_str(), O_RDONLY);
+    int anOut = -1;
+    if (anIn >= 0 && fstat(anIn, &aStat) == 0 && S_ISREG(aStat.st_mode))
+      anOut = mkstemp(&aTmpName[0]);
+    if (anOut >= 0) {
+      fchmod(anOut, aStat.st_mode & 07777);
+      isOk = copyContent(anIn, anOut, aStat.st_size) && fsync(anOut) == 0;
+      if (close(anOut) != 0)
+        isOk = false;
+      if (isOk)
+        isOk = rename(&aTmpName[0], theTo.c_str()) == 0;
+    }
+    if (!isOk) {
+      theError = "Can't copy " + theFrom + " to " + theTo + ": " + lastError();
+      if (anOut >= 0)
+        unlink(&aTmpName[0]);
+    }
+    if (anIn >= 0) close(anIn);
+    if (isOk)
+      unlink(theFrom.c_str());
+    return isOk;
+#endif
+  }
+
+  // Makes the entries of <theDirectory> durable (directory metadata is
+  // written through by MoveFileEx on Windows)
+  bool syncDirectory(const std::string& theDirectory)
+  {
+#ifndef WIN32
+    int aDir = open(theDirectory.c_str(), O_RDONLY);
+    if (aDir < 0) return false;
+    bool isOk = fsync(aDir) == 0;
+    close(aDir);
+    return isOk;
+#else
+    return true;
+#endif
+  }
+}
+
 //============================================================================
 // function : GetTempDir
 // purpose  : Return a temp directory to store created files like "/tmp/sub_dir/"
@@ -78,38 +270,80 @@ void SALOMEDSImpl_Tool::RemoveTemporaryFiles(const std::string& theDirectory,
   std::string aDirName = theDirectory;
 
   size_t i, aLength = theFiles.size(); 
-  for(i=1; i<=aLength; i++) {
-    std::string aFile(aDirName);
-    aFile += theFiles[i-1];
-    if(!SALOMEDS_Exists(aFile)) continue;
+  for(i=1; i<=aLength; i++)
+    removeFile(aDirName + theFiles[i-1]);
 
+  if(IsDirDeleted) {
 #ifdef WIN32
-#if defined(UNICODE)
-	std::wstring aFileToDelete = Kernel_Utils::utf8_decode_s(aFile);
+    RemoveDirectory(toNative(aDirName).c_str());
 #else
-	std::string aFileToDelete = aFile;
-#endif
-    DeleteFile( aFileToDelete.c_str() );
-#else 
-    unlink(aFile.c_str());
+    rmdir(aDirName.c_str());
 #endif
   }
 
-  if(IsDirDeleted) {
-    if(SALOMEDS_Exists(aDirName)) {
-#ifdef WIN32
-#if defined(UNICODE)
-		std::wstring aDirToDelete = Kernel_Utils::utf8_decode_s(aDirName);
-#else
-		std::string aDirToDelete = aDirName;
-#endif
-      RemoveDirectory(aDirToDelete.c_str());
-#else
-      rmdir(aDirName.c_str());
-#endif
+}
+
+//============================================================================
+// function : MoveFiles
+// purpose  : Moves all the files of theFromDirectory to theToDirectory
+//============================================================================
+bool SALOMEDSImpl_Tool::MoveFiles(const std::string& theFromDirectory,
+                                  const std::string& theToDirectory,
+                                  std::string& theError)
+{
+  std::vector<std::string> aNames;
+  if (!listDirectory(theFromDirectory, aNames)) {
+    theError = "Can't read directory " + theFromDirectory + ": " + lastError();
+    return false;
+  }
+
+  // the files replaced in theToDirectory are kept aside until all the files are moved : if one
+  // of them can't be moved, the moved ones are moved back and theToDirectory is restored as it was
+  std::vector<std::string> aBackups(aNames.size()); // empty if no file was replaced
+  size_t aNbMoved = 0;
+  for (; aNbMoved < aNames.size(); aNbMoved++) {
+    std::string aTo = theToDirectory + aNames[aNbMoved];
+    if (Kernel_Utils::IsExists(aTo)) {
+      std::string aBackup = aTo + ".salome_backup";
+      if (!renameFile(aTo, aBackup)) {
+        theError = "Can't move " + aTo + " to " + aBackup + ": " + lastError();
+        break;
+      }
+      aBackups[aNbMoved] = aBackup;
     }
+    if (!moveFile(theFromDirectory + aNames[aNbMoved], aTo, theError))
+      break;
   }
 
+  if (aNbMoved < aNames.size()) {
+    std::string aNotMovedBack, aNotRestored;
+    for (size_t i = 0; i <= aNbMoved; i++) {
+      std::string aTo = theToDirectory + aNames[i];
+      std::string anError;
+      bool isMovedBack = i == aNbMoved || moveFile(aTo, theFromDirectory + aNames[i], anError);
+      if (!isMovedBack)
+        aNotMovedBack += " " + aTo;
+      if (!aBackups[i].empty() && (!isMovedBack || !renameFile(aBackups[i], aTo)))
+        aNotRestored += " " + aBackups[i];
+    }
+    if (aNotMovedBack.empty())
+      theError += "; no file has been moved, they are left in " + theFromDirectory;
+    else
+      theError += "; files moved and not moved back:" + aNotMovedBack;
+    if (!aNotRestored.empty())
+      theError += "; previous files not restored:" + aNotRestored;
+    return false;
+  }
+
+  for (size_t i = 0; i < aBackups.size(); i++)
+    if (!aBackups[i].empty())
+      removeFile(aBackups[i]);
+
+  if (!aNames.empty() && !syncDirectory(theToDirectory)) {
+    theError = "Can't sync directory " + theToDirectory + ": " + lastError();
+    return false;
+  }
+  return true;
 }
 
 //============================================================================
@@ -55,6 +55,14 @@ public:
                                    const std::vector<std::string>& theFiles,
                                    const bool IsDirDeleted);
 
+  // Moves all the files of <theFromDirectory> into <theToDirectory>, replacing existing ones;
+  // files are renamed when possible and copied when the directories are on different devices.
+  // <theToDirectory> is synced once at the end. If a file can't be moved, the files already moved are
+  // moved back and the replaced ones restored; returns false and sets <theError> on failure
+  static bool MoveFiles(const std::string& theFromDirectory,
+                        const std::string& theToDirectory,
+                        std::string& theError);
+
   // Returns the name by the path
   // for an example: if thePath = "/tmp/aaa/doc1.hdf" the function returns "doc1"
   static std::string GetNameFromPath(const std::string& thePath);
@@ -85,11 +85,11 @@ SALOMEDSImpl_UseCaseBuilder::SALOMEDSImpl_UseCaseBuilder(DF_Document* theDocumen
   }
  
   SALOMEDSImpl_AttributeReference* aRef = NULL;
-  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) {
+  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) {
     aRef = SALOMEDSImpl_AttributeReference::Set(_root->Label(), _root->Label());  
   }  
 
-  if(!aLabel.FindAttribute(SALOMEDSImpl_AttributeName::GetID())) { 
+  if(!aLabel.FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeName>())) { 
     SALOMEDSImpl_AttributeName::Set(aLabel, "Use cases"); 
   }  
 }
@@ -122,12 +122,12 @@ bool SALOMEDSImpl_UseCaseBuilder::Append(const SALOMEDSImpl_SObject& theObject)
   aNode->Remove();
 
   SALOMEDSImpl_AttributeReference* aRef;
-  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) {
+  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) {
     aRef = SALOMEDSImpl_AttributeReference::Set(_root->Label(), _root->Label());  
   }  
 
   DF_Label aCurrent = aRef->Get();
-  if(aCurrent.IsNull() || !(aCurrentNode=(SALOMEDSImpl_AttributeTreeNode*)aCurrent.FindAttribute(_root->ID())))
+  if(aCurrent.IsNull() || !(aCurrentNode=(SALOMEDSImpl_AttributeTreeNode*)aCurrent.FindAttribute(_root->GetTypeIndex())))
     aCurrentNode = _root;
 
   aCurrentNode->Append(aNode, &_childIndex);
@@ -152,7 +152,7 @@ bool SALOMEDSImpl_UseCaseBuilder::Remove(const SALOMEDSImpl_SObject& theObject)
   if(aLabel.IsNull()) return false;
 
   SALOMEDSImpl_AttributeTreeNode* aNode = NULL;
-  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->ID()))) return false;
+  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->GetTypeIndex()))) return false;
 
   if ( _lastChild && aNode->GetFather() == _lastChild->GetFather() )
     _lastChild = 0;
@@ -163,7 +163,7 @@ bool SALOMEDSImpl_UseCaseBuilder::Remove(const SALOMEDSImpl_SObject& theObject)
   aList.push_back(aNode);
 
   SALOMEDSImpl_AttributeReference* aRef = NULL;
-  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) {
+  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) {
     aRef = SALOMEDSImpl_AttributeReference::Set(_root->Label(), _root->Label());
   }
 
@@ -200,10 +200,10 @@ bool SALOMEDSImpl_UseCaseBuilder::AppendTo(const SALOMEDSImpl_SObject& theFather
   SALOMEDSImpl_AttributeTreeNode *aFather = NULL, *aNode = NULL;
   
   if(aFatherLabel.IsNull()) return false;
-  if(!(aFather=(SALOMEDSImpl_AttributeTreeNode*)aFatherLabel.FindAttribute(_root->ID()))) return false;
+  if(!(aFather=(SALOMEDSImpl_AttributeTreeNode*)aFatherLabel.FindAttribute(_root->GetTypeIndex()))) return false;
 
   if(aLabel.IsNull()) return false;
-  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->ID()))) {
+  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->GetTypeIndex()))) {
     aNode = SALOMEDSImpl_AttributeTreeNode::Set(aLabel, _root->ID());
   }
 
@@ -249,10 +249,10 @@ int SALOMEDSImpl_UseCaseBuilder::GetIndexInFather(const SALOMEDSImpl_SObject& th
   SALOMEDSImpl_AttributeTreeNode *aFather = NULL, *aNode = NULL;
   
   if(aFatherLabel.IsNull()) return index;
-  if(!(aFather=(SALOMEDSImpl_AttributeTreeNode*)aFatherLabel.FindAttribute(_root->ID()))) return index;
+  if(!(aFather=(SALOMEDSImpl_AttributeTreeNode*)aFatherLabel.FindAttribute(_root->GetTypeIndex()))) return index;
 
   if(aLabel.IsNull()) return index;
-  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->ID()))) {
+  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->GetTypeIndex()))) {
     aNode = SALOMEDSImpl_AttributeTreeNode::Set(aLabel, _root->ID());
   }
 
@@ -304,7 +304,7 @@ bool SALOMEDSImpl_UseCaseBuilder::InsertBefore(const SALOMEDSImpl_SObject& theFi
   SALOMEDSImpl_AttributeTreeNode *aFirstNode = NULL, *aNode = NULL;
 
   if(aFirstLabel.IsNull()) return false;
-  if((aFirstNode=(SALOMEDSImpl_AttributeTreeNode*)aFirstLabel.FindAttribute(_root->ID()))) {
+  if((aFirstNode=(SALOMEDSImpl_AttributeTreeNode*)aFirstLabel.FindAttribute(_root->GetTypeIndex()))) {
     aFirstNode->Remove();
     aFirstLabel.ForgetAttribute(aFirstNode->ID());
   }
@@ -312,7 +312,7 @@ bool SALOMEDSImpl_UseCaseBuilder::InsertBefore(const SALOMEDSImpl_SObject& theFi
   aFirstNode = SALOMEDSImpl_AttributeTreeNode::Set(aFirstLabel, _root->ID());
 
   if(aLabel.IsNull()) return false;
-  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->ID()))) return false;
+  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->GetTypeIndex()))) return false;
 
   aFirstNode->Remove();
 
@@ -345,10 +345,10 @@ bool SALOMEDSImpl_UseCaseBuilder::SetCurrentObject(const SALOMEDSImpl_SObject& t
   DF_Label aLabel = theObject.GetLabel();
   SALOMEDSImpl_AttributeTreeNode* aNode = NULL;
   if(aLabel.IsNull()) return false;
-  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->ID()))) return false;
+  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->GetTypeIndex()))) return false;
 
   SALOMEDSImpl_AttributeReference* aRef = NULL;
-  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) {
+  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) {
     aRef = SALOMEDSImpl_AttributeReference::Set(_root->Label(), aNode->Label());  
   }
   
@@ -367,7 +367,7 @@ bool SALOMEDSImpl_UseCaseBuilder::SetRootCurrent()
   if(!_root) return false;
    
   SALOMEDSImpl_AttributeReference* aRef = NULL;
-  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) 
+  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) 
     aRef = SALOMEDSImpl_AttributeReference::Set(_root->Label(), _root->Label());  
 
   aRef->Set(_root->Label());
@@ -390,7 +390,7 @@ bool SALOMEDSImpl_UseCaseBuilder::HasChildren(const SALOMEDSImpl_SObject& theObj
   if(aLabel.IsNull()) return false;
 
   SALOMEDSImpl_AttributeTreeNode* aNode = NULL;
-  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->ID()))) return false; 
+  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->GetTypeIndex()))) return false; 
   
   return (aNode->GetFirst());
 }
@@ -411,13 +411,13 @@ bool SALOMEDSImpl_UseCaseBuilder::SortChildren(const SALOMEDSImpl_SObject& theOb
   if(aLabel.IsNull()) return false;
 
   SALOMEDSImpl_AttributeTreeNode* aNode = NULL;
-  if (!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->ID()))) return false;
+  if (!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->GetTypeIndex()))) return false;
 
   std::list<SALOMEDSImpl_SObject> aRefSOs;
   std::list<SALOMEDSImpl_SObject> aNodeSOs;
   for ( SALOMEDSImpl_AttributeTreeNode* aChildNode=aNode->GetFirst(); aChildNode; aChildNode=aChildNode->GetNext() ) {
     if ( SALOMEDSImpl_SObject aSO = SALOMEDSImpl_Study::SObject( aChildNode->Label() ) ) {
-      if ( aChildNode->FindAttribute( SALOMEDSImpl_AttributeReference::GetID() ) )
+      if ( aChildNode->FindAttribute( DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>() ) )
         aRefSOs.push_back( aSO );      
       else
         aNodeSOs.push_back( aSO );
@@ -458,7 +458,7 @@ SALOMEDSImpl_SObject SALOMEDSImpl_UseCaseBuilder::GetFather(const SALOMEDSImpl_S
   if (aLabel.IsNull()) return so;
 
   SALOMEDSImpl_AttributeTreeNode* aNode = NULL;
-  if (!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->ID()))) return so; 
+  if (!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->GetTypeIndex()))) return so; 
 
   SALOMEDSImpl_AttributeTreeNode* aFatherNode = aNode->GetFather();
   if (!aFatherNode) return so;
@@ -476,7 +476,7 @@ bool SALOMEDSImpl_UseCaseBuilder::SetName(const std::string& theName) {
 
   SALOMEDSImpl_AttributeName* aNameAttrib = NULL;
 
-  if (!(aNameAttrib=(SALOMEDSImpl_AttributeName*)_root->FindAttribute(SALOMEDSImpl_AttributeName::GetID())))
+  if (!(aNameAttrib=(SALOMEDSImpl_AttributeName*)_root->FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeName>())))
     aNameAttrib = SALOMEDSImpl_AttributeName::Set(_root->Label(), theName);
      
   aNameAttrib->SetValue(theName);
@@ -496,7 +496,7 @@ SALOMEDSImpl_SObject SALOMEDSImpl_UseCaseBuilder::GetCurrentObject()
   if(!_root) return so;
 
   SALOMEDSImpl_AttributeReference* aRef = NULL;
-  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) {
+  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) {
     aRef = SALOMEDSImpl_AttributeReference::Set(_root->Label(), _root->Label());  
   }  
   
@@ -517,7 +517,7 @@ std::string SALOMEDSImpl_UseCaseBuilder::GetName()
   if(!_root) return aString;
   
   SALOMEDSImpl_AttributeName* aName = NULL;
-  if (!(aName=(SALOMEDSImpl_AttributeName*)_root->FindAttribute(SALOMEDSImpl_AttributeName::GetID()))) return aString;
+  if (!(aName=(SALOMEDSImpl_AttributeName*)_root->FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeName>()))) return aString;
   return aName->Value();
 }
 
@@ -551,7 +551,7 @@ bool SALOMEDSImpl_UseCaseBuilder::IsUseCaseNode(const SALOMEDSImpl_SObject& theO
   if(aLabel.IsNull()) return false;
 
   SALOMEDSImpl_AttributeTreeNode* aNode = NULL;
-  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->ID()))) return false; 
+  if(!(aNode=(SALOMEDSImpl_AttributeTreeNode*)aLabel.FindAttribute(_root->GetTypeIndex()))) return false; 
   
   return true;
 }
@@ -573,7 +573,7 @@ SALOMEDSImpl_SObject SALOMEDSImpl_UseCaseBuilder::AddUseCase(const std::string&
 
   DF_Label aLabel = _doc->Main().Root().FindChild(USE_CASE_LABEL_TAG);
 
-  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(SALOMEDSImpl_AttributeReference::GetID()))) {
+  if(!(aRef=(SALOMEDSImpl_AttributeReference*)_root->FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeReference>()))) {
     aRef = SALOMEDSImpl_AttributeReference::Set(aLabel, aLabel);
   }
  
@@ -581,7 +581,7 @@ SALOMEDSImpl_SObject SALOMEDSImpl_UseCaseBuilder::AddUseCase(const std::string&
     aFatherNode = SALOMEDSImpl_AttributeTreeNode::Set(aRef->Get(), aBasicGUID);
   }
 
-  if(!(anInteger=(SALOMEDSImpl_AttributeInteger*)_root->FindAttribute(SALOMEDSImpl_AttributeInteger::GetID()))) {
+  if(!(anInteger=(SALOMEDSImpl_AttributeInteger*)_root->FindAttribute(DF_Attribute::TypeIndexOf<SALOMEDSImpl_AttributeInteger>()))) {
     anInteger = SALOMEDSImpl_AttributeInteger::Set(aLabel, 0);
   }    
 
@@ -27,12 +27,17 @@
 #include <string>
 #include <vector>
 #include <cstdlib>
+#include <cstdio>
+#include <algorithm>
 #include "utilities.h"
 
 #include "SALOMEDSImpl_AttributeParameter.hxx"
 #include "SALOMEDSImpl_Study.hxx"
 #include "SALOMEDSImpl_StudyBuilder.hxx"
 #include "SALOMEDSImpl_GenericAttribute.hxx"
+#include "SALOMEDSImpl_Driver.hxx"
+#include "SALOMEDSImpl_SComponent.hxx"
+#include "Basics_DirUtils.hxx"
 
 
 // ============================================================================
@@ -117,5 +122,172 @@ void SALOMEDSImplTest::testAttributeParameter()
 
 }
 
+namespace
+{
+  // Byte of the test stream of a component at a given offset
+  unsigned char StreamByte(const std::string& theType, long theOffset)
+  {
+    return (unsigned char)(theType.size() + theOffset * 31 + theOffset / 4099);
+  }
+
+  struct TestTMPFile : public SALOMEDSImpl_TMPFile
+  {
+    TestTMPFile(const std::vector<unsigned char>& theData) : myData(theData) {}
+    virtual size_t Size() { return myData.size(); }
+    virtual TOctet& Get(size_t theIndex) { return myData[theIndex]; }
+    std::vector<unsigned char> myData;
+  };
+
+  // Engine whose stream is theLength bytes long : sent by chunks of theChunkLength bytes without announcing
+  // its length if theChunkLength > 0, returned in one piece by Save() otherwise. Load() keeps what it is given.
+  class TestDriver : public SALOMEDSImpl_Driver
+  {
+  public:
+    TestDriver(const std::string& theType, long theLength, long theChunkLength)
+      : myType(theType), myLength(theLength), myChunkLength(theChunkLength) {}
+
+    virtual std::string GetIOR() { return "IOR:" + myType; }
+
+    virtual SALOMEDSImpl_TMPFile* Save(const SALOMEDSImpl_SComponent&, const std::string&, long& theStreamLength, bool)
+    {
+      std::vector<unsigned char> aData(myLength);
+      for (long i = 0; i < myLength; i++) aData[i] = StreamByte(myType, i);
+      theStreamLength = myLength;
+      return new TestTMPFile(aData);
+    }
+    virtual SALOMEDSImpl_TMPFile* SaveASCII(const SALOMEDSImpl_SComponent& theComponent, const std::string& theURL,
+                                            long& theStreamLength, bool isMultiFile)
+    {
+      return Save(theComponent, theURL, theStreamLength, isMultiFile);
+    }
+    virtual void SaveByChunks(const SALOMEDSImpl_SComponent& theComponent, const std::string& theURL,
+                              bool isMultiFile, bool isASCII, SALOMEDSImpl_ChunkWriter& theWriter)
+    {
+      if (myChunkLength <= 0) {
+        SALOMEDSImpl_Driver::SaveByChunks(theComponent, theURL, isMultiFile, isASCII, theWriter);
+        return;
+      }
+      std::vector<unsigned char> aChunk(myChunkLength);
+      theWriter.Open(-1);
+      for (long anOffset = 0; anOffset < myLength; anOffset += myChunkLength) {
+        long aLength = std::min(myChunkLength, myLength - anOffset);
+        for (long i = 0; i < aLength; i++) aChunk[i] = StreamByte(myType, anOffset + i);
+        theWriter.WriteChunk(&aChunk[0], aLength);
+      }
+      theWriter.Close();
+    }
+    virtual bool Load(const SALOMEDSImpl_SComponent&, const unsigned char* theStream, const long theStreamLength,
+                      const std::string&, bool)
+    {
+      myLoaded.assign(theStream, theStream + theStreamLength);
+      return true;
+    }
+    virtual bool LoadASCII(const SALOMEDSImpl_SComponent& theComponent, const unsigned char* theStream,
+                           const long theStreamLength, const std::string& theURL, bool isMultiFile)
+    {
+      return Load(theComponent, theStream, theStreamLength, theURL, isMultiFile);
+    }
+    virtual void Close(const SALOMEDSImpl_SComponent&) {}
+    virtual std::string ComponentDataType() { return myType; }
+    virtual std::string Version() { return "1.0"; }
+    virtual std::string IORToLocalPersistentID(const SALOMEDSImpl_SObject&, const std::string& IORString, bool, bool)
+    {
+      return IORString;
+    }
+    virtual std::string LocalPersistentIDToIOR(const SALOMEDSImpl_SObject&, const std::string& aLocalPersistentID,
+                                               bool, bool)
+    {
+      return aLocalPersistentID;
+    }
+    virtual bool CanCopy(const SALOMEDSImpl_SObject&) { return false; }
+    virtual SALOMEDSImpl_TMPFile* CopyFrom(const SALOMEDSImpl_SObject&, int&, long&) { return 0; }
+    virtual bool CanPaste(const std::string&, int) { return false; }
+    virtual std::string PasteInto(const unsigned char*, const long, int, const SALOMEDSImpl_SObject&) { return ""; }
+    virtual SALOMEDSImpl_TMPFile* DumpPython(bool, bool, bool&, long&) { return 0; }
+
+    // Returns true if the stream given to Load() is the one saved
+    bool IsLoaded() const
+    {
+      if ((long)myLoaded.size() != myLength) return false;
+      for (long i = 0; i < myLength; i++)
+        if (myLoaded[i] != StreamByte(myType, i)) return false;
+      return true;
+    }
 
+  private:
+    std::string                myType;
+    long                       myLength;
+    long                       myChunkLength;
+    std::vector<unsigned char> myLoaded;
+  };
 
+  // The study deletes the drivers it gets once it is saved
+  class TestDriverFactory : public SALOMEDSImpl_DriverFactory
+  {
+  public:
+    TestDriverFactory(long theChunkLength, bool isConcurrent)
+      : myChunkLength(theChunkLength), myConcurrent(isConcurrent) {}
+
+    virtual SALOMEDSImpl_Driver* GetDriverByType(const std::string& theComponentType)
+    {
+      // CHUNKED : 2.5 MB sent by chunks, i.e. more than one chunk of the dataset; ONEPIECE : 300 kB saved at once
+      if (theComponentType == "CHUNKED") return new TestDriver(theComponentType, 2500000, myChunkLength);
+      if (theComponentType == "ONEPIECE") return new TestDriver(theComponentType, 300000, 0);
+      return 0;
+    }
+    virtual SALOMEDSImpl_Driver* GetDriverByIOR(const std::string& theIOR)
+    {
+      return GetDriverByType(theIOR.substr(4));
+    }
+    virtual bool CanSaveConcurrently() { return myConcurrent; }
+
+  private:
+    long myChunkLength;
+    bool myConcurrent;
+  };
+}
+
+// ============================================================================
+/*!
+ * Check that the data of the components are read back as saved, by chunks or in one piece
+ */
+// ============================================================================
+void SALOMEDSImplTest::testChunkedSave()
+{
+  std::string aDir = Kernel_Utils::GetTmpDir();
+  for (int aConcurrent = 0; aConcurrent < 2; aConcurrent++) {
+    // chunks smaller, then larger, than the chunks of the dataset
+    long aChunkLength = aConcurrent ? 3000000 : 65537;
+    std::string aFile = aDir + "testChunkedSave.hdf";
+
+    {
+      SALOMEDSImpl_Study study;
+      SALOMEDSImpl_StudyBuilder* builder = study.NewBuilder();
+      const char* aTypes[] = { "CHUNKED", "ONEPIECE" };
+      for (int i = 0; i < 2; i++) {
+        SALOMEDSImpl_SComponent sco = builder->NewComponent(aTypes[i]);
+        CPPUNIT_ASSERT(builder->DefineComponentInstance(sco, std::string("IOR:") + aTypes[i]));
+      }
+      TestDriverFactory aFactory(aChunkLength, aConcurrent != 0);
+      CPPUNIT_ASSERT(study.SaveAs(aFile, &aFactory, false, false));
+      study.Clear();
+    }
+
+    SALOMEDSImpl_Study study;
+    CPPUNIT_ASSERT(study.Open(aFile));
+    SALOMEDSImpl_StudyBuilder* builder = study.NewBuilder();
+
+    TestDriver aChunked("CHUNKED", 2500000, aChunkLength);
+    SALOMEDSImpl_SComponent sco = study.FindComponent("CHUNKED");
+    CPPUNIT_ASSERT(builder->LoadWith(sco, &aChunked));
+    CPPUNIT_ASSERT(aChunked.IsLoaded());
+
+    TestDriver anOnePiece("ONEPIECE", 300000, 0);
+    sco = study.FindComponent("ONEPIECE");
+    CPPUNIT_ASSERT(builder->LoadWith(sco, &anOnePiece));
+    CPPUNIT_ASSERT(anOnePiece.IsLoaded());
+
+    study.Clear();
+    remove(aFile.c_str());
+  }
+}
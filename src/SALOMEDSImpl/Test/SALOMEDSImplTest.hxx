@@ -39,6 +39,7 @@ class SALOMEDSIMPLTEST_EXPORT SALOMEDSImplTest : public CppUnit::TestFixture
 {
   CPPUNIT_TEST_SUITE( SALOMEDSImplTest );
   CPPUNIT_TEST( testAttributeParameter );
+  CPPUNIT_TEST( testChunkedSave );
   CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -46,6 +47,7 @@ public:
   void setUp();
   void tearDown();
   void testAttributeParameter();
+  void testChunkedSave();
 };
 
 #endif
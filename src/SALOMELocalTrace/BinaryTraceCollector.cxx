@@ -0,0 +1,244 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  File   : BinaryTraceCollector.cxx
+//  Module : KERNEL
+//
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <chrono>
+
+//#define _DEVDEBUG_
+#include "BinaryTraceCollector.hxx"
+#include "BinaryTraceRecord.hxx"
+
+// Class attributes initialisation, for class method BinaryTraceCollector::run
+
+std::string BinaryTraceCollector::_fileName = "";
+
+namespace
+{
+  template<class T> void write(std::ofstream& file, const T& value)
+  {
+    file.write((const char*)&value, sizeof(value));
+  }
+
+  void writeString(std::ofstream& file, const std::string& value)
+  {
+    write(file, (unsigned int)value.size());
+    file.write(value.c_str(), value.size());
+  }
+}
+
+// ============================================================================
+/*!
+ *  This class is for use without CORBA, inside or outside SALOME.
+ *  Type of trace (and corresponding class) is chosen in LocalTraceBufferPool.
+ *
+ *  Guarantees a unique object instance of the class (singleton thread safe)
+ *  a separate thread for loop to write traces is launched.
+ */
+// ============================================================================
+
+BaseTraceCollector* BinaryTraceCollector::instance(const char *fileName)
+{
+  if (_singleton == 0) // no need of lock when singleton already exists
+    {
+      pthread_mutex_lock(&_singletonMutex);    // acquire lock to be alone
+      if (_singleton == 0)                     // another thread may have got
+        {                                      // the lock after the first test
+          DEVTRACE("BinaryTraceCollector:: instance()");
+          BaseTraceCollector* myInstance = new BinaryTraceCollector();
+          _fileName = fileName;
+
+          sem_init(&_sem,0,0); // to wait until run thread is initialized
+          pthread_t traceThread;
+          int bid = 0;
+          pthread_create(&traceThread, NULL,
+                                   BinaryTraceCollector::run, &bid);
+          sem_wait(&_sem);
+          _singleton = myInstance; // _singleton known only when init done
+          DEVTRACE("BinaryTraceCollector:: instance()-end");
+        }
+      pthread_mutex_unlock(&_singletonMutex); // release lock
+    }
+  return _singleton;
+}
+
+// ============================================================================
+/*!
+ *  In a separate thread, loop to write traces.
+ *  File layout: BINARY_TRACE_MAGIC, BINARY_TRACE_VERSION (int), then records
+ *  - 'S' format site: int id, int line, file and format (unsigned int size
+ *    and chars), written before the first message of the site,
+ *  - 'M' message: int traceType, unsigned long long thread id, unsigned int
+ *    length and bytes (binary record of BinaryTraceRecord.hxx if traceType is
+ *    BINARY_MESS, text otherwise).
+ *  The file is truncated at opening: one process per file.
+ *  Flushed as FileTraceCollector does. If type = ABORT then exit application
+ *  with message.
+ */
+// ============================================================================
+
+void* BinaryTraceCollector::run(void* /*bid*/)
+{
+  _threadId = new pthread_t;
+  *_threadId = pthread_self();
+  sem_post(&_sem); // unlock instance
+
+  LocalTraceBufferPool* myTraceBuffer = LocalTraceBufferPool::instance();
+  LocalTrace_TraceInfo myTrace;
+
+  std::ofstream traceFile;
+  std::vector<char> writeBuffer(TRACE_FLUSH_SIZE);
+  traceFile.rdbuf()->pubsetbuf(&writeBuffer[0], writeBuffer.size());
+  const char *theFileName = _fileName.c_str();
+  DEVTRACE("try to open trace file "<< theFileName);
+  traceFile.open(theFileName, std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!traceFile)
+    {
+      std::cerr << "impossible to open trace file "<< theFileName << std::endl;
+      exit (1);
+    }
+  traceFile.write(BINARY_TRACE_MAGIC, strlen(BINARY_TRACE_MAGIC));
+  write(traceFile, (int)BINARY_TRACE_VERSION);
+
+  int nbSitesWritten = 0;
+  bool toFlush = false;
+  std::chrono::steady_clock::time_point firstToFlush;
+  while ((!_threadToClose) || myTraceBuffer->toCollect() )
+    {
+      int timeout = -1; // wait for the next message if everything is flushed
+      if (toFlush)
+        {
+          long long elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+            (std::chrono::steady_clock::now() - firstToFlush).count();
+          timeout = elapsed < TRACE_FLUSH_DELAY ? (int)(TRACE_FLUSH_DELAY - elapsed) : 0;
+        }
+      if (myTraceBuffer->retrieve(myTrace, timeout) < 0)
+        {
+          traceFile.flush();
+          toFlush = false;
+          continue;
+        }
+
+      // --- sites registered since the last message
+
+      if (myTrace.traceType == BINARY_MESS)
+        {
+          int siteId;
+          memcpy(&siteId, myTrace.trace, sizeof(siteId));
+          for (; nbSitesWritten <= siteId; nbSitesWritten++)
+            {
+              const BinaryTraceSite* aSite = BinaryTraceRecord::site(nbSitesWritten);
+              if (!aSite)
+                break;
+              traceFile.put('S');
+              write(traceFile, nbSitesWritten);
+              write(traceFile, aSite->line);
+              writeString(traceFile, aSite->file);
+              writeString(traceFile, aSite->format);
+            }
+        }
+
+#ifndef WIN32
+      unsigned long long threadId = (unsigned long long)myTrace.threadId;
+#else
+      unsigned long long threadId = (unsigned long long)(size_t)(&myTrace.threadId);
+#endif
+      traceFile.put('M');
+      write(traceFile, myTrace.traceType);
+      write(traceFile, threadId);
+      write(traceFile, myTrace.length);
+      traceFile.write(myTrace.trace, myTrace.length);
+
+      if (myTrace.traceType == ABORT_MESS)
+        {
+          traceFile.close();
+          std::cout << std::flush ;
+#ifndef WIN32
+          std::cerr << "INTERRUPTION from thread " << myTrace.threadId
+               << " : " <<  myTrace.trace;
+#else
+          std::cerr << "INTERRUPTION from thread " << (void*)(&myTrace.threadId)
+               << " : " <<  myTrace.trace;
+#endif
+          std::cerr << std::flush ; 
+          exit(1);     
+        }
+      if (!toFlush)
+        {
+          toFlush = true;
+          firstToFlush = std::chrono::steady_clock::now();
+        }
+      else if (std::chrono::steady_clock::now() - firstToFlush >=
+               std::chrono::milliseconds(TRACE_FLUSH_DELAY))
+        {
+          traceFile.flush();
+          toFlush = false;
+        }
+    }
+  traceFile.close();
+  pthread_exit(NULL);
+}
+
+// ============================================================================
+/*!
+ *  Destructor: wait until writing thread ends (BinaryTraceCollector::run)
+ */
+// ============================================================================
+
+BinaryTraceCollector:: ~BinaryTraceCollector()
+{
+  pthread_mutex_lock(&_singletonMutex); // acquire lock to be alone
+  if (_singleton)
+    {
+      DEVTRACE("BinaryTraceCollector:: ~BinaryTraceCollector()");
+      LocalTraceBufferPool* myTraceBuffer = LocalTraceBufferPool::instance();
+      _threadToClose = 1;
+      myTraceBuffer->insert(NORMAL_MESS,"end of trace\n"); // to wake up thread
+      if (_threadId)
+        {
+          int ret = pthread_join(*_threadId, NULL);
+          if (ret) { std::cerr << "error close BinaryTraceCollector : "<< ret << std::endl; }
+          else { DEVTRACE("BinaryTraceCollector destruction OK"); }
+          delete _threadId;
+          _threadId = 0;
+          _threadToClose = 0;
+        }
+      _singleton = 0;
+    }
+  pthread_mutex_unlock(&_singletonMutex); // release lock
+}
+
+// ============================================================================
+/*!
+ * Constructor: no need of LocalTraceBufferPool object initialization here,
+ * thread safe singleton used in LocalTraceBufferPool::instance()
+ */
+// ============================================================================
+
+BinaryTraceCollector::BinaryTraceCollector()
+{
+  _threadId=0;
+  _threadToClose = 0;
+}
@@ -0,0 +1,330 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  File   : BinaryTraceRecord.cxx
+//  Module : KERNEL
+//
+#include "BinaryTraceRecord.hxx"
+
+#include <cstring>
+#include <cstdio>
+#include <deque>
+#include <chrono>
+#include <pthread.h>
+
+namespace
+{
+  // format sites, never removed: pointers given by site() stay valid
+  std::deque<BinaryTraceSite> theSites;
+  pthread_mutex_t theSitesMutex = PTHREAD_MUTEX_INITIALIZER;
+}
+
+// ============================================================================
+/*!
+ *  Registers a format site (once per BTRACE macro, in a function static),
+ *  returns its id.
+ */
+// ============================================================================
+
+int BinaryTraceRecord::registerSite(const char* file, int line, const char* format)
+{
+  BinaryTraceSite aSite;
+  aSite.file = file;
+  aSite.line = line;
+  aSite.format = format;
+  pthread_mutex_lock(&theSitesMutex);
+  int siteId = (int)theSites.size();
+  theSites.push_back(aSite);
+  pthread_mutex_unlock(&theSitesMutex);
+  return siteId;
+}
+
+// ============================================================================
+/*!
+ *  Gives the format site of given id, 0 if unknown
+ */
+// ============================================================================
+
+const BinaryTraceSite* BinaryTraceRecord::site(int siteId)
+{
+  const BinaryTraceSite* aSite = 0;
+  pthread_mutex_lock(&theSitesMutex);
+  if (siteId >= 0 && siteId < (int)theSites.size())
+    aSite = &theSites[siteId];
+  pthread_mutex_unlock(&theSitesMutex);
+  return aSite;
+}
+
+int BinaryTraceRecord::nbSites()
+{
+  pthread_mutex_lock(&theSitesMutex);
+  int nb = (int)theSites.size();
+  pthread_mutex_unlock(&theSitesMutex);
+  return nb;
+}
+
+// ============================================================================
+/*!
+ *  Formats a binary record (layout in BinaryTraceRecord.hxx) as INFOS does:
+ *  "- Trace file [line] : message\n". Arguments replace the "{}" of the
+ *  format, in order. Gives the timestamp of the record if asked.
+ */
+// ============================================================================
+
+std::string BinaryTraceRecord::toText(const BinaryTraceSite& site,
+                                      const char* data, unsigned int length,
+                                      unsigned long long* timestamp)
+{
+  char number[32];
+  std::string text = "- Trace ";
+  text += site.file;
+  snprintf(number, sizeof(number), " [%d] : ", site.line);
+  text += number;
+
+  unsigned int pos = sizeof(int) + sizeof(unsigned long long);
+  if (timestamp && length >= pos)
+    memcpy(timestamp, data + sizeof(int), sizeof(unsigned long long));
+
+  const char* format = site.format.c_str();
+  while (*format)
+    {
+      if (format[0] != '{' || format[1] != '}')
+        {
+          text += *format++;
+          continue;
+        }
+      format += 2;
+      if (pos >= length)
+        continue; // missing argument: the record was truncated
+      char tag = data[pos++];
+      unsigned int size = (tag == 'c') ? 1 : (tag == 's') ? sizeof(unsigned short)
+                                                          : sizeof(unsigned long long);
+      if (pos + size > length)
+        {
+          pos = length;  // corrupted record
+          continue;
+        }
+      switch (tag)
+        {
+        case 'i':
+          {
+            long long value;
+            memcpy(&value, data + pos, sizeof(value));
+            snprintf(number, sizeof(number), "%lld", value);
+            text += number;
+            pos += sizeof(value);
+            break;
+          }
+        case 'u':
+          {
+            unsigned long long value;
+            memcpy(&value, data + pos, sizeof(value));
+            snprintf(number, sizeof(number), "%llu", value);
+            text += number;
+            pos += sizeof(value);
+            break;
+          }
+        case 'd':
+          {
+            double value;
+            memcpy(&value, data + pos, sizeof(value));
+            snprintf(number, sizeof(number), "%g", value); // as ostream
+            text += number;
+            pos += sizeof(value);
+            break;
+          }
+        case 'c':
+          text += data[pos++];
+          break;
+        case 'p':
+          {
+            unsigned long long value;
+            memcpy(&value, data + pos, sizeof(value));
+            if (value)
+              snprintf(number, sizeof(number), "%p", (void*)(size_t)value);
+            else
+              strcpy(number, "0");
+            text += number;
+            pos += sizeof(value);
+            break;
+          }
+        case 's':
+          {
+            unsigned short stringSize;
+            memcpy(&stringSize, data + pos, sizeof(stringSize));
+            pos += sizeof(stringSize);
+            if (pos + stringSize > length)
+              stringSize = (unsigned short)(length - pos);
+            text.append(data + pos, stringSize);
+            pos += stringSize;
+            break;
+          }
+        default:
+          pos = length;
+        }
+    }
+  text += '\n';
+  return text;
+}
+
+// ============================================================================
+/*!
+ *  Called by collectors: replaces a binary record by its text, as a normal
+ *  message. Returns false if aTrace is not a binary record.
+ */
+// ============================================================================
+
+bool BinaryTraceRecord::toText(LocalTrace_TraceInfo& aTrace)
+{
+  if (aTrace.traceType != BINARY_MESS)
+    return false;
+  int siteId;
+  memcpy(&siteId, aTrace.trace, sizeof(siteId));
+  const BinaryTraceSite* aSite = site(siteId);
+  std::string text = aSite ? toText(*aSite, aTrace.trace, aTrace.length)
+                           : std::string("- Trace unknown BTRACE site\n");
+  if (text.size() > MAX_TRACE_LENGTH-1)
+    text.resize(MAX_TRACE_LENGTH-1);
+  memcpy(aTrace.trace, text.c_str(), text.size() + 1);
+  aTrace.length = (unsigned int)text.size();
+  aTrace.traceType = NORMAL_MESS;
+  return true;
+}
+
+// ============================================================================
+/*!
+ *  Starts a record: site id and timestamp
+ */
+// ============================================================================
+
+BinaryTraceRecord::BinaryTraceRecord(int siteId)
+{
+  _siteId = siteId;
+  unsigned long long timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>
+    (std::chrono::system_clock::now().time_since_epoch()).count();
+  memcpy(_data, &siteId, sizeof(siteId));
+  memcpy(_data + sizeof(siteId), &timestamp, sizeof(timestamp));
+  _length = sizeof(siteId) + sizeof(timestamp);
+}
+
+// ============================================================================
+/*!
+ *  Arguments: a type tag and the raw value. Arguments not fitting in the
+ *  record are ignored, strings are truncated.
+ */
+// ============================================================================
+
+bool BinaryTraceRecord::reserve(unsigned int size)
+{
+  return _length + 1 + size <= sizeof(_data);
+}
+
+void BinaryTraceRecord::addSigned(long long value)
+{
+  if (!reserve(sizeof(value)))
+    return;
+  _data[_length++] = 'i';
+  memcpy(_data + _length, &value, sizeof(value));
+  _length += sizeof(value);
+}
+
+void BinaryTraceRecord::addUnsigned(unsigned long long value)
+{
+  if (!reserve(sizeof(value)))
+    return;
+  _data[_length++] = 'u';
+  memcpy(_data + _length, &value, sizeof(value));
+  _length += sizeof(value);
+}
+
+void BinaryTraceRecord::add(char value)
+{
+  if (!reserve(sizeof(value)))
+    return;
+  _data[_length++] = 'c';
+  _data[_length++] = value;
+}
+
+void BinaryTraceRecord::add(double value)
+{
+  if (!reserve(sizeof(value)))
+    return;
+  _data[_length++] = 'd';
+  memcpy(_data + _length, &value, sizeof(value));
+  _length += sizeof(value);
+}
+
+void BinaryTraceRecord::add(const void* value)
+{
+  unsigned long long address = (unsigned long long)(size_t)value;
+  if (!reserve(sizeof(address)))
+    return;
+  _data[_length++] = 'p';
+  memcpy(_data + _length, &address, sizeof(address));
+  _length += sizeof(address);
+}
+
+void BinaryTraceRecord::add(const char* value)
+{
+  if (value)
+    addString(value, strlen(value));
+  else
+    addString("(null)", 6);
+}
+
+void BinaryTraceRecord::add(const std::string& value)
+{
+  addString(value.c_str(), value.size());
+}
+
+void BinaryTraceRecord::addString(const char* value, size_t length)
+{
+  unsigned short size = sizeof(unsigned short);
+  if (!reserve(size))
+    return;
+  size_t available = sizeof(_data) - _length - 1 - size;
+  if (length > available)
+    length = available;
+  unsigned short stringSize = (unsigned short)length;
+  _data[_length++] = 's';
+  memcpy(_data + _length, &stringSize, size);
+  _length += size;
+  memcpy(_data + _length, value, length);
+  _length += stringSize;
+}
+
+// ============================================================================
+/*!
+ *  Inserts the record in the trace ring. If the collector does not know
+ *  binary records, the text is built here.
+ */
+// ============================================================================
+
+void BinaryTraceRecord::send()
+{
+  LocalTraceBufferPool* pool = LocalTraceBufferPool::instance();
+  if (pool->binaryRecords())
+    pool->insert(BINARY_MESS, _data, _length);
+  else
+    {
+      const BinaryTraceSite* aSite = site(_siteId);
+      if (aSite)
+        pool->insert(NORMAL_MESS, toText(*aSite, _data, _length).c_str());
+    }
+}
@@ -0,0 +1,126 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  File   : BinaryTraceRecord.hxx
+//  Module : KERNEL
+//
+#ifndef _BINARYTRACERECORD_HXX_
+#define _BINARYTRACERECORD_HXX_
+
+#include "SALOME_LocalTrace.hxx"
+#include "LocalTraceBufferPool.hxx"
+
+#include <string>
+
+// Binary trace records (BTRACE macro in utilities.h): the producer only
+// copies a format site id, a timestamp and the raw arguments in the trace
+// ring, text is built later by the collector thread, or offline by
+// SALOME_TraceDecoder from a "binary" trace file.
+//
+// Record layout (native byte order):
+//   int siteId, unsigned long long timestamp (ns since epoch),
+//   then for each argument a type tag and its value:
+//   'i' long long, 'u' unsigned long long, 'd' double, 'c' char,
+//   'p' pointer (unsigned long long), 's' unsigned short length + chars.
+
+#define BINARY_TRACE_MAGIC "SALOMEBT"  // binary trace file header
+#define BINARY_TRACE_VERSION 1
+
+//! Format site of a BTRACE macro, "{}" in format are replaced by arguments
+
+struct SALOMELOCALTRACE_EXPORT BinaryTraceSite
+{
+  std::string file;
+  int line;
+  std::string format;
+};
+
+class SALOMELOCALTRACE_EXPORT BinaryTraceRecord
+{
+ public:
+  static int registerSite(const char* file, int line, const char* format);
+  static const BinaryTraceSite* site(int siteId);
+  static int nbSites();
+
+  static std::string toText(const BinaryTraceSite& site,
+                            const char* data, unsigned int length,
+                            unsigned long long* timestamp = 0);
+  static bool toText(LocalTrace_TraceInfo& aTrace);
+
+  explicit BinaryTraceRecord(int siteId);
+
+  void add(bool value)               { addSigned(value); }
+  void add(char value);
+  void add(signed char value)        { addSigned(value); }
+  void add(unsigned char value)      { addUnsigned(value); }
+  void add(short value)              { addSigned(value); }
+  void add(unsigned short value)     { addUnsigned(value); }
+  void add(int value)                { addSigned(value); }
+  void add(unsigned int value)       { addUnsigned(value); }
+  void add(long value)               { addSigned(value); }
+  void add(unsigned long value)      { addUnsigned(value); }
+  void add(long long value)          { addSigned(value); }
+  void add(unsigned long long value) { addUnsigned(value); }
+  void add(float value)              { add((double)value); }
+  void add(double value);
+  void add(const char* value);
+  void add(const std::string& value);
+  void add(const void* value);
+
+  void send();
+
+ private:
+  void addSigned(long long value);
+  void addUnsigned(unsigned long long value);
+  void addString(const char* value, size_t length);
+  bool reserve(unsigned int size);
+
+  int _siteId;
+  unsigned int _length;
+  char _data[MAX_TRACE_LENGTH-1];
+};
+
+// --- helpers of BTRACE macro
+
+template<class... Args>
+inline const char* BinaryTrace_Format(const char* format, const Args&...)
+{
+  return format;
+}
+
+inline void BinaryTrace_Args(BinaryTraceRecord&)
+{
+}
+
+template<class T, class... Args>
+inline void BinaryTrace_Args(BinaryTraceRecord& record, const T& value, const Args&... args)
+{
+  record.add(value);
+  BinaryTrace_Args(record, args...);
+}
+
+template<class... Args>
+inline void BinaryTrace_Send(int siteId, const char*, const Args&... args)
+{
+  BinaryTraceRecord record(siteId);
+  BinaryTrace_Args(record, args...);
+  record.send();
+}
+
+#endif
@@ -29,9 +29,12 @@
 #include <sstream>
 #include <fstream>
 #include <cstdlib>
+#include <vector>
+#include <chrono>
 
 //#define _DEVDEBUG_
 #include "FileTraceCollector.hxx"
+#include "BinaryTraceRecord.hxx"
 
 // Class attributes initialisation, for class method FileTraceCollector::run
 
@@ -82,6 +85,9 @@ BaseTraceCollector* FileTraceCollector::instance(const char *fileName)
  *  Loop until there is no more buffer to print,
  *  and no ask for end from destructor.
  *  Get a buffer. If type = ABORT then exit application with message.
+ *  Messages are written in a TRACE_FLUSH_SIZE buffer, the file is flushed
+ *  when the buffer is full, or TRACE_FLUSH_DELAY ms after the first message
+ *  not yet flushed, or when there is nothing more to print.
  */
 // ============================================================================
 
@@ -99,6 +105,8 @@ void* FileTraceCollector::run(void* /*bid*/)
   //     so, several processes can share the same file
 
   std::ofstream traceFile;
+  std::vector<char> writeBuffer(TRACE_FLUSH_SIZE);
+  traceFile.rdbuf()->pubsetbuf(&writeBuffer[0], writeBuffer.size());
   const char *theFileName = _fileName.c_str();
   DEVTRACE("try to open trace file "<< theFileName);
   traceFile.open(theFileName, std::ios::out | std::ios::app);
@@ -111,6 +119,8 @@ void* FileTraceCollector::run(void* /*bid*/)
   // --- Loop until there is no more buffer to print,
   //     and no ask for end from destructor.
   DEVTRACE("Begin loop");
+  bool toFlush = false;
+  std::chrono::steady_clock::time_point firstToFlush;
   while ((!_threadToClose) || myTraceBuffer->toCollect() )
     {
       if (_threadToClose)
@@ -119,7 +129,20 @@ void* FileTraceCollector::run(void* /*bid*/)
           //break;
         }
 
-      myTraceBuffer->retrieve(myTrace);
+      int timeout = -1; // wait for the next message if everything is flushed
+      if (toFlush)
+        {
+          long long elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+            (std::chrono::steady_clock::now() - firstToFlush).count();
+          timeout = elapsed < TRACE_FLUSH_DELAY ? (int)(TRACE_FLUSH_DELAY - elapsed) : 0;
+        }
+      if (myTraceBuffer->retrieve(myTrace, timeout) < 0)
+        {
+          traceFile.flush();
+          toFlush = false;
+          continue;
+        }
+      BinaryTraceRecord::toText(myTrace); // deferred formatting of BTRACE
       if (myTrace.traceType == ABORT_MESS)
         {
 #ifndef WIN32
@@ -151,6 +174,17 @@ void* FileTraceCollector::run(void* /*bid*/)
           traceFile << "th. " << (void*)(&myTrace.threadId)
                     << " " << myTrace.trace;
 #endif
+          if (!toFlush)
+            {
+              toFlush = true;
+              firstToFlush = std::chrono::steady_clock::now();
+            }
+          else if (std::chrono::steady_clock::now() - firstToFlush >=
+                   std::chrono::milliseconds(TRACE_FLUSH_DELAY))
+            {
+              traceFile.flush();
+              toFlush = false;
+            }
         }
     }
   DEVTRACE("traceFile.close()");
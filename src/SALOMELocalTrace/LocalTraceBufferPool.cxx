@@ -30,6 +30,8 @@
 #include <cassert>
 #include <string.h>
 #include <cstdio>
+#include <thread>
+#include <chrono>
 
 #ifndef WIN32
 #include <dlfcn.h>
@@ -42,13 +44,27 @@
 #include "BaseTraceCollector.hxx"
 #include "LocalTraceCollector.hxx"
 #include "FileTraceCollector.hxx"
+#include "BinaryTraceCollector.hxx"
 #include "utilities.h"
 
 // In case of truncated message, end of trace contains "...\n\0"
 
 #define TRUNCATED_MESSAGE "...\n"
+#define TRUNCATED_LENGTH 4
 #define MAXMESS_LENGTH MAX_TRACE_LENGTH-5
 
+// _head and _tail: slot ticket in high 32 bits, arena byte counter in low
+// 32 bits (both wrap around, TRACE_BUFFER_SIZE and TRACE_ARENA_SIZE divide 2^32)
+
+#define PACK(ticket,bytes) (((unsigned long long)(ticket) << 32) | (unsigned int)(bytes))
+#define TICKET(pos) ((unsigned int)((pos) >> 32))
+#define BYTES(pos) ((unsigned int)(pos))
+
+// slot sequence: ticket when free for ticket, ticket+1 when published,
+// CLAIMED(ticket) while the collector copies it or a producer drops it
+
+#define CLAIMED(ticket) ((ticket) + 2)
+
 // Class static attributes initialisation
 
 LocalTraceBufferPool* LocalTraceBufferPool::_singleton = 0;
@@ -69,6 +85,9 @@ BaseTraceCollector *LocalTraceBufferPool::_myThreadTrace = 0;
  *  - "local" implies standard err trace, LocalTraceCollector is launched.
  *  - "file" implies trace in /tmp/tracetest.log
  *  - "file:pathname" implies trace in file pathname
+ *  - "binary" implies binary trace in /tmp/tracetest.bin
+ *  - "binary:pathname" implies binary trace in file pathname, to read with
+ *    SALOME_TraceDecoder
  *  - anything else like "other" : try to load dynamically a library named
  *    otherTraceCollector, and invoque C method instance() to start a singleton
  *    instance of the trace collector. Example: with_loggerTraceCollector, for
@@ -107,6 +126,16 @@ LocalTraceBufferPool* LocalTraceBufferPool::instance()
               
               _myThreadTrace = FileTraceCollector::instance(fileName);
             }
+          else if (strncmp(traceKind,"binary",strlen("binary"))==0)
+            {
+              const char *fileName;
+              if (strlen(traceKind) > strlen("binary"))
+                fileName = &traceKind[strlen("binary")+1];
+              else
+                fileName = "/tmp/tracetest.bin";
+
+              _myThreadTrace = BinaryTraceCollector::instance(fileName);
+            }
           else // --- try a dynamic library
             {
 #ifndef WIN32
@@ -150,6 +179,17 @@ LocalTraceBufferPool* LocalTraceBufferPool::instance()
                   exit(1);        // in case assert is deactivated
                 }             
             }
+          // --- BTRACE records are formatted by built-in collectors only
+
+          const char* binaryTrace = getenv("SALOME_trace_binary");
+          if (binaryTrace)
+            myInstance->_binaryRecords = strcmp(binaryTrace,"0")!=0;
+          else
+            myInstance->_binaryRecords = !traceKind ||
+              strcmp(traceKind,"local")==0 ||
+              strncmp(traceKind,"file",strlen("file"))==0 ||
+              strncmp(traceKind,"binary",strlen("binary"))==0 ||
+              strcmp(traceKind,"with_logger")==0;
           DEVTRACE("New buffer pool: end");
         }
       pthread_mutex_unlock(&_singletonMutex); // release lock
@@ -160,138 +200,331 @@ LocalTraceBufferPool* LocalTraceBufferPool::instance()
 // ============================================================================
 /*!
  *  Called by trace producers within their threads. The trace message is copied
- *  in specific buffer from a circular pool of buffers.
- *  Waits until there is a free buffer in the pool, gets the first available
- *  buffer, fills it with the message.
+ *  in the byte arena, and described by a slot of the circular pool of slots.
+ *  Producers do not lock: a compare and swap on _head reserves at once the
+ *  next slot ticket and the arena bytes of the message (text is contiguous,
+ *  the end of the arena is skipped when the message does not fit).
+ *  When the slot is filled, its sequence number is published (ticket + 1).
+ *  When the ring is full, the overflow policy applies: wait for the collector,
+ *  drop the oldest message not yet printed, or drop the new message.
+ *  Abort messages are never dropped.
  *  Messages are printed in a separate thread (see retrieve method)
+ *  Returns the number of free slots, or -1 if the message was dropped.
  */
 // ============================================================================
 
 int LocalTraceBufferPool::insert(int traceType, const char* msg)
 {
+  // message length, truncated if too long (last chars always "...\n")
 
-  // get immediately a message number to control sequence (mutex protected)
+  const char* msgEnd = (const char*)memchr(msg, 0, MAXMESS_LENGTH);
+  unsigned int length = msgEnd ? (unsigned int)(msgEnd - msg) : MAXMESS_LENGTH;
+  return insert(traceType, msg, length, !msgEnd);
+}
 
-  unsigned long myMessageNumber = lockedIncrement(_position);
+// ============================================================================
+/*!
+ *  Same as above, for a record of given length which may contain '\0'
+ *  (binary records of BTRACE macros). Truncated at MAX_TRACE_LENGTH-1 bytes.
+ */
+// ============================================================================
 
-  // wait until there is a free buffer in the pool
+int LocalTraceBufferPool::insert(int traceType, const char* data,
+                                 unsigned int length)
+{
+  if (length > MAX_TRACE_LENGTH-1)
+    length = MAX_TRACE_LENGTH-1;
+  return insert(traceType, data, length, false);
+}
 
-#ifdef __APPLE__
-  dispatch_semaphore_wait(_freeBufferSemaphore, DISPATCH_TIME_FOREVER);
-#else
-  int ret = -1;
-  while (ret)
+int LocalTraceBufferPool::insert(int traceType, const char* msg,
+                                 unsigned int length, bool truncated)
+{
+  // get immediately a message number to control sequence
+
+  int myMessageNumber = ++_position;
+
+  unsigned int size = truncated ? length + TRUNCATED_LENGTH : length;
+
+  // reserve a slot and the arena bytes of the message
+
+  unsigned long long head;
+  unsigned int ticket, index, span;
+  for (int attempt = 0; ; attempt++)
     {
-      ret = sem_wait(&_freeBufferSemaphore);
-      if (ret) perror(" LocalTraceBufferPool::insert, sem_wait");
+      unsigned long long tail = _tail.load(std::memory_order_acquire);
+      head = _head.load(std::memory_order_relaxed); // read after tail: never behind
+
+      ticket = TICKET(head);
+      index = BYTES(head) & (TRACE_ARENA_SIZE-1);
+      span = (index + size <= TRACE_ARENA_SIZE) ? size
+                                                : TRACE_ARENA_SIZE - index + size;
+      if (ticket - TICKET(tail) < TRACE_BUFFER_SIZE &&
+          BYTES(head) + span - BYTES(tail) <= TRACE_ARENA_SIZE)
+        {
+          if (_head.compare_exchange_weak(head, PACK(ticket+1, BYTES(head)+span),
+                                          std::memory_order_relaxed))
+            break;
+          continue;
+        }
+
+      // the ring is full
+
+      int policy = (traceType == ABORT_MESS) ? BLOCK : _overflowPolicy.load();
+      if (policy == DROP_NEWEST)
+        {
+          ++_dropped;
+          return -1;
+        }
+      if (policy == DROP_OLDEST && dropOldest(tail))
+        continue;
+      if (attempt < 64)
+        std::this_thread::yield();
+      else
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
     }
-#endif
-  // get the next free buffer available (mutex protected) 
+  if (index + size > TRACE_ARENA_SIZE)
+    index = 0;
+
+  // the collector (or a producer dropping the oldest message) may not have
+  // released the slot yet, although the tail is already past it
+
+  LocalTrace_Slot& slot = _slots[ticket & (TRACE_BUFFER_SIZE-1)];
+  while (slot.sequence.load(std::memory_order_acquire) != ticket)
+    std::this_thread::yield();
+
+  // fill the slot with message, thread id and type (normal or abort)
 
-  unsigned long myInsertPos = lockedIncrement(_insertPos);
+  memcpy(&_arena[index], msg, length);
+  if (truncated)
+    memcpy(&_arena[index + length], TRUNCATED_MESSAGE, TRUNCATED_LENGTH);
+  slot.offset = index;
+  slot.length = size;
+  slot.span = span;
+  slot.threadId = pthread_self();
+  slot.traceType = traceType;
+  slot.position = myMessageNumber;
+  slot.sequence.store(ticket + 1, std::memory_order_release);
 
-  // fill the buffer with message, thread id and type (normal or abort)
+  wakeUpCollector();
 
-  strncpy(_myBuffer[myInsertPos%TRACE_BUFFER_SIZE].trace,
-          msg,
-          MAXMESS_LENGTH); // last chars always "...\n\0" if msg too long
-  _myBuffer[myInsertPos%TRACE_BUFFER_SIZE].threadId =pthread_self();//thread id
-  _myBuffer[myInsertPos%TRACE_BUFFER_SIZE].traceType = traceType;
-  _myBuffer[myInsertPos%TRACE_BUFFER_SIZE].position = myMessageNumber;
+  // returns the number of free slots
 
+  return TRACE_BUFFER_SIZE - (int)(ticket + 1 - TICKET(_tail.load()));
+}
+
+// ============================================================================
+/*!
+ *  Called by the thread in charge of printing trace messages.
+ *  Waits until there is a slot with a message to print.
+ *  Gets the first slot to print, claims it, copies it int the provided
+ *  buffer, then releases the slot and its arena bytes by moving the tail.
+ *  With the drop oldest policy, a producer competes for the first slot:
+ *  the compare and swap of the slot sequence elects who reads the slot,
+ *  the tail is moved only after the slot is read.
+ *  With timeoutMs >= 0, waits at most timeoutMs milliseconds (0: no wait),
+ *  so that collectors can flush their batch of messages when idle.
+ *  Returns the number of messages still to print, or -1 on timeout.
+ */
+// ============================================================================
 
-  // increment the full buffer semaphore
-  // (if previously 0, awake thread in charge of trace)
+int LocalTraceBufferPool::retrieve(LocalTrace_TraceInfo& aTrace, int timeoutMs)
+{
+  std::chrono::steady_clock::time_point deadline =
+    std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
 
+  for (;;)
+    {
+      unsigned long long tail = _tail.load(std::memory_order_acquire);
+      unsigned int ticket = TICKET(tail);
+      LocalTrace_Slot& slot = _slots[ticket & (TRACE_BUFFER_SIZE-1)];
+
+      unsigned int sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence == CLAIMED(ticket))
+        {
+          // a producer is dropping the message
+          std::this_thread::yield();
+          continue;
+        }
+      if (sequence != ticket + 1)
+        {
+          // nothing to print, or message not yet completely inserted:
+          // wait until a producer publishes a slot
+
+          _collectorWaiting.store(true);
+          std::atomic_thread_fence(std::memory_order_seq_cst);
+          if (slot.sequence.load(std::memory_order_acquire) == ticket + 1 ||
+              _tail.load() != tail)
+            {
+              _collectorWaiting.store(false);
+              continue;
+            }
+          if (timeoutMs < 0)
+            {
 #ifdef __APPLE__
-  dispatch_semaphore_signal(_fullBufferSemaphore);
+              dispatch_semaphore_wait(_fullBufferSemaphore, DISPATCH_TIME_FOREVER);
 #else
-  ret = sem_post(&_fullBufferSemaphore);
+              int ret = -1;
+              while (ret)
+                {
+                  ret = sem_wait(&_fullBufferSemaphore);
+                  if (ret) MESSAGE (" LocalTraceBufferPool::retrieve, sem_wait");
+                }
 #endif
+              continue;
+            }
 
+          // timed wait: a producer may post the semaphore after the timeout,
+          // the next wait then returns immediately and the loop checks again
 
-  // returns the number of free buffers
+          long long remaining = std::chrono::duration_cast<std::chrono::nanoseconds>
+            (deadline - std::chrono::steady_clock::now()).count();
+          if (remaining > 0)
+            {
 #ifdef __APPLE__
-  return 0;
+              dispatch_semaphore_wait(_fullBufferSemaphore,
+                                      dispatch_time(DISPATCH_TIME_NOW, remaining));
 #else
-  sem_getvalue(&_freeBufferSemaphore, &ret);
-  return ret;  
+              long long absNs = std::chrono::duration_cast<std::chrono::nanoseconds>
+                (std::chrono::system_clock::now().time_since_epoch()).count() + remaining;
+              struct timespec absTime;
+              absTime.tv_sec = (time_t)(absNs / 1000000000);
+              absTime.tv_nsec = (long)(absNs % 1000000000);
+              sem_timedwait(&_fullBufferSemaphore, &absTime);
 #endif
+              continue;
+            }
+          _collectorWaiting.store(false);
+          if (slot.sequence.load(std::memory_order_acquire) != ticket + 1)
+            return -1;
+          continue;
+        }
+
+      // claim the slot, then copy it and its text to the provided buffer:
+      // until the tail moves, neither the slot nor its text can be reused
+
+      if (!slot.sequence.compare_exchange_strong(sequence, CLAIMED(ticket),
+                                                 std::memory_order_acquire))
+        continue;
+
+      unsigned int length = slot.length;
+      unsigned int span = slot.span;
+      memcpy(aTrace.trace, &_arena[slot.offset], length);
+      aTrace.trace[length] = '\0';
+      aTrace.length = length;
+      aTrace.threadId = slot.threadId;
+      aTrace.traceType = slot.traceType;
+      aTrace.position = slot.position;
+
+      _tail.store(PACK(ticket+1, BYTES(tail)+span), std::memory_order_release);
+      slot.sequence.store(ticket + TRACE_BUFFER_SIZE, std::memory_order_release);
+      return (int)(TICKET(_head.load()) - (ticket + 1));
+    }
 }
 
 // ============================================================================
 /*!
- *  Called by the thread in charge of printing trace messages.
- *  Waits until there is a buffer with a message to print.
- *  Gets the first buffer to print, copies it int the provided buffer
+ *  Drop oldest policy: called by a producer when the ring is full.
+ *  Releases the oldest message if it is completely inserted and not being
+ *  retrieved (the producer and the collector claim the slot with a compare
+ *  and swap of its sequence, the tail is moved by the winner only).
+ *  Returns false when the oldest message is still being inserted or copied.
  */
 // ============================================================================
 
-int LocalTraceBufferPool::retrieve(LocalTrace_TraceInfo& aTrace)
+bool LocalTraceBufferPool::dropOldest(unsigned long long tail)
 {
+  unsigned int ticket = TICKET(tail);
+  LocalTrace_Slot& slot = _slots[ticket & (TRACE_BUFFER_SIZE-1)];
+  unsigned int sequence = ticket + 1;
+  if (!slot.sequence.compare_exchange_strong(sequence, CLAIMED(ticket),
+                                             std::memory_order_acquire))
+    return _tail.load() != tail; // retry at once if the message was released
+  unsigned int span = slot.span;
+  _tail.store(PACK(ticket+1, BYTES(tail)+span), std::memory_order_release);
+  slot.sequence.store(ticket + TRACE_BUFFER_SIZE, std::memory_order_release);
+  ++_dropped;
+  return true;
+}
 
-  // wait until there is a buffer in the pool, with a message to print
+// ============================================================================
+/*!
+ *  Called by producers after publishing a slot: post the semaphore only if
+ *  the collector sleeps on it (no system call in the common case).
+ */
+// ============================================================================
 
+void LocalTraceBufferPool::wakeUpCollector()
+{
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_collectorWaiting.load(std::memory_order_relaxed) &&
+      _collectorWaiting.exchange(false))
+    {
 #ifdef __APPLE__
-    dispatch_semaphore_wait(_fullBufferSemaphore, DISPATCH_TIME_FOREVER);
+      dispatch_semaphore_signal(_fullBufferSemaphore);
 #else
-  int ret = -1;
-  while (ret)
-    {
-      ret = sem_wait(&_fullBufferSemaphore);
-      if (ret) MESSAGE (" LocalTraceBufferPool::retrieve, sem_wait");
-    }
+      sem_post(&_fullBufferSemaphore);
 #endif
-  // get the next buffer to print
+    }
+}
 
-  unsigned long myRetrievePos = lockedIncrement(_retrievePos);
+// ============================================================================
+/*!
+ *  Gives the number of messages to print.
+ *  Usage : when the thread in charge of messages print id to be stopped,
+ *  check if there is still something to print, before stop.
+ */
+// ============================================================================
 
-  // copy the buffer from the pool to the provided buffer
+unsigned long LocalTraceBufferPool::toCollect()
+{
+  return TICKET(_head.load()) - TICKET(_tail.load());
+}
 
-  memcpy((void*)&aTrace,
-         (void*)&_myBuffer[myRetrievePos%TRACE_BUFFER_SIZE],
-         sizeof(aTrace));
+// ============================================================================
+/*!
+ *  Overflow policy, i.e. what insert does when the ring is full
+ */
+// ============================================================================
 
-  // increment the free buffer semaphore
-  // (if previously 0, awake one of the threads waiting to put a trace, if any)
-  // there is no way to preserve the order of waiting threads if several
-  // threads are waiting to put a trace: the waken up thread is not
-  // necessarily the first thread to wait.
+void LocalTraceBufferPool::setOverflowPolicy(OverflowPolicy policy)
+{
+  _overflowPolicy.store(policy);
+}
 
-#ifdef __APPLE__
-  dispatch_semaphore_signal(_freeBufferSemaphore);
-#else
-  ret = sem_post(&_freeBufferSemaphore);
-#endif
+LocalTraceBufferPool::OverflowPolicy LocalTraceBufferPool::getOverflowPolicy() const
+{
+  return (OverflowPolicy)_overflowPolicy.load();
+}
 
-  // returns the number of full buffers
+// ============================================================================
+/*!
+ *  Gives the number of messages lost because of the overflow policy
+ */
+// ============================================================================
 
-#ifdef __APPLE__
-  return 0;
-#else
-  sem_getvalue(&_fullBufferSemaphore, &ret);
-  return ret;
-#endif
+unsigned long LocalTraceBufferPool::droppedMessages() const
+{
+  return _dropped.load();
 }
 
 // ============================================================================
 /*!
- *  Gives the number of buffers to print.
- *  Usage : when the thread in charge of messages print id to be stopped,
- *  check if there is still something to print, before stop.
- *  There is no need of mutex here, provided there is only one thread to
- *  retrieve and print the buffers.
+ *  True if the trace collector formats the binary records of BTRACE macros
+ *  (built-in collectors do), false if BTRACE messages must be formatted by
+ *  the producer. Environment variable "SALOME_trace_binary" = "0" or "1"
+ *  overrides the choice.
  */
 // ============================================================================
 
-unsigned long LocalTraceBufferPool::toCollect()
+bool LocalTraceBufferPool::binaryRecords() const
 {
-  return _insertPos - _retrievePos;
+  return _binaryRecords;
 }
 
 // ============================================================================
 /*!
- * Constructor : initialize pool of buffers, semaphores and mutex.
+ * Constructor : initialize pool of slots, counters and semaphore.
  */
 // ============================================================================
 
@@ -299,33 +532,42 @@ LocalTraceBufferPool::LocalTraceBufferPool()
 {
   //cerr << "LocalTraceBufferPool::LocalTraceBufferPool()" << endl;
 
-  _insertPos   = ULONG_MAX;  // first increment will give 0
-  _retrievePos = ULONG_MAX;
-  _position=0;               // first message will have number = 1
-
-  memset(_myBuffer, 0, sizeof(_myBuffer)); // to guarantee end of strings = 0
-  for (int i=0; i<TRACE_BUFFER_SIZE; i++)
-    strcpy(&(_myBuffer[i].trace[MAXMESS_LENGTH]),TRUNCATED_MESSAGE);
-  int ret;
+  _head = 0;
+  _tail = 0;
+  _position = 0;             // first message will have number = 1
+  _dropped = 0;
+  _collectorWaiting = false;
+  _binaryRecords = false;
+
+  _overflowPolicy = BLOCK;
+  char* overflow = getenv("SALOME_trace_overflow");
+  if (overflow && strcmp(overflow,"drop_oldest")==0)
+    _overflowPolicy = DROP_OLDEST;
+  else if (overflow && strcmp(overflow,"drop_newest")==0)
+    _overflowPolicy = DROP_NEWEST;
+
+  for (unsigned int i=0; i<TRACE_BUFFER_SIZE; i++)
+    {
+      _slots[i].sequence = i;  // slot i free for ticket i
+      _slots[i].offset = 0;
+      _slots[i].length = 0;
+      _slots[i].span = 0;
+      _slots[i].traceType = NORMAL_MESS;
+      _slots[i].position = 0;
+    }
 #ifdef __APPLE__
-  dispatch_semaphore_t* sem1 = &_freeBufferSemaphore, *sem2 = &_fullBufferSemaphore;
-  *sem1 = dispatch_semaphore_create(TRACE_BUFFER_SIZE);
-  *sem2 = dispatch_semaphore_create(0);
+  _fullBufferSemaphore = dispatch_semaphore_create(0);
 #else
-  ret=sem_init(&_freeBufferSemaphore, 0, TRACE_BUFFER_SIZE); // all buffer free
-  if (ret!=0) IMMEDIATE_ABORT(ret);
-  ret=sem_init(&_fullBufferSemaphore, 0, 0);                 // 0 buffer full
+  int ret=sem_init(&_fullBufferSemaphore, 0, 0);             // 0 buffer full
   if (ret!=0) IMMEDIATE_ABORT(ret);
 #endif
-  ret=pthread_mutex_init(&_incrementMutex,NULL); // default = fast mutex
-  if (ret!=0) IMMEDIATE_ABORT(ret);
 
   //cerr << "LocalTraceBufferPool::LocalTraceBufferPool()-end" << endl;
 }
 
 // ============================================================================
 /*!
- * Destructor : release memory associated with semaphores and mutex
+ * Destructor : release memory associated with semaphore
  */
 // ============================================================================
 
@@ -338,29 +580,12 @@ LocalTraceBufferPool::~LocalTraceBufferPool()
       delete (_myThreadTrace);
       _myThreadTrace = 0;
 #ifdef __APPLE__
-      dispatch_release(_freeBufferSemaphore);
       dispatch_release(_fullBufferSemaphore);
 #else
-      sem_destroy(&_freeBufferSemaphore);
       sem_destroy(&_fullBufferSemaphore);
 #endif
-      pthread_mutex_destroy(&_incrementMutex);
       DEVTRACE("LocalTraceBufferPool::~LocalTraceBufferPool()-end");
       _singleton = 0;
     }
   pthread_mutex_unlock(&_singletonMutex); // release lock
 }
-
-// ============================================================================
-/*!
- * pool counters are incremented under a mutex protection
- */
-// ============================================================================
-
-unsigned long LocalTraceBufferPool::lockedIncrement(unsigned long& pos)
-{
-  pthread_mutex_lock(&_incrementMutex);   // lock access to counters
-  unsigned long mypos = ++pos;
-  pthread_mutex_unlock(&_incrementMutex); // release lock
-  return mypos;
-}
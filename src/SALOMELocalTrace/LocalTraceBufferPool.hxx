@@ -29,10 +29,16 @@
 
 #include "SALOME_LocalTrace.hxx"
 
-#define TRACE_BUFFER_SIZE 512  // number of entries in circular buffer
-                               // must be power of 2
-#define MAX_TRACE_LENGTH 1024   // messages are truncated at this size
+#define TRACE_BUFFER_SIZE 4096   // number of record slots in circular buffer
+                                 // must be power of 2
+#define TRACE_ARENA_SIZE 262144  // bytes of message text shared by the slots
+                                 // must be power of 2
+#define MAX_TRACE_LENGTH 1024    // messages are truncated at this size
 
+#define TRACE_FLUSH_SIZE 65536   // collectors write messages by batches of
+#define TRACE_FLUSH_DELAY 100    // this size (bytes), or after this delay (ms)
+
+#include <atomic>
 #include <pthread.h>
 #include <semaphore.h>
 #ifdef __APPLE__
@@ -41,6 +47,7 @@
 #include "BaseTraceCollector.hxx"
 #include "BasicsGenericDestructor.hxx"
 
+#define BINARY_MESS 3   // BTRACE record, see BinaryTraceRecord.hxx
 #define BRIEF_MESS  2
 #define ABORT_MESS  1   // for traceType field in struct LocalTrace_TraceInfo
 #define NORMAL_MESS 0
@@ -51,38 +58,75 @@ struct SALOMELOCALTRACE_EXPORT LocalTrace_TraceInfo
   pthread_t threadId;
   int traceType;                 // normal or abort
   int position;                  // to check sequence
+  unsigned int length;           // bytes in trace (binary records contain '\0')
+};
+
+// One record of the ring: the message text lives in the byte arena,
+// sequence tells who owns the slot, it is published with release ordering
+// after the other fields and read with acquire ordering before them
+// (see LocalTraceBufferPool.cxx)
+
+struct LocalTrace_Slot
+{
+  std::atomic<unsigned int> sequence;
+  unsigned int offset;           // arena index of the message text
+  unsigned int length;           // message length, no ending '\0'
+  unsigned int span;             // arena bytes used, end of arena padding included
+  pthread_t threadId;
+  int traceType;
+  int position;
 };
 
 class SALOMELOCALTRACE_EXPORT LocalTraceBufferPool : public PROTECTED_DELETE
 {
  public:
+  // what insert does when the ring is full (environment variable
+  // "SALOME_trace_overflow" = "block", "drop_oldest" or "drop_newest")
+  enum OverflowPolicy { BLOCK, DROP_OLDEST, DROP_NEWEST };
+
   static LocalTraceBufferPool* instance();
   int insert(int traceType, const char* msg);
-  int retrieve(LocalTrace_TraceInfo& aTrace);
+  int insert(int traceType, const char* data, unsigned int length);
+  int retrieve(LocalTrace_TraceInfo& aTrace, int timeoutMs = -1);
   unsigned long toCollect();
 
+  void setOverflowPolicy(OverflowPolicy policy);
+  OverflowPolicy getOverflowPolicy() const;
+  unsigned long droppedMessages() const;
+  bool binaryRecords() const;
+
  protected:
   LocalTraceBufferPool();
   virtual ~LocalTraceBufferPool();
-  unsigned long lockedIncrement(unsigned long& pos);
+  int insert(int traceType, const char* data, unsigned int length,
+             bool truncated);
+  bool dropOldest(unsigned long long tail);
+  void wakeUpCollector();
 
  private:
   static LocalTraceBufferPool* _singleton;
   static pthread_mutex_t _singletonMutex;
   static BaseTraceCollector *_myThreadTrace;
 
-  LocalTrace_TraceInfo _myBuffer[TRACE_BUFFER_SIZE];
+  // _head and _tail pack a slot ticket (high 32 bits) and an arena byte
+  // counter (low 32 bits), so that one CAS reserves both in the same order
+  std::atomic<unsigned long long> _head;     // next record to insert
+  char _headPad[64];                         // keep producers and collector
+  std::atomic<unsigned long long> _tail;     // on separate cache lines
+  char _tailPad[64];
+  std::atomic<int> _position;                // message number, to check sequence
+  std::atomic<unsigned long> _dropped;       // messages lost by the overflow policy
+  std::atomic<int> _overflowPolicy;
+  std::atomic<bool> _collectorWaiting;       // collector sleeps on the semaphore
+  bool _binaryRecords;                       // collector formats BTRACE records
+
+  LocalTrace_Slot _slots[TRACE_BUFFER_SIZE];
+  char _arena[TRACE_ARENA_SIZE];
 #ifdef __APPLE__
-  dispatch_semaphore_t _freeBufferSemaphore;       // to wait until there is a free buffer
   dispatch_semaphore_t _fullBufferSemaphore;       // to wait until there is a buffer to print
 #else
-  sem_t _freeBufferSemaphore;       // to wait until there is a free buffer
   sem_t _fullBufferSemaphore;       // to wait until there is a buffer to print
 #endif
-  pthread_mutex_t _incrementMutex;  // to lock position variables for increment
-  unsigned long _position;
-  unsigned long _insertPos;
-  unsigned long _retrievePos;
 };
 
 #endif
@@ -31,6 +31,7 @@
 #include <cstdlib>
 
 #include "LocalTraceCollector.hxx"
+#include "BinaryTraceRecord.hxx"
 
 // ============================================================================
 /*!
@@ -96,6 +97,7 @@ void* LocalTraceCollector::run(void* /*bid*/)
         }
 
       myTraceBuffer->retrieve(myTrace);
+      BinaryTraceRecord::toText(myTrace); // deferred formatting of BTRACE
       if (myTrace.traceType == ABORT_MESS)
         {
           std::cout << std::flush ;
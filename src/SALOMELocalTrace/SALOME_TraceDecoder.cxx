@@ -0,0 +1,146 @@
+// Copyright (C) 2007-2021  CEA/DEN, EDF R&D, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  File   : SALOME_TraceDecoder.cxx
+//  Module : KERNEL
+//
+//  Prints as text a trace file written with SALOME_trace=binary:pathname
+//  (see BinaryTraceCollector), as FileTraceCollector would have printed it.
+//  Usage: SALOME_TraceDecoder [-t] pathname
+//    -t : each message is preceded by its time (seconds since epoch), for
+//         BTRACE messages.
+//
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "BinaryTraceRecord.hxx"
+
+namespace
+{
+  template<class T> bool read(std::ifstream& file, T& value)
+  {
+    return (bool)file.read((char*)&value, sizeof(value));
+  }
+
+  bool readString(std::ifstream& file, std::string& value)
+  {
+    unsigned int size;
+    if (!read(file, size) || size > (1u << 20))
+      return false;
+    value.resize(size);
+    return size == 0 || (bool)file.read(&value[0], size);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  bool withTime = false;
+  const char* fileName = 0;
+  for (int i = 1; i < argc; i++)
+    {
+      if (strcmp(argv[i], "-t") == 0)
+        withTime = true;
+      else
+        fileName = argv[i];
+    }
+  if (!fileName)
+    {
+      std::cerr << "usage: " << argv[0] << " [-t] pathname" << std::endl;
+      return 1;
+    }
+
+  std::ifstream traceFile(fileName, std::ios::in | std::ios::binary);
+  if (!traceFile)
+    {
+      std::cerr << "impossible to open trace file " << fileName << std::endl;
+      return 1;
+    }
+  char magic[sizeof(BINARY_TRACE_MAGIC)-1];
+  int version;
+  if (!traceFile.read(magic, sizeof(magic)) ||
+      strncmp(magic, BINARY_TRACE_MAGIC, sizeof(magic)) != 0 ||
+      !read(traceFile, version) || version != BINARY_TRACE_VERSION)
+    {
+      std::cerr << fileName << " is not a binary trace file" << std::endl;
+      return 1;
+    }
+
+  std::map<int, BinaryTraceSite> sites;
+  std::vector<char> data;
+  char kind;
+  while (traceFile.get(kind))
+    {
+      if (kind == 'S')
+        {
+          int siteId;
+          BinaryTraceSite aSite;
+          if (!read(traceFile, siteId) || !read(traceFile, aSite.line) ||
+              !readString(traceFile, aSite.file) || !readString(traceFile, aSite.format))
+            break;
+          sites[siteId] = aSite;
+          continue;
+        }
+      int traceType;
+      unsigned long long threadId;
+      unsigned int length;
+      if (kind != 'M' ||
+          !read(traceFile, traceType) || !read(traceFile, threadId) ||
+          !read(traceFile, length) || length > MAX_TRACE_LENGTH)
+        break;
+      data.resize(length + 1);
+      if (length && !traceFile.read(&data[0], length))
+        break;
+      data[length] = '\0';
+
+      std::string text;
+      unsigned long long timestamp = 0;
+      if (traceType == BINARY_MESS)
+        {
+          int siteId = -1;
+          if (length >= sizeof(siteId))
+            memcpy(&siteId, &data[0], sizeof(siteId));
+          std::map<int, BinaryTraceSite>::const_iterator it = sites.find(siteId);
+          if (it == sites.end())
+            text = "- Trace unknown BTRACE site\n";
+          else
+            text = BinaryTraceRecord::toText(it->second, &data[0], length, &timestamp);
+        }
+      else
+        text = &data[0];
+
+      if (withTime && timestamp)
+        std::cout << timestamp / 1000000000 << "."
+                  << std::setw(6) << std::setfill('0') << (timestamp / 1000) % 1000000
+                  << std::setfill(' ') << " ";
+      if (traceType == ABORT_MESS)
+        std::cout << "INTERRUPTION from thread " << threadId << " : " << text;
+      else
+        std::cout << "th. " << threadId << " " << text;
+    }
+  if (!traceFile.eof())
+    {
+      std::cerr << "truncated or corrupted trace file " << fileName << std::endl;
+      return 1;
+    }
+  return 0;
+}
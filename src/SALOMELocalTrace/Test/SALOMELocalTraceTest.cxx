@@ -27,6 +27,7 @@
 #include <string>
 #include <cstdlib>
 #include <cstdio>
+#include <chrono>
 #include "LocalTraceBufferPool.hxx"
 #include "utilities.h"
 #include "Basics_Utils.hxx"
@@ -181,6 +182,145 @@ SALOMELocalTraceTest::testLoadBufferPoolFile()
   bp1->deleteInstance(bp1);
 }
 
+#define NUM_BENCH_THREADS  4
+#define NUM_BENCH_MESSAGES 50000
+void *FloodTrace(void *threadid);
+
+// ============================================================================
+/*!
+ *  multithread throughput of the trace ring, for each overflow policy:
+ *  NUM_BENCH_THREADS threads insert NUM_BENCH_MESSAGES messages each in the
+ *  pool, printed on a file. Every message is either printed or counted as
+ *  dropped.
+ */
+// ============================================================================
+
+void
+SALOMELocalTraceTest::testBufferPoolThroughput()
+{
+  std::string theFileName = _getTraceFileName();
+
+  std::string s = "file:";
+  s += theFileName;
+  CPPUNIT_ASSERT(! setenv("SALOME_trace",s.c_str(),1)); // 1: overwrite
+
+  const char* policyNames[] = { "block", "drop_oldest", "drop_newest" };
+  LocalTraceBufferPool::OverflowPolicy policies[] =
+    { LocalTraceBufferPool::BLOCK,
+      LocalTraceBufferPool::DROP_OLDEST,
+      LocalTraceBufferPool::DROP_NEWEST };
+
+  for (int p=0; p<3; p++)
+    {
+      std::ofstream traceFile;
+      traceFile.open(theFileName.c_str(), std::ios::out | std::ios::trunc);
+      CPPUNIT_ASSERT(traceFile); // file created empty, then closed
+      traceFile.close();
+
+      LocalTraceBufferPool* bp1 = LocalTraceBufferPool::instance();
+      CPPUNIT_ASSERT(bp1);
+      bp1->setOverflowPolicy(policies[p]);
+      CPPUNIT_ASSERT(bp1->getOverflowPolicy() == policies[p]);
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      pthread_t threads[NUM_BENCH_THREADS];
+      long t;
+      for(t=0;t<NUM_BENCH_THREADS;t++)
+        CPPUNIT_ASSERT(! pthread_create(&threads[t], NULL, FloodTrace, (void*)t));
+      for(t=0;t<NUM_BENCH_THREADS;t++)
+        pthread_join(threads[t], NULL);
+
+      double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      unsigned long dropped = bp1->droppedMessages();
+      if (policies[p] == LocalTraceBufferPool::BLOCK)
+        CPPUNIT_ASSERT_EQUAL(0UL, dropped);
+      bp1->deleteInstance(bp1); // waits until all messages are printed
+
+      // --- each message is printed once, or dropped
+
+      unsigned long printed = 0;
+      std::ifstream traceIn(theFileName.c_str());
+      std::string line;
+      while (std::getline(traceIn, line))
+        if (line.find("throughput test") != std::string::npos)
+          printed++;
+      CPPUNIT_ASSERT_EQUAL((unsigned long)NUM_BENCH_THREADS*NUM_BENCH_MESSAGES,
+                           printed + dropped);
+
+      std::cerr << std::endl << "trace ring, " << policyNames[p] << ": "
+                << NUM_BENCH_THREADS*NUM_BENCH_MESSAGES/elapsed << " messages/s, "
+                << dropped << " dropped" << std::endl;
+    }
+}
+
+// ============================================================================
+/*!
+ *  BTRACE records formatted by the file collector thread, then by the
+ *  calling thread (SALOME_trace_binary=0): same text.
+ */
+// ============================================================================
+
+void
+SALOMELocalTraceTest::testBinaryTrace()
+{
+  std::string theFileName = _getTraceFileName();
+
+  std::string s = "file:";
+  s += theFileName;
+  CPPUNIT_ASSERT(! setenv("SALOME_trace",s.c_str(),1)); // 1: overwrite
+
+  const char* binaryModes[] = { "1", "0" };
+  for (int m=0; m<2; m++)
+    {
+      CPPUNIT_ASSERT(! setenv("SALOME_trace_binary",binaryModes[m],1));
+
+      std::ofstream traceFile;
+      traceFile.open(theFileName.c_str(), std::ios::out | std::ios::trunc);
+      CPPUNIT_ASSERT(traceFile); // file created empty, then closed
+      traceFile.close();
+
+      LocalTraceBufferPool* bp1 = LocalTraceBufferPool::instance();
+      CPPUNIT_ASSERT(bp1);
+      CPPUNIT_ASSERT(bp1->binaryRecords() == (m == 0));
+      std::string name = "container";
+      BTRACE("binary trace {} {} {} {} {}", name, 42, -1.5, 'c', "end");
+      bp1->deleteInstance(bp1);
+
+      std::ifstream traceIn(theFileName.c_str());
+      std::string line;
+      bool found = false;
+      while (std::getline(traceIn, line))
+        if (line.find("binary trace container 42 -1.5 c end") != std::string::npos)
+          found = true;
+      CPPUNIT_ASSERT(found);
+    }
+  CPPUNIT_ASSERT(! setenv("SALOME_trace_binary","1",1)); // as default for file
+}
+
+// ============================================================================
+/*!
+ * Inserts NUM_BENCH_MESSAGES traces in the pool, without the MESSAGE macro
+ * (available in debug mode only).
+ */
+// ============================================================================
+
+void *FloodTrace(void *threadid)
+{
+  long id_thread = (long)threadid;
+  LocalTraceBufferPool* bp = LocalTraceBufferPool::instance();
+  char msg[128];
+  for (int i=0; i<NUM_BENCH_MESSAGES; i++)
+    {
+      sprintf(msg, "thread %ld - iter %d : throughput test\n", id_thread, i);
+      bp->insert(NORMAL_MESS, msg);
+    }
+  pthread_exit(NULL);
+#ifdef WIN32
+  return NULL;
+#endif
+}
+
 // ============================================================================
 /*!
  * NUM_THREAD are created with function PrintHello,
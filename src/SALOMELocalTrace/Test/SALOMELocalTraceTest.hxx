@@ -42,6 +42,8 @@ class SALOMELOCALTRACETEST_EXPORT SALOMELocalTraceTest : public CppUnit::TestFix
   CPPUNIT_TEST( testSingletonBufferPool );
   CPPUNIT_TEST( testLoadBufferPoolLocal );
   CPPUNIT_TEST( testLoadBufferPoolFile );
+  CPPUNIT_TEST( testBufferPoolThroughput );
+  CPPUNIT_TEST( testBinaryTrace );
   CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -51,6 +53,8 @@ public:
   void testSingletonBufferPool();
   void testLoadBufferPoolLocal();
   void testLoadBufferPoolFile();
+  void testBufferPoolThroughput();
+  void testBinaryTrace();
 
  private:
   std::string _getTraceFileName();
@@ -37,6 +37,7 @@
 
 
 #include "LocalTraceBufferPool.hxx"
+#include "BinaryTraceRecord.hxx"
 
 /*!
  * For each message to put in the trace, a specific ostingstream object is
@@ -67,6 +68,23 @@
 #define PYSCRIPT(msg) {MESS_INIT("---PYSCRIPT--- ") << msg << MESS_END}
 #define INTERRUPTION(msg) {MESS_BEGIN("- INTERRUPTION: ")<< msg << MESS_ABORT}
 
+/*!
+ * BTRACE("format {} with {} arguments", arg1, arg2) is printed as INFOS, but
+ * no text is built by the calling thread: a format site id, a timestamp and
+ * the raw arguments are inserted (see BinaryTraceRecord.hxx), the collector
+ * thread formats the message, or SALOME_TraceDecoder with SALOME_trace=binary.
+ * Arguments: numbers, char, strings, pointers. Always defined, unless
+ * SALOME_NO_BTRACE is defined at compile time. BMESSAGE is the same record
+ * printed as MESSAGE, at debug time only.
+ */
+
+#ifndef SALOME_NO_BTRACE
+#define BTRACE(...) {static const int btraceSite = BinaryTraceRecord::registerSite(__FILE__, __LINE__, BinaryTrace_Format(__VA_ARGS__)); \
+                     BinaryTrace_Send(btraceSite, __VA_ARGS__);}
+#else
+#define BTRACE(...) {}
+#endif
+
 #ifdef WIN32
 #define IMMEDIATE_ABORT(code) {std::cout <<std::flush; \
                                std::cerr << "- ABORT " << __FILE__ << " [" <<__LINE__<< "] : " << std::flush; \
@@ -110,6 +128,7 @@
                                        << " at " << __TIME__ << MESS_END }
 
 #define MESSAGE(msg) {MESS_BEGIN("- Trace ") << msg << MESS_END}
+#define BMESSAGE(...) BTRACE(__VA_ARGS__)
 #define SCRUTE(var)  {MESS_BEGIN("- Trace ") << #var << "=" << var <<MESS_END}
 
 #define REPERE ("------- ")
@@ -126,6 +145,7 @@
 
 #define INFOS_COMPILATION
 #define MESSAGE(msg) {}
+#define BMESSAGE(...) {}
 #define SCRUTE(var) {}
 #define REPERE
 #define BEGIN_OF(msg) {}
@@ -46,6 +46,8 @@ using namespace SALOMESDS;
 
 std::size_t DataScopeServerBase::COUNTER=0;
 
+const std::size_t DataScopeServerBase::PICKLED_MAX_SIZE=512*1024*1024;
+
 void DataScopeKiller::shutdown()
 {
   _orb->shutdown(0);
@@ -76,10 +78,13 @@ DataScopeServerBase::DataScopeServerBase(const SALOME_CPythonHelper *pyHelper, C
 
 DataScopeServerBase::DataScopeServerBase(const DataScopeServerBase& other):omniServant(other),ServantBase(other),_ns(other._ns->clone()),_pyHelper(other._pyHelper),_name(other._name),_vars(other._vars),_killer(other._killer)
 {
+  buildVarsIndex();
 }
 
 DataScopeServerBase::~DataScopeServerBase()
 {
+  while(!_pickledVars.empty())// vars may outlive this
+    _pickledVars.front()->invalidatePickled();
   for(std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::const_iterator it=_vars.begin();it!=_vars.end();it++)
     {
        BasicDataServer *obj((*it).second);
@@ -126,11 +131,7 @@ SALOME::StringVec *DataScopeServerBase::listVars()
 
 CORBA::Boolean DataScopeServerBase::existVar(const char *varName)
 {
-  std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::const_iterator it(_vars.begin());
-  for(;it!=_vars.end();it++)
-    if((*it).second->getVarNameCpp()==varName)
-      return true;
-  return false;
+  return _varsIndex.find(varName)!=_varsIndex.end();
 }
 
 SALOME::BasicDataServer_ptr DataScopeServerBase::retrieveVarInternal(const char *varName)
@@ -148,17 +149,16 @@ BasicDataServer *DataScopeServerBase::retrieveVarInternal2(const std::string& va
 void DataScopeServerBase::deleteVar(const char *varName)
 {
   std::string varNameCpp(varName);
-  std::vector<std::string> allNames(getAllVarNames());
-  std::vector<std::string>::iterator it(std::find(allNames.begin(),allNames.end(),varNameCpp));
-  if(it==allNames.end())
+  std::unordered_map< std::string, std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::iterator >::iterator it(_varsIndex.find(varNameCpp));
+  if(it==_varsIndex.end())
     {
+      std::vector<std::string> allNames(getAllVarNames());
       std::ostringstream oss; oss << "DataScopeServerBase::deleteVar : name \"" << varNameCpp << "\" does not exists ! Possibilities are :";
       std::copy(allNames.begin(),allNames.end(),std::ostream_iterator<std::string>(oss,", "));
       throw Exception(oss.str());
     }
-  std::size_t pos(std::distance(allNames.begin(),it));
-  std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::iterator it0(_vars.begin());
-  for(std::size_t ii=0;ii<pos;ii++,it0++);
+  std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::iterator it0((*it).second);
+  _varsIndex.erase(it);
   (*it0).second->decrRef();
   _vars.erase(it0);
 }
@@ -256,9 +256,7 @@ SALOME::ByteVec *DataScopeServerBase::getValueOfVarWithTypeDict(const char *varN
       throw Exception(oss.str());
     }
   //
-  std::string keyCpp;
-  PickelizedPyObjServer::FromByteSeqToCpp(constKey,keyCpp);
-  SALOME::AutoPyRef key(PickelizedPyObjServer::GetPyObjFromPickled(keyCpp,this));
+  SALOME::AutoPyRef key(PickelizedPyObjServer::GetPyObjFromPickled(constKey,this));
   PyObject *value(PyDict_GetItem(varc->getPyObj(),key.get()));//borrowed
   if(!value)
     {
@@ -266,8 +264,8 @@ SALOME::ByteVec *DataScopeServerBase::getValueOfVarWithTypeDict(const char *varN
       throw Exception(oss.str());
     }
   Py_XINCREF(value);
-  std::string ret(PickelizedPyObjServer::Pickelize(value,this));//value is consumed
-  return PickelizedPyObjServer::FromCppToByteSeq(ret);
+  SALOME::AutoPyRef ret(PickelizedPyObjServer::PickelizeToPyBytes(value,this));//value is consumed
+  return PickelizedPyObjServer::FromPyBytesToByteSeq(ret);
 }
 
 void DataScopeServerBase::takeANap(CORBA::Double napDurationInSec)
@@ -323,9 +321,7 @@ std::vector< std::string > DataScopeServerBase::getAllVarNames() const
 
 bool DataScopeServerBase::isExistingVar(const std::string& varName) const
 {
-  std::vector<std::string> allNames(getAllVarNames());
-  std::vector<std::string>::iterator it(std::find(allNames.begin(),allNames.end(),varName));
-  return it!=allNames.end();
+  return _varsIndex.find(varName)!=_varsIndex.end();
 }
 
 void DataScopeServerBase::checkNotAlreadyExistingVar(const std::string& varName) const
@@ -339,9 +335,7 @@ void DataScopeServerBase::checkNotAlreadyExistingVar(const std::string& varName)
 
 void DataScopeServerBase::checkExistingVar(const std::string& varName) const
 {
-  std::vector<std::string> allNames(getAllVarNames());
-  std::vector<std::string>::iterator it(std::find(allNames.begin(),allNames.end(),varName));
-  if(it==allNames.end())
+  if(!isExistingVar(varName))
     {
       std::ostringstream oss; oss << "DataScopeServerBase::checkExistingVar : name \"" << varName << "\" does not exist !";
       throw Exception(oss.str());
@@ -440,34 +434,71 @@ void DataScopeServerBase::moveStatusOfVarFromRdExtOrRdExtInitToRdExt(const std::
 
 std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::const_iterator DataScopeServerBase::retrieveVarInternal3(const std::string& varName) const
 {
-  std::vector<std::string> allNames(getAllVarNames());
-  std::vector<std::string>::iterator it(std::find(allNames.begin(),allNames.end(),varName));
-  if(it==allNames.end())
+  std::unordered_map< std::string, std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::iterator >::const_iterator it(_varsIndex.find(varName));
+  if(it==_varsIndex.end())
     {
+      std::vector<std::string> allNames(getAllVarNames());
       std::ostringstream oss; oss << "DataScopeServerBase::retrieveVarInternal3 : name \"" << varName << "\" does not exists ! Possibilities are :";
       std::copy(allNames.begin(),allNames.end(),std::ostream_iterator<std::string>(oss,", "));
       throw Exception(oss.str());
     }
-  std::size_t pos(std::distance(allNames.begin(),it));
-  std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::const_iterator it0(_vars.begin());
-  for(std::size_t i=0;i<pos;i++,it0++);
-  return it0;
+  return (*it).second;
 }
 
 std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::iterator DataScopeServerBase::retrieveVarInternal4(const std::string& varName)
 {
-  std::vector<std::string> allNames(getAllVarNames());
-  std::vector<std::string>::iterator it(std::find(allNames.begin(),allNames.end(),varName));
-  if(it==allNames.end())
+  std::unordered_map< std::string, std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::iterator >::const_iterator it(_varsIndex.find(varName));
+  if(it==_varsIndex.end())
     {
+      std::vector<std::string> allNames(getAllVarNames());
       std::ostringstream oss; oss << "DataScopeServerBase::retrieveVarInternal4 : name \"" << varName << "\" does not exists ! Possibilities are :";
       std::copy(allNames.begin(),allNames.end(),std::ostream_iterator<std::string>(oss,", "));
       throw Exception(oss.str());
     }
-  std::size_t pos(std::distance(allNames.begin(),it));
-  std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::iterator it0(_vars.begin());
-  for(std::size_t i=0;i<pos;i++,it0++);
-  return it0;
+  return (*it).second;
+}
+
+/*!
+ * Adds a var at the end of \a _vars and in \a _varsIndex. The name of the var is expected to be not already used.
+ */
+void DataScopeServerBase::appendVar(const std::pair< SALOME::BasicDataServer_var, BasicDataServer * >& p)
+{
+  _vars.push_back(p);
+  std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::iterator it(_vars.end());
+  _varsIndex[p.second->getVarNameCpp()]=--it;
+}
+
+/*!
+ * Called by \a var when it keeps its pickled form of size \a sz. The pickled forms kept by the other vars are released,
+ * least recently fetched first, until the sum of the sizes is at most \a PICKLED_MAX_SIZE. Returns the position of
+ * \a var to give to touchPickled and releasePickled.
+ */
+std::list< PickelizedPyObjServer * >::iterator DataScopeServerBase::keepPickled(PickelizedPyObjServer *var, std::size_t sz)
+{
+  while(!_pickledVars.empty() && _pickledSize+sz>PICKLED_MAX_SIZE)
+    _pickledVars.front()->invalidatePickled();
+  _pickledSize+=sz;
+  return _pickledVars.insert(_pickledVars.end(),var);
+}
+
+//! Called by a var each time its kept pickled form is fetched.
+void DataScopeServerBase::touchPickled(std::list< PickelizedPyObjServer * >::iterator pos)
+{
+  _pickledVars.splice(_pickledVars.end(),_pickledVars,pos);
+}
+
+//! Called by a var when it releases its pickled form of size \a sz.
+void DataScopeServerBase::releasePickled(std::list< PickelizedPyObjServer * >::iterator pos, std::size_t sz)
+{
+  _pickledSize-=sz;
+  _pickledVars.erase(pos);
+}
+
+void DataScopeServerBase::buildVarsIndex()
+{
+  _varsIndex.clear();
+  for(std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::iterator it=_vars.begin();it!=_vars.end();it++)
+    _varsIndex[(*it).second->getVarNameCpp()]=it;
 }
 
 ///////
@@ -487,7 +518,7 @@ SALOME::PickelizedPyObjRdOnlyServer_ptr DataScopeServer::createRdOnlyVar(const c
   PickelizedPyObjRdOnlyServer *tmp(new PickelizedPyObjRdOnlyServer(this,varNameCpp,constValue));
   CORBA::Object_var ret(tmp->activate());
   std::pair< SALOME::BasicDataServer_var, BasicDataServer * > p(SALOME::BasicDataServer::_narrow(ret),tmp);
-  _vars.push_back(p);
+  appendVar(p);
   return SALOME::PickelizedPyObjRdOnlyServer::_narrow(ret);
 }
 
@@ -498,7 +529,7 @@ SALOME::PickelizedPyObjRdExtServer_ptr DataScopeServer::createRdExtVar(const cha
   PickelizedPyObjRdExtServer *tmp(new PickelizedPyObjRdExtServer(this,varNameCpp,constValue));
   CORBA::Object_var ret(tmp->activate());
   std::pair< SALOME::BasicDataServer_var, BasicDataServer * > p(SALOME::BasicDataServer::_narrow(ret),tmp);
-  _vars.push_back(p);
+  appendVar(p);
   return SALOME::PickelizedPyObjRdExtServer::_narrow(ret);
 }
 
@@ -509,7 +540,7 @@ SALOME::PickelizedPyObjRdWrServer_ptr DataScopeServer::createRdWrVar(const char
   PickelizedPyObjRdWrServer *tmp(new PickelizedPyObjRdWrServer(this,typeNameCpp,varNameCpp));
   CORBA::Object_var ret(tmp->activate());
   std::pair< SALOME::BasicDataServer_var, BasicDataServer * > p(SALOME::BasicDataServer::_narrow(ret),tmp);
-  _vars.push_back(p);
+  appendVar(p);
   return SALOME::PickelizedPyObjRdWrServer::_narrow(ret);
 }
 
@@ -568,7 +599,7 @@ void DataScopeServerTransaction::createRdOnlyVarInternal(const std::string& varN
   PickelizedPyObjRdOnlyServer *tmp(new PickelizedPyObjRdOnlyServer(this,varName,constValue));
   CORBA::Object_var ret(tmp->activate());
   std::pair< SALOME::BasicDataServer_var, BasicDataServer * > p(SALOME::BasicDataServer::_narrow(ret),tmp);
-  _vars.push_back(p);
+  appendVar(p);
 }
 
 void DataScopeServerTransaction::createRdExtVarInternal(const std::string& varName, const SALOME::ByteVec& constValue)
@@ -577,7 +608,7 @@ void DataScopeServerTransaction::createRdExtVarInternal(const std::string& varNa
   PickelizedPyObjRdExtServer *tmp(new PickelizedPyObjRdExtServer(this,varName,constValue));
   CORBA::Object_var ret(tmp->activate());
   std::pair< SALOME::BasicDataServer_var, BasicDataServer * > p(SALOME::BasicDataServer::_narrow(ret),tmp);
-  _vars.push_back(p);
+  appendVar(p);
 }
 
 void DataScopeServerTransaction::createRdExtVarFreeStyleInternal(const std::string& varName, const SALOME::ByteVec& constValue, std::string&& compareFuncContent, SALOME::AutoPyRef&& compareFunc)
@@ -587,7 +618,7 @@ void DataScopeServerTransaction::createRdExtVarFreeStyleInternal(const std::stri
       PickelizedPyObjRdExtFreeStyleServer *tmp(new PickelizedPyObjRdExtFreeStyleServer(this,varName,constValue,std::move(compareFuncContent),std::move(compareFunc)));
       CORBA::Object_var ret(tmp->activate());
       std::pair< SALOME::BasicDataServer_var, BasicDataServer * > p(SALOME::BasicDataServer::_narrow(ret),tmp);
-      _vars.push_back(p);
+      appendVar(p);
     }
   else
     {
@@ -612,9 +643,7 @@ void DataScopeServerTransaction::createRdExtVarFreeStyleInternal(const std::stri
           oss << "DataScopeServerTransaction::createRdExtVarFreeStyleInternal : varname \"" << varName << "\" already exists with a non PickelizedPyObjServer type !";
           throw Exception(oss.str());
         }
-      std::vector<unsigned char> constValueAsCpp;
-      Transaction::FromByteSeqToVB(constValue,constValueAsCpp);
-      SALOME::AutoPyRef newObj(PickelizedPyObjServer::GetPyObjFromPickled(constValueAsCpp,this));
+      SALOME::AutoPyRef newObj(PickelizedPyObjServer::GetPyObjFromPickled(constValue,this));
       if(newObj.isNull())
         {
           std::ostringstream oss;
@@ -631,7 +660,7 @@ void DataScopeServerTransaction::createRdExtInitVarInternal(const std::string& v
   PickelizedPyObjRdExtInitServer *tmp(new PickelizedPyObjRdExtInitServer(this,varName,constValue));
   CORBA::Object_var ret(tmp->activate());
   std::pair< SALOME::BasicDataServer_var, BasicDataServer * > p(SALOME::BasicDataServer::_narrow(ret),tmp);
-  _vars.push_back(p);
+  appendVar(p);
 }
 
 void DataScopeServerTransaction::createRdWrVarInternal(const std::string& varName, const SALOME::ByteVec& constValue)
@@ -640,7 +669,7 @@ void DataScopeServerTransaction::createRdWrVarInternal(const std::string& varNam
   PickelizedPyObjRdWrServer *tmp(new PickelizedPyObjRdWrServer(this,varName,constValue));
   CORBA::Object_var ret(tmp->activate());
   std::pair< SALOME::BasicDataServer_var, BasicDataServer * > p(SALOME::BasicDataServer::_narrow(ret),tmp);
-  _vars.push_back(p);
+  appendVar(p);
 }
 
 SALOME::Transaction_ptr DataScopeServerTransaction::createRdOnlyVarTransac(const char *varName, const SALOME::ByteVec& constValue)
@@ -807,7 +836,7 @@ SALOME::TransactionRdWrAccess_ptr DataScopeServerTransaction::createWorkingVarTr
   PickelizedPyObjRdWrServer *tmp(new PickelizedPyObjRdWrServer(this,varNameCpp,constValue));
   CORBA::Object_var obj(tmp->activate());
   std::pair< SALOME::BasicDataServer_var, BasicDataServer * > p(SALOME::BasicDataServer::_narrow(obj),tmp);
-  _vars.push_back(p);
+  appendVar(p);
   //
   TransactionMorphRdWrIntoRdOnly *ret(new TransactionMorphRdWrIntoRdOnly(this,varName));
   CORBA::Object_var obj2(ret->activate());
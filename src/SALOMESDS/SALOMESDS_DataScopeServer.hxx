@@ -37,6 +37,7 @@
 #include <string>
 #include <vector>
 #include <list>
+#include <unordered_map>
 
 class SALOME_NamingService_Container_Abstract;
 
@@ -108,6 +109,10 @@ namespace SALOMESDS
     void checkNotAlreadyExistingVar(const std::string& varName) const;
     void checkExistingVar(const std::string& varName) const;
     PickelizedPyObjServer *checkVarExistingAndDict(const std::string& varName);
+  public:
+    std::list< PickelizedPyObjServer * >::iterator keepPickled(PickelizedPyObjServer *var, std::size_t sz);
+    void touchPickled(std::list< PickelizedPyObjServer * >::iterator pos);
+    void releasePickled(std::list< PickelizedPyObjServer * >::iterator pos, std::size_t sz);
   public:
     void moveStatusOfVarFromRdWrToRdOnly(const std::string& varName);
     void moveStatusOfVarFromRdOnlyToRdWr(const std::string& varName);
@@ -116,6 +121,8 @@ namespace SALOMESDS
   protected:
     std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::const_iterator retrieveVarInternal3(const std::string& varName) const;
     std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::iterator retrieveVarInternal4(const std::string& varName);
+    void appendVar(const std::pair< SALOME::BasicDataServer_var, BasicDataServer * >& p);
+    void buildVarsIndex();
   protected:
     SALOME_NamingService_Container_Abstract *_ns = nullptr;
     const SALOME_CPythonHelper *_pyHelper = nullptr;
@@ -123,7 +130,14 @@ namespace SALOMESDS
     CORBA::ORB_var _orb;
     std::string _name;
     std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > > _vars;
+    //! name of var -> position in _vars (_vars keeps the order of creation)
+    std::unordered_map< std::string, std::list< std::pair< SALOME::BasicDataServer_var, BasicDataServer * > >::iterator > _varsIndex;
     SALOME::DataScopeKiller_var _killer;
+    //! vars keeping their pickled form, least recently fetched first
+    std::list< PickelizedPyObjServer * > _pickledVars;
+    //! sum of the sizes of the pickled forms kept by the vars, at most PICKLED_MAX_SIZE unless a single one is bigger
+    std::size_t _pickledSize = 0;
+    static const std::size_t PICKLED_MAX_SIZE;
     static std::size_t COUNTER;
   };
   
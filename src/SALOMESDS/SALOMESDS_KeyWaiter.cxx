@@ -34,9 +34,7 @@ KeyWaiter::KeyWaiter(PickelizedPyObjServer *var, const SALOME::ByteVec& keyVal):
     throw Exception("KeyWaiter constructor : Invalid glob var is NULL !");
   if(!dynamic_cast<DataScopeServerTransaction *>(var->getFather()))
     throw Exception("KeyWaiter constructor : Invalid glob var ! Invalid DataScope hosting it ! DataScopeServerTransaction expected !");
-  std::string st;
-  PickelizedPyObjServer::FromByteSeqToCpp(keyVal,st);
-  _ze_key=PickelizedPyObjServer::GetPyObjFromPickled(st,getDSS());
+  _ze_key=PickelizedPyObjServer::GetPyObjFromPickled(keyVal,getDSS());
   PyObject *selfMeth(PyObject_GetAttrString(_var->getPyObj(),"__contains__"));//new ref
   PyObject *args(PyTuple_New(1));
   PyTuple_SetItem(args,0,_ze_key); Py_XINCREF(_ze_key); // _ze_key is stolen by PyTuple_SetItem
@@ -93,8 +91,8 @@ SALOME::ByteVec *KeyWaiter::waitForMonoThr()
   if(!_ze_value)
     throw Exception("KeyWaiter::waitForMonoThr : no value ! invalid call of this method !");
   Py_XINCREF(_ze_value);
-  std::string st(PickelizedPyObjServer::Pickelize(_ze_value,_var->getFather()));
-  return PickelizedPyObjServer::FromCppToByteSeq(st);
+  SALOME::AutoPyRef st(PickelizedPyObjServer::PickelizeToPyBytes(_ze_value,_var->getFather()));
+  return PickelizedPyObjServer::FromPyBytesToByteSeq(st);
 }
 
 SALOME::ByteVec *KeyWaiter::waitForAndKill()
@@ -102,12 +100,13 @@ SALOME::ByteVec *KeyWaiter::waitForAndKill()
   if(!_ze_value)
     throw Exception("KeyWaiter::waitForAndKill : no value ! invalid call of this method !");
   Py_XINCREF(_ze_value);
-  std::string st(PickelizedPyObjServer::Pickelize(_ze_value,_var->getFather()));
+  SALOME::AutoPyRef st(PickelizedPyObjServer::PickelizeToPyBytes(_ze_value,_var->getFather()));
   //
+  _var->invalidatePickled();
   if(PyDict_DelItem(_var->getPyObj(),_ze_key)!=0)
     throw Exception("KeyWaiter::waitForAndKill : error during entry removal !");
   //
-  return PickelizedPyObjServer::FromCppToByteSeq(st);
+  return PickelizedPyObjServer::FromPyBytesToByteSeq(st);
 }
 
 /*!
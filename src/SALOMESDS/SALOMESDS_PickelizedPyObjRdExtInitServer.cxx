@@ -59,8 +59,9 @@ std::string PickelizedPyObjRdExtInitServer::getAccessStr() const
 
 SALOME::ByteVec *PickelizedPyObjRdExtInitServer::fetchSerializedContent()
 {
-  Py_XINCREF(_self_deep_copy);//because pickelize consume _self_deep_copy
-  return FromCppToByteSeq(pickelize(_self_deep_copy));
+  Py_XINCREF(_self_deep_copy);//because PickelizeToPyBytes consume _self_deep_copy
+  SALOME::AutoPyRef pickled(PickelizeToPyBytes(_self_deep_copy,_father));
+  return FromPyBytesToByteSeq(pickled);
 }
 
 PyObject *PickelizedPyObjRdExtInitServer::DeepCopyPyObj(PyObject *pyobj)
@@ -50,9 +50,7 @@ SALOME::PickelizedPyObjRdExtServer_ptr PickelizedPyObjRdExtServer::invokePythonM
 {
   if(!_self)
     throw Exception("PickelizedPyObjRdExtServer::invokePythonMethodOn : self is NULL !");
-  std::string argsCpp;
-  FromByteSeqToCpp(args,argsCpp);
-  PyObject *argsPy(getPyObjFromPickled(argsCpp));
+  PyObject *argsPy(getPyObjFromPickled(args));
   checkRdExtnessOf(method,argsPy);
   //
   PyObject *selfMeth(PyObject_GetAttrString(_self,method));
@@ -61,6 +59,7 @@ SALOME::PickelizedPyObjRdExtServer_ptr PickelizedPyObjRdExtServer::invokePythonM
       std::ostringstream oss; oss << "PickelizedPyObjRdExtServer::invokePythonMethodOn : Method \"" << method << "\" is not available !";
       throw Exception(oss.str());
     }
+  invalidatePickled();
   PyObject *res(PyObject_CallObject(selfMeth,argsPy));// self can have been modified by this call !
   Py_XDECREF(selfMeth);
   Py_XDECREF(argsPy);
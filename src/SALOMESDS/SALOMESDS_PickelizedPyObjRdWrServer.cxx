@@ -58,9 +58,7 @@ SALOME::PickelizedPyObjRdWrServer_ptr PickelizedPyObjRdWrServer::invokePythonMet
 {
   if(!_self)
     throw Exception("PickelizedPyObjRdWrServer::invokePythonMethodOn : self is NULL !");
-  std::string argsCpp;
-  FromByteSeqToCpp(args,argsCpp);
-  PyObject *argsPy(getPyObjFromPickled(argsCpp));
+  PyObject *argsPy(getPyObjFromPickled(args));
   //
   PyObject *selfMeth(PyObject_GetAttrString(_self,method));
   if(!selfMeth)
@@ -68,6 +66,7 @@ SALOME::PickelizedPyObjRdWrServer_ptr PickelizedPyObjRdWrServer::invokePythonMet
       std::ostringstream oss; oss << "PickelizedPyObjRdWrServer::invokePythonMethodOn : Method \"" << method << "\" is not available !";
       throw Exception(oss.str());
     }
+  invalidatePickled();
   PyObject *res(PyObject_CallObject(selfMeth,argsPy));// self can have been modified by this call !
   Py_XDECREF(selfMeth);
   Py_XDECREF(argsPy);
@@ -110,6 +109,7 @@ SALOME::PickelizedPyObjRdWrServer_ptr PickelizedPyObjRdWrServer::invokePythonMet
 
 void PickelizedPyObjRdWrServer::addKeyValueHard(PyObject *key, PyObject *value)
 {
+  invalidatePickled();
   bool isOK(PyDict_SetItem(_self,key,value)==0);
   if(!isOK)
     throw Exception("PickelizedPyObjRdWrServer::addKeyValueHard : error when trying to add key,value to dict !");
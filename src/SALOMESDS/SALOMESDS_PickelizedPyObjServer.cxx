@@ -24,32 +24,36 @@
 
 #include <iostream>
 #include <sstream>
+#include <algorithm>
 
 using namespace SALOMESDS;
 
-PickelizedPyObjServer::PickelizedPyObjServer(DataScopeServerBase *father, const std::string& varName, const SALOME::ByteVec& value):BasicDataServer(father,varName),_self(0)
+PickelizedPyObjServer::PickelizedPyObjServer(DataScopeServerBase *father, const std::string& varName, const SALOME::ByteVec& value):BasicDataServer(father,varName),_self(0),_pickled(0)
 {
   setSerializedContentInternal(value);
 }
 
 //! obj is consumed
-PickelizedPyObjServer::PickelizedPyObjServer(DataScopeServerBase *father, const std::string& varName, PyObject *obj):BasicDataServer(father,varName),_self(0)
+PickelizedPyObjServer::PickelizedPyObjServer(DataScopeServerBase *father, const std::string& varName, PyObject *obj):BasicDataServer(father,varName),_self(0),_pickled(0)
 {
   setNewPyObj(obj);
 }
 
 PickelizedPyObjServer::~PickelizedPyObjServer()
 {
+  invalidatePickled();
   Py_XDECREF(_self);
 }
 
 /*!
  * Called remotely -> to protect against throw
+ *
+ * The cached pickled form of _self is copied into the returned sequence : the cache may be invalidated (transactions,
+ * KeyWaiter, change of status of the var) while the ORB is still marshalling the reply, so the sequence must own its buffer.
  */
 SALOME::ByteVec *PickelizedPyObjServer::fetchSerializedContent()
 {
-  Py_XINCREF(_self);//because pickelize consume _self
-  return FromCppToByteSeq(pickelize(_self));
+  return FromPyBytesToByteSeq(getPickled());
 }
 
 bool PickelizedPyObjServer::isDict()
@@ -84,11 +88,8 @@ void PickelizedPyObjServer::removeKeyInVarErrorIfNotAlreadyExisting(PyObject * /
 
 void PickelizedPyObjServer::FromByteSeqToCpp(const SALOME::ByteVec& bsToBeConv, std::string& ret)
 {
-  std::size_t sz(bsToBeConv.length());
-  ret.resize(sz,' ');
-  char *buf(const_cast<char *>(ret.c_str()));
-  for(std::size_t i=0;i<sz;i++)
-    buf[i]=bsToBeConv[(CORBA::ULong)i]; //!< TODO: size_t to CORBA::ULong
+  const char *buf(reinterpret_cast<const char *>(bsToBeConv.get_buffer()));
+  ret.assign(buf,bsToBeConv.length());
 }
 
 void PickelizedPyObjServer::FromCppToByteSeq(const std::string& strToBeConv, SALOME::ByteVec& ret)
@@ -96,8 +97,7 @@ void PickelizedPyObjServer::FromCppToByteSeq(const std::string& strToBeConv, SAL
   const char *buf(strToBeConv.c_str());
   std::size_t sz(strToBeConv.size());
   ret.length((CORBA::ULong)sz); //!< TODO: size_t to CORBA::ULong
-  for(std::size_t i=0;i<sz;i++)
-    ret[(CORBA::ULong)i]=buf[i]; //!< TODO: size_t to CORBA::ULong
+  std::copy(buf,buf+sz,reinterpret_cast<char *>(ret.get_buffer()));
 }
 
 SALOME::ByteVec *PickelizedPyObjServer::FromCppToByteSeq(const std::string& strToBeConv)
@@ -107,14 +107,25 @@ SALOME::ByteVec *PickelizedPyObjServer::FromCppToByteSeq(const std::string& strT
   return ret;
 }
 
-//! New reference returned
-PyObject *PickelizedPyObjServer::GetPyObjFromPickled(const std::string& pickledData, DataScopeServerBase *dsb)
+//! The content of pickledData is copied once into the returned sequence.
+SALOME::ByteVec *PickelizedPyObjServer::FromPyBytesToByteSeq(PyObject *pickledData)
 {
-  std::size_t sz(pickledData.size());
-  PyObject *pickledDataPy(PyBytes_FromStringAndSize(NULL,sz));// agy : do not use PyUnicode_FromString because std::string hides a vector of byte.
-  char *buf(PyBytes_AS_STRING(pickledDataPy));// this buf can be used thanks to python documentation.
-  const char *inBuf(pickledData.c_str());
-  std::copy(inBuf,inBuf+sz,buf);
+  std::size_t sz(PyBytes_Size(pickledData));
+  const CORBA::Octet *buf(reinterpret_cast<const CORBA::Octet *>(PyBytes_AS_STRING(pickledData)));
+  SALOME::ByteVec *ret(new SALOME::ByteVec);
+  ret->length((CORBA::ULong)sz); //!< TODO: size_t to CORBA::ULong
+  std::copy(buf,buf+sz,ret->get_buffer());
+  return ret;
+}
+
+/*!
+ * New reference returned. pickle.loads is fed with a read only memoryview on \a pickledData so no copy of the
+ * pickled data is done. \a pickledData has only to stay alive during the call.
+ */
+PyObject *PickelizedPyObjServer::GetPyObjFromPickled(const char *pickledData, std::size_t sz, DataScopeServerBase *dsb)
+{
+  static char EMPTY[]="";
+  PyObject *pickledDataPy(PyMemoryView_FromMemory(pickledData?const_cast<char *>(pickledData):EMPTY,(Py_ssize_t)sz,PyBUF_READ));
   PyObject *selfMeth(PyObject_GetAttrString(dsb->getPickler(),"loads"));
   PyObject *args(PyTuple_New(1)); PyTuple_SetItem(args,0,pickledDataPy);
   PyObject *ret(PyObject_CallObject(selfMeth,args));
@@ -123,6 +134,12 @@ PyObject *PickelizedPyObjServer::GetPyObjFromPickled(const std::string& pickledD
   return ret;
 }
 
+//! New reference returned
+PyObject *PickelizedPyObjServer::GetPyObjFromPickled(const std::string& pickledData, DataScopeServerBase *dsb)
+{
+  return GetPyObjFromPickled(pickledData.c_str(),pickledData.size(),dsb);
+}
+
 //! New reference returned
 PyObject *PickelizedPyObjServer::getPyObjFromPickled(const std::string& pickledData)
 {
@@ -132,17 +149,7 @@ PyObject *PickelizedPyObjServer::getPyObjFromPickled(const std::string& pickledD
 //! New reference returned
 PyObject *PickelizedPyObjServer::GetPyObjFromPickled(const std::vector<unsigned char>& pickledData, DataScopeServerBase *dsb)
 {
-  std::size_t sz(pickledData.size());
-  PyObject *pickledDataPy(PyBytes_FromStringAndSize(NULL,sz));// agy : do not use PyUnicode_FromString because std::string hides a vector of byte.
-  char *buf(PyBytes_AS_STRING(pickledDataPy));// this buf can be used thanks to python documentation.
-  const unsigned char *inBuf(pickledData.data());
-  std::copy(inBuf,inBuf+sz,buf);
-  PyObject *selfMeth(PyObject_GetAttrString(dsb->getPickler(),"loads"));
-  PyObject *args(PyTuple_New(1)); PyTuple_SetItem(args,0,pickledDataPy);
-  PyObject *ret(PyObject_CallObject(selfMeth,args));
-  Py_XDECREF(args);
-  Py_XDECREF(selfMeth);
-  return ret;
+  return GetPyObjFromPickled(reinterpret_cast<const char *>(pickledData.data()),pickledData.size(),dsb);
 }
 
 //! New reference returned
@@ -151,8 +158,20 @@ PyObject *PickelizedPyObjServer::getPyObjFromPickled(const std::vector<unsigned
   return GetPyObjFromPickled(pickledData,_father);
 }
 
-//! obj is consumed by this method.
-std::string PickelizedPyObjServer::Pickelize(PyObject *obj, DataScopeServerBase *dsb)
+//! New reference returned. The octet buffer of \a pickledData is read in place.
+PyObject *PickelizedPyObjServer::GetPyObjFromPickled(const SALOME::ByteVec& pickledData, DataScopeServerBase *dsb)
+{
+  return GetPyObjFromPickled(reinterpret_cast<const char *>(pickledData.get_buffer()),pickledData.length(),dsb);
+}
+
+//! New reference returned
+PyObject *PickelizedPyObjServer::getPyObjFromPickled(const SALOME::ByteVec& pickledData)
+{
+  return GetPyObjFromPickled(pickledData,_father);
+}
+
+//! obj is consumed by this method. New reference (PyBytes) returned.
+PyObject *PickelizedPyObjServer::PickelizeToPyBytes(PyObject *obj, DataScopeServerBase *dsb)
 {
   PyObject *args(PyTuple_New(2));
   PyTuple_SetItem(args,0,obj);
@@ -161,12 +180,20 @@ std::string PickelizedPyObjServer::Pickelize(PyObject *obj, DataScopeServerBase
   PyObject *retPy(PyObject_CallObject(selfMeth,args));
   Py_XDECREF(selfMeth);
   Py_XDECREF(args);
-  std::size_t sz(PyBytes_Size(retPy));
-  std::string ret(sz,'\0');
-  const char *buf(PyBytes_AS_STRING(retPy));
-  char *inBuf(const_cast<char *>(ret.c_str()));
-  for(std::size_t i=0;i<sz;i++)
-    inBuf[i]=buf[i];
+  if(!retPy || !PyBytes_Check(retPy))
+    {
+      Py_XDECREF(retPy);
+      PyErr_Clear();
+      throw Exception("PickelizedPyObjServer::PickelizeToPyBytes : pickle.dumps failed !");
+    }
+  return retPy;
+}
+
+//! obj is consumed by this method.
+std::string PickelizedPyObjServer::Pickelize(PyObject *obj, DataScopeServerBase *dsb)
+{
+  PyObject *retPy(PickelizeToPyBytes(obj,dsb));
+  std::string ret(PyBytes_AS_STRING(retPy),PyBytes_Size(retPy));
   Py_XDECREF(retPy);
   return ret;
 }
@@ -177,9 +204,39 @@ std::string PickelizedPyObjServer::pickelize(PyObject *obj)
   return Pickelize(obj,_father);
 }
 
+/*!
+ * Borrowed reference returned, valid until the next call of getPickled on a var of the same scope. The pickled form
+ * of _self is computed at the first call and then kept until invalidatePickled is called, by this or by the scope
+ * when the pickled forms of its vars exceed DataScopeServerBase::PICKLED_MAX_SIZE bytes.
+ */
+PyObject *PickelizedPyObjServer::getPickled()
+{
+  if(!_pickled)
+    {
+      Py_XINCREF(_self);//because PickelizeToPyBytes consume _self
+      PyObject *pickled(PickelizeToPyBytes(_self,_father));
+      _pickledPos=_father->keepPickled(this,PyBytes_Size(pickled));
+      _pickled=pickled;
+    }
+  else
+    _father->touchPickled(_pickledPos);
+  return _pickled;
+}
+
+//! To be called each time _self is (or may have been) modified.
+void PickelizedPyObjServer::invalidatePickled()
+{
+  if(!_pickled)
+    return ;
+  _father->releasePickled(_pickledPos,PyBytes_Size(_pickled));
+  Py_XDECREF(_pickled);
+  _pickled=0;
+}
+
 //! obj is consumed by this method.
 void PickelizedPyObjServer::setNewPyObj(PyObject *obj)
 {
+  invalidatePickled();
   if(!obj)
     throw Exception("PickelizedPyObjServer::setNewPyObj : trying to assign a NULL pyobject in this !");
   if(obj==_self)
@@ -204,9 +261,7 @@ void PickelizedPyObjServer::setNewPyObj(PyObject *obj)
 
 void PickelizedPyObjServer::setSerializedContentInternal(const SALOME::ByteVec& newValue)
 {
-  std::string data;
-  FromByteSeqToCpp(newValue,data);
-  setNewPyObj(getPyObjFromPickled(data));
+  setNewPyObj(getPyObjFromPickled(newValue));
 }
 
 PyObject *PickelizedPyObjServer::CreateDftObjFromType(PyObject *globals, const std::string& typeName)
@@ -266,6 +321,7 @@ PickelizedPyObjServerModifiable::PickelizedPyObjServerModifiable(DataScopeServer
 void PickelizedPyObjServerModifiable::addKeyValueErrorIfAlreadyExisting(PyObject *key, PyObject *value)
 {
   checkKeyNotAlreadyPresent(key);
+  invalidatePickled();
   bool isOK(PyDict_SetItem(_self,key,value)==0);
   if(!isOK)
     throw Exception("PickelizedPyObjServerModifiable::addKeyValueErrorIfAlreadyExisting : error when trying to add key,value to dict !");
@@ -274,6 +330,7 @@ void PickelizedPyObjServerModifiable::addKeyValueErrorIfAlreadyExisting(PyObject
 void PickelizedPyObjServerModifiable::removeKeyInVarErrorIfNotAlreadyExisting(PyObject *key)
 {
   checkKeyPresent(key);
+  invalidatePickled();
   if(PyDict_DelItem(_self,key)!=0)
     throw Exception("PickelizedPyObjServerModifiable::removeKeyInVarErrorIfNotAlreadyExisting : error during deletion of key in dict !");
 }
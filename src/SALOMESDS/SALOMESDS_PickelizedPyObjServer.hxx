@@ -29,6 +29,7 @@
 #include "SALOMESDS_BasicDataServer.hxx"
 
 #include <vector>
+#include <list>
 
 namespace SALOMESDS
 {
@@ -54,12 +55,19 @@ namespace SALOMESDS
     static void FromByteSeqToCpp(const SALOME::ByteVec& bsToBeConv, std::string& ret);
     static void FromCppToByteSeq(const std::string& strToBeConv, SALOME::ByteVec& ret);
     static SALOME::ByteVec *FromCppToByteSeq(const std::string& strToBeConv);
+    static SALOME::ByteVec *FromPyBytesToByteSeq(PyObject *pickledData);
     static PyObject *GetPyObjFromPickled(const std::string& pickledData, DataScopeServerBase *dsb);
     static PyObject *GetPyObjFromPickled(const std::vector<unsigned char>& pickledData, DataScopeServerBase *dsb);
+    static PyObject *GetPyObjFromPickled(const SALOME::ByteVec& pickledData, DataScopeServerBase *dsb);
+    static PyObject *GetPyObjFromPickled(const char *pickledData, std::size_t sz, DataScopeServerBase *dsb);
     static std::string Pickelize(PyObject *obj, DataScopeServerBase *dsb);
+    static PyObject *PickelizeToPyBytes(PyObject *obj, DataScopeServerBase *dsb);
     PyObject *getPyObjFromPickled(const std::string& pickledData);
     PyObject *getPyObjFromPickled(const std::vector<unsigned char>& pickledData);
+    PyObject *getPyObjFromPickled(const SALOME::ByteVec& pickledData);
     std::string pickelize(PyObject *obj);
+    PyObject *getPickled();
+    void invalidatePickled();
     void setNewPyObj(PyObject *obj);
     void setSerializedContentInternal(const SALOME::ByteVec& newValue);
     static PyObject *CreateDftObjFromType(PyObject *globals, const std::string& typeName);
@@ -68,6 +76,11 @@ namespace SALOMESDS
   protected:
     static const char FAKE_VAR_NAME_FOR_WORK[];
     PyObject *_self;
+    //! pickled form of _self (PyBytes) computed lazily and kept until _self is modified, or until the scope releases it
+    //! to keep the pickled forms of its vars under DataScopeServerBase::PICKLED_MAX_SIZE bytes
+    PyObject *_pickled;
+    //! position of this in the vars of the scope keeping their pickled form, valid if _pickled is not null
+    std::list< PickelizedPyObjServer * >::iterator _pickledPos;
     PortableServer::POA_var _poa;
   };
 
@@ -26,24 +26,21 @@
 #include "SALOMESDS_TrustTransaction.hxx"
 
 #include <sstream>
+#include <algorithm>
 
 using namespace SALOMESDS;
 
 void Transaction::FromByteSeqToVB(const SALOME::ByteVec& bsToBeConv, std::vector<unsigned char>& ret)
 {
-  std::size_t sz(bsToBeConv.length());
-  ret.resize(sz);
-  unsigned char *buf(const_cast<unsigned char *>(&ret[0]));
-  for(std::size_t i=0;i<sz;i++)
-    buf[i]=bsToBeConv[(CORBA::ULong)i]; //!< TODO: size_t to CORBA::ULong
+  const unsigned char *buf(bsToBeConv.get_buffer());
+  ret.assign(buf,buf+bsToBeConv.length());
 }
 
 void Transaction::FromVBToByteSeq(const std::vector<unsigned char>& bsToBeConv, SALOME::ByteVec& ret)
 {
   std::size_t sz(bsToBeConv.size());
   ret.length((CORBA::ULong)sz); //!< TODO: size_t to CORBA::ULong
-  for(std::size_t i=0;i<sz;i++)
-    ret[(CORBA::ULong)i]=bsToBeConv[i]; //!< TODO: size_t to CORBA::ULong
+  std::copy(bsToBeConv.begin(),bsToBeConv.end(),ret.get_buffer());
 }
 
 Transaction::~Transaction()
@@ -494,6 +494,72 @@ class SalomeSDSTest(unittest.TestCase):
     dsm.removeDataScope(scopeName)
     pass
   
+  def testManyVars(self):
+    """ Benchmark: time of lookups by name must not grow with the number of vars of the scope.
+    """
+    scopeName="ScopeManyVars"
+    dsm=salome.naming_service.Resolve("/DataServerManager")
+    dsm.cleanScopesInNS()
+    if scopeName in dsm.listScopes():
+      dsm.removeDataScope(scopeName)
+    dss,isCreated=dsm.giveADataScopeTransactionCalled(scopeName)
+    self.assertTrue(isCreated)
+    #
+    nbVars=0
+    nbLookups=500
+    for target in [1000,4000,16000]:
+      st=datetime.now()
+      for i in range(nbVars,target):
+        t=dss.createRdOnlyVarTransac("v%d"%i,obj2Str(i))
+        dss.atomicApply([t])
+      creation=(datetime.now()-st).total_seconds()/(target-nbVars)
+      nbVars=target
+      st=datetime.now()
+      for i in range(nbLookups):
+        varName="v%d"%(nbVars-1-i)
+        self.assertTrue(dss.existVar(varName))
+        self.assertEqual(str2Obj(dss.fetchSerializedContent(varName)),nbVars-1-i)
+      lookup=(datetime.now()-st).total_seconds()/nbLookups
+      print("%d vars : %.1f us per creation, %.1f us per lookup"%(nbVars,creation*1e6,lookup*1e6))
+    self.assertEqual(len(dss.listVars()),nbVars)
+    dss.deleteVar("v0")
+    self.assertFalse(dss.existVar("v0"))
+    self.assertEqual(dss.listVars()[0],"v1") # order of creation is kept
+    dsm.removeDataScope(scopeName)
+    pass
+
+  def testBigPayload(self):
+    """ Benchmark: 100 MB payload. Server side the pickled data is unpickled in place. The pickled form of the var is
+    kept as long as the var is not modified, so that fetches copy it into the reply instead of pickling the var again.
+    The pickled forms kept by the vars of a scope take at most 512 MB, the least recently fetched ones are released first.
+    """
+    scopeName="ScopeBigPayload"
+    varName="a"
+    dsm=salome.naming_service.Resolve("/DataServerManager")
+    dsm.cleanScopesInNS()
+    if scopeName in dsm.listScopes():
+      dsm.removeDataScope(scopeName)
+    dss,isCreated=dsm.giveADataScopeTransactionCalled(scopeName)
+    self.assertTrue(isCreated)
+    #
+    payload=bytes(100*1024*1024)
+    st=datetime.now()
+    t0=dss.createRdWrVarTransac(varName,obj2Str({"ab":payload}))
+    dss.atomicApply([t0])
+    print("100 MB : %.3f s for creation"%((datetime.now()-st).total_seconds()))
+    for i in range(3):
+      st=datetime.now()
+      data=dss.fetchSerializedContent(varName)
+      print("100 MB : %.3f s for fetch #%d"%((datetime.now()-st).total_seconds(),i))
+      self.assertEqual(len(str2Obj(data)["ab"]),len(payload))
+    # modification must invalidate the pickled form kept server side
+    t1=dss.addKeyValueInVarHard(varName,obj2Str("cd"),obj2Str([7,8,9,10]))
+    dss.atomicApply([t1])
+    self.assertEqual(str2Obj(dss.getValueOfVarWithTypeDict(varName,obj2Str("cd"))),[7,8,9,10])
+    self.assertEqual(str2Obj(dss.fetchSerializedContent(varName))["cd"],[7,8,9,10])
+    dsm.removeDataScope(scopeName)
+    pass
+
   def testShutdownScopes(self):
     """ Test shutdownScopes.
     """
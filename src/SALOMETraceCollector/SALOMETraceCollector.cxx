@@ -31,10 +31,12 @@
 #include <sstream>
 #include <fstream>
 #include <cstdlib>
+#include <chrono>
 #include <omniORB4/CORBA.h>
 
 #include "SALOMETraceCollector.hxx"
 #include "TraceCollector_WaitForServerReadiness.hxx"
+#include "BinaryTraceRecord.hxx"
 #include <SALOMEconfig.h>
 #include CORBA_CLIENT_HEADER(Logger)
 
@@ -86,6 +88,9 @@ BaseTraceCollector* SALOMETraceCollector::instance()
  *  Loop until there is no more buffer to print,
  *  and no ask for end from destructor.
  *  Get a buffer. If type = ABORT then exit application with message.
+ *  Messages are sent to the Logger server by batches (putMessages), when
+ *  TRACE_FLUSH_SIZE bytes are collected, or TRACE_FLUSH_DELAY ms after the
+ *  first message not yet sent, or when there is nothing more to print.
  */
 // ============================================================================
 
@@ -121,6 +126,11 @@ void* SALOMETraceCollector::run(void* /*bid*/)
   // --- Loop until there is no more buffer to print,
   //     and no ask for end from destructor.
 
+  SALOME_Logger::MessageList messages;
+  CORBA::ULong nbMessages = 0;
+  size_t nbBytes = 0;
+  std::chrono::steady_clock::time_point firstToFlush;
+
   while ((!_threadToClose) || myTraceBuffer->toCollect() )
     {
       if (_threadToClose)
@@ -129,11 +139,31 @@ void* SALOMETraceCollector::run(void* /*bid*/)
           //break;
         }
 
-      myTraceBuffer->retrieve(myTrace);
+      int timeout = -1; // wait for the next message if everything is sent
+      if (nbMessages)
+        {
+          long long elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+            (std::chrono::steady_clock::now() - firstToFlush).count();
+          timeout = elapsed < TRACE_FLUSH_DELAY ? (int)(TRACE_FLUSH_DELAY - elapsed) : 0;
+        }
+      if (myTraceBuffer->retrieve(myTrace, timeout) < 0)
+        {
+          messages.length(nbMessages);
+          m_pInterfaceLogger->putMessages(messages);
+          nbMessages = 0;
+          nbBytes = 0;
+          continue;
+        }
+      BinaryTraceRecord::toText(myTrace); // deferred formatting of BTRACE
       if (!CORBA::is_nil(_orb))
         {
           if (myTrace.traceType == ABORT_MESS)
             {
+              if (nbMessages)
+                {
+                  messages.length(nbMessages);
+                  m_pInterfaceLogger->putMessages(messages);
+                }
               std::stringstream abortMessage("");
 #ifndef WIN32
               abortMessage << "INTERRUPTION from thread "
@@ -157,12 +187,30 @@ void* SALOMETraceCollector::run(void* /*bid*/)
                 aMessage << "th. " << (void*)&myTrace.threadId
 #endif
                        << " " << myTrace.trace;
-              CORBA::String_var LogMsg =
-                CORBA::string_dup(aMessage.str().c_str());
-              m_pInterfaceLogger->putMessage(LogMsg);
+              std::string text = aMessage.str();
+              if (nbMessages == 0)
+                firstToFlush = std::chrono::steady_clock::now();
+              if (nbMessages >= messages.length())
+                messages.length(2*nbMessages + 16);
+              messages[nbMessages++] = text.c_str();
+              nbBytes += text.size();
+              if (nbBytes >= TRACE_FLUSH_SIZE ||
+                  std::chrono::steady_clock::now() - firstToFlush >=
+                  std::chrono::milliseconds(TRACE_FLUSH_DELAY))
+                {
+                  messages.length(nbMessages);
+                  m_pInterfaceLogger->putMessages(messages);
+                  nbMessages = 0;
+                  nbBytes = 0;
+                }
             }
         }
     }
+  if (nbMessages)
+    {
+      messages.length(nbMessages);
+      m_pInterfaceLogger->putMessages(messages);
+    }
   pthread_exit(NULL);
   return NULL;
 }
@@ -28,6 +28,8 @@
 //
 #include "Utils_Mutex.hxx"
 
+#include <vector>
+
 Utils_Mutex::Utils_Mutex() 
 : myCount( 0 )
 {
@@ -81,6 +83,138 @@ void Utils_Mutex::unlock()
   pthread_mutex_unlock( &myHelperMutex );
 }
 
+// locks of the calling thread on a Utils_RWMutex
+struct Utils_RWMutex::Holder
+{
+  Holder() : myShared( 0 ), myExclusive( 0 ) {}
+
+  int              myShared;
+  int              myExclusive;
+  std::vector<int> mySuspended; // levels released by suspend(): 0 - none, 1 - shared, 2 - exclusive
+};
+
+Utils_RWMutex::Utils_RWMutex()
+: myReaders( 0 ), myWaitingWriters( 0 ), myWriter( false )
+{
+  pthread_mutex_init( &myMutex, 0 );
+  pthread_cond_init( &myCondition, 0 );
+  pthread_key_create( &myHolderKey, []( void* theHolder ) { delete (Holder*)theHolder; } );
+}
+
+Utils_RWMutex::~Utils_RWMutex()
+{
+  pthread_key_delete( myHolderKey );
+  pthread_cond_destroy( &myCondition );
+  pthread_mutex_destroy( &myMutex );
+}
+
+Utils_RWMutex::Holder* Utils_RWMutex::holder()
+{
+  Holder* aHolder = (Holder*)pthread_getspecific( myHolderKey );
+  if ( !aHolder ) {
+    aHolder = new Holder();
+    pthread_setspecific( myHolderKey, aHolder );
+  }
+  return aHolder;
+}
+
+void Utils_RWMutex::lock()
+{
+  Holder* aHolder = holder();
+  if ( aHolder->myExclusive > 0 ) {
+    aHolder->myExclusive++;
+    return;
+  }
+
+  pthread_mutex_lock( &myMutex );
+  // a reader of the mutex leaves the readers, or two of them locking it
+  // exclusive would wait for each other
+  if ( aHolder->myShared > 0 && --myReaders == 0 )
+    pthread_cond_broadcast( &myCondition );
+  myWaitingWriters++;
+  while ( myWriter || myReaders > 0 )
+    pthread_cond_wait( &myCondition, &myMutex );
+  myWaitingWriters--;
+  myWriter = true;
+  pthread_mutex_unlock( &myMutex );
+
+  aHolder->myExclusive = 1;
+}
+
+void Utils_RWMutex::unlock()
+{
+  Holder* aHolder = holder();
+  if ( aHolder->myExclusive == 0 || --aHolder->myExclusive > 0 )
+    return;
+
+  pthread_mutex_lock( &myMutex );
+  myWriter = false;
+  if ( aHolder->myShared > 0 )
+    myReaders++;
+  pthread_cond_broadcast( &myCondition );
+  pthread_mutex_unlock( &myMutex );
+}
+
+void Utils_RWMutex::lockShared()
+{
+  Holder* aHolder = holder();
+  if ( aHolder->myShared > 0 || aHolder->myExclusive > 0 ) {
+    aHolder->myShared++;
+    return;
+  }
+
+  pthread_mutex_lock( &myMutex );
+  // the waiting writers go first, not to be starved by a flow of readers
+  while ( myWriter || myWaitingWriters > 0 )
+    pthread_cond_wait( &myCondition, &myMutex );
+  myReaders++;
+  pthread_mutex_unlock( &myMutex );
+
+  aHolder->myShared = 1;
+}
+
+void Utils_RWMutex::unlockShared()
+{
+  Holder* aHolder = holder();
+  if ( aHolder->myShared == 0 || --aHolder->myShared > 0 || aHolder->myExclusive > 0 )
+    return;
+
+  pthread_mutex_lock( &myMutex );
+  if ( --myReaders == 0 )
+    pthread_cond_broadcast( &myCondition );
+  pthread_mutex_unlock( &myMutex );
+}
+
+void Utils_RWMutex::suspend()
+{
+  Holder* aHolder = holder();
+  if ( aHolder->myExclusive > 0 ) {
+    aHolder->mySuspended.push_back( 2 );
+    unlock();
+  }
+  else if ( aHolder->myShared > 0 ) {
+    aHolder->mySuspended.push_back( 1 );
+    unlockShared();
+  }
+  else {
+    aHolder->mySuspended.push_back( 0 );
+  }
+}
+
+void Utils_RWMutex::resume()
+{
+  Holder* aHolder = holder();
+  int aLevel = 2;
+  if ( !aHolder->mySuspended.empty() ) {
+    aLevel = aHolder->mySuspended.back();
+    aHolder->mySuspended.pop_back();
+  }
+  if ( aLevel == 2 )
+    lock();
+  else if ( aLevel == 1 )
+    lockShared();
+}
+
 Utils_Locker::Utils_Locker( Utils_Mutex* mutex )
 : myMutex( mutex ) 
 { 
@@ -49,6 +49,40 @@ private:
   int             myCount;
 };
 
+// Recursive reader-writer mutex: several threads may hold it shared,
+// only one may hold it exclusive.
+// A thread holding it exclusive may lock it shared, a thread holding it shared
+// which locks it exclusive gives up its shared lock while waiting for the other readers,
+// and gets it back when the exclusive lock is released.
+class UTILS_EXPORT Utils_RWMutex
+{
+public:
+  Utils_RWMutex();
+  ~Utils_RWMutex();
+
+  void lock();
+  void unlock();
+
+  void lockShared();
+  void unlockShared();
+
+  // releases one level of the lock held by the calling thread (the exclusive one first)
+  void suspend();
+  // takes back the level released by the last suspend(), exclusive if there is none
+  void resume();
+
+private:
+  struct Holder;
+  Holder* holder();
+
+  pthread_mutex_t myMutex;
+  pthread_cond_t  myCondition;
+  pthread_key_t   myHolderKey;
+  int             myReaders;        // threads holding the mutex shared
+  int             myWaitingWriters;
+  bool            myWriter;
+};
+
 class UTILS_EXPORT Utils_Locker
 {
 public: